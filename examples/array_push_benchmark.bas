@@ -0,0 +1,22 @@
+REM Array growth benchmark: 100,000 PUSH calls on one list.
+REM `list = PUSH(list, i)` and `PUSH(list, i)` update the variable in place,
+REM so each push is amortized O(1) instead of copying the whole array.
+REM Run with: time cyberbasic examples/array_push_benchmark.bas
+
+list = ARRAY(0)
+FOR i = 1 TO 100000
+  list = PUSH(list, i)
+NEXT
+PRINT LEN(list)
+
+FOR i = 1 TO 100000
+  list = POP(list)
+NEXT
+PRINT LEN(list)
+
+FOR i = 1 TO 100000
+  PUSH(list, 100000 - i)
+NEXT
+list = SORT(list)
+PRINT list[0]
+PRINT list[99999]
@@ -1,8 +1,12 @@
 #pragma once
+#include <charconv>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
 #include "token.hpp"
+#include "value.hpp"
+#include "symbol.hpp"
 
 namespace bas {
 
@@ -10,12 +14,53 @@ struct Expr {
   virtual ~Expr() = default;
 };
 
+struct SubDecl;
+struct FunctionDecl;
+struct NativeFn;
+
+// Target of a call site, resolved by the interpreter on first use and reused
+// while the program run and the function registry it was resolved against
+// are unchanged. At most one of sub/func/native is set.
+struct CallCache {
+  uint64_t run{0};
+  uint64_t registry_version{0};
+  std::string name;  // folded name the entry was resolved for
+  const SubDecl* sub{nullptr};
+  const FunctionDecl* func{nullptr};
+  const NativeFn* native{nullptr};
+};
+
+// Value of a literal token. Numbers without a decimal point that fit in
+// 64 bits become integers; all other numbers are doubles.
+[[nodiscard]] inline Value literal_value(const Token& t) {
+  switch (t.kind) {
+    case Tok::Number: {
+      if (t.lex.find('.') == std::string::npos) {
+        long long i = 0;
+        auto [end, ec] = std::from_chars(t.lex.data(), t.lex.data() + t.lex.size(), i);
+        if (ec == std::errc() && end == t.lex.data() + t.lex.size()) return Value::from_int(i);
+      }
+      return Value::from_number(std::stod(t.lex));
+    }
+    case Tok::String: return Value::from_string(t.lex);
+    case Tok::True: return Value::from_bool(true);
+    case Tok::False: return Value::from_bool(false);
+    default: return Value::nil();
+  }
+}
+
+// Literal constant; `value` is computed once when the node is built.
 struct Literal : Expr {
-  Token tok; explicit Literal(Token t): tok(std::move(t)) {}
+  Token tok;
+  Value value;
+  explicit Literal(Token t): tok(std::move(t)), value(literal_value(tok)) {}
+  Literal(Token t, Value v): tok(std::move(t)), value(std::move(v)) {}
 };
 
 struct Variable : Expr {
-  std::string name; explicit Variable(std::string n): name(std::move(n)) {}
+  std::string name;
+  Symbol sym;
+  explicit Variable(std::string n): name(std::move(n)), sym(intern(name)) {}
 };
 
 struct Unary : Expr {
@@ -24,8 +69,13 @@ struct Unary : Expr {
   Unary(Tok o, std::unique_ptr<Expr> r): op(o), right(std::move(r)) {}
 };
 
+// Operand types a binary operator has been specialised for. The interpreter
+// sets it from the operands it observes and resets it to Generic on a miss.
+enum class OperandKind : uint8_t { Generic, Int, Num, Str };
+
 struct Binary : Expr {
   std::unique_ptr<Expr> left, right; Tok op;
+  mutable OperandKind quick{OperandKind::Generic};
   Binary(std::unique_ptr<Expr> l, Tok o, std::unique_ptr<Expr> r)
     : left(std::move(l)), right(std::move(r)), op(o) {}
 };
@@ -40,6 +90,7 @@ struct Call : Expr {
   std::string callee; 
   std::vector<std::unique_ptr<Expr>> args;
   std::vector<NamedArg> namedArgs; // Named parameters
+  mutable CallCache cache;
   Call(std::string c, std::vector<std::unique_ptr<Expr>> a)
     : callee(std::move(c)), args(std::move(a)) {}
 };
@@ -51,17 +102,46 @@ struct Index : Expr {
     : target(std::move(t)), index(std::move(i)) {}
 };
 
+// Field of a packed value named by a member access or assignment, resolved
+// by name the first time the node sees a given packed kind.
+struct FieldCache {
+  Packed::Kind kind{};
+  int8_t index{-2};  // -2 unresolved, -1 no such field
+  int lookup(const Packed& p, const std::string& name) {
+    if (index == -2 || kind != p.kind) {
+      kind = p.kind;
+      index = static_cast<int8_t>(packed_field(p.kind, name));
+    }
+    return index;
+  }
+};
+
 struct MemberAccess : Expr {
   std::unique_ptr<Expr> object;
   std::string member;
+  mutable FieldCache field;
   MemberAccess(std::unique_ptr<Expr> obj, std::string mem)
     : object(std::move(obj)), member(std::move(mem)) {}
 };
 
+// Receiver-type dispatch for `obj.method(...)`, kept per call site. `type`
+// is the receiver type the entry was resolved for; while it repeats, the
+// call goes straight to `target` (TYPE_METHOD) with the receiver prepended.
+struct MethodCache {
+  enum class Kind : uint8_t { Typed, Lambda, Method, Namespace };
+  std::string type;
+  Kind kind{Kind::Typed};
+  std::string func;         // folded TYPE_METHOD name
+  CallCache target;
+  int8_t chainable{-1};     // -1 until the method name has been classified
+};
+
 struct MethodCall : Expr {
   std::unique_ptr<Expr> object;
   std::string method;
   std::vector<std::unique_ptr<Expr>> args;
+  mutable CallCache cache;  // the method name called as a global function
+  mutable MethodCache dispatch;
   MethodCall(std::unique_ptr<Expr> obj, std::string m, std::vector<std::unique_ptr<Expr>> a)
     : object(std::move(obj)), method(std::move(m)), args(std::move(a)) {}
 };
@@ -70,7 +150,10 @@ struct ArrayLiteral : Expr {
   std::vector<std::unique_ptr<Expr>> elements;
 };
 
-struct Stmt { virtual ~Stmt() = default; };
+struct Stmt {
+  virtual ~Stmt() = default;
+  int line{0};  // source line the statement starts on; 0 for desugared statements
+};
 // OPTION EXPLICIT directive (enable strict undeclared-variable checks)
 struct OptionExplicit : Stmt { bool enabled{true}; };
 struct Let : Stmt { 
@@ -80,7 +163,7 @@ struct Let : Stmt {
   bool hasType{false};
 };
 struct ConstDecl : Stmt { std::string name; std::unique_ptr<Expr> value; };
-struct Assign : Stmt { std::string name; std::unique_ptr<Expr> value; };
+struct Assign : Stmt { std::string name; Symbol sym{0}; std::unique_ptr<Expr> value; };
 struct LocalDecl : Stmt { std::vector<std::string> names; };
 struct GlobalDecl : Stmt { std::vector<std::string> names; };
 struct Print : Stmt { std::unique_ptr<Expr> value; };
@@ -90,11 +173,11 @@ struct ExprStmt : Stmt {
   ExprStmt() = default;
   explicit ExprStmt(std::unique_ptr<Expr> e) : expr(std::move(e)) {}
 };
-struct CallStmt : Stmt { std::string name; std::vector<std::unique_ptr<Expr>> args; };
+struct CallStmt : Stmt { std::string name; std::vector<std::unique_ptr<Expr>> args; mutable CallCache cache; };
 struct Break : Stmt {}; // Simple break statement
 struct Continue : Stmt {}; // Continue current loop
 struct Exit : Stmt {
-    std::string target; // "FOR", "WHILE", "SUB", "FUNCTION"
+    std::string target; // "for", "while", "do"/"loop", "repeat", "sub", "function"
 };
 struct Goto : Stmt { std::string label; }; // GOTO label
 struct Gosub : Stmt { std::string label; }; // GOSUB label
@@ -131,6 +214,7 @@ struct RepeatUntil : Stmt { std::vector<std::unique_ptr<Stmt>> body; std::unique
 
 struct ForNext : Stmt {
   std::string var;
+  Symbol var_sym{0};
   std::unique_ptr<Expr> init;
   std::unique_ptr<Expr> limit;
   std::unique_ptr<Expr> step; // may be null -> default 1
@@ -161,8 +245,13 @@ struct FunctionDecl : Stmt {
   std::vector<std::unique_ptr<Stmt>> body;
 };
 
-struct AssignIndex : Stmt { std::string name; std::vector<std::unique_ptr<Expr>> indices; std::unique_ptr<Expr> value; };
-struct AssignMember : Stmt { std::unique_ptr<Expr> object; std::string member; std::unique_ptr<Expr> value; };
+struct AssignIndex : Stmt { std::string name; Symbol sym{0}; std::vector<std::unique_ptr<Expr>> indices; std::unique_ptr<Expr> value; };
+struct AssignMember : Stmt {
+  std::unique_ptr<Expr> object;
+  std::string member;
+  std::unique_ptr<Expr> value;
+  mutable FieldCache field;
+};
 
 struct Return : Stmt { std::unique_ptr<Expr> value; };
 
@@ -0,0 +1,215 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "value.hpp"
+#include "ast.hpp"
+#include "symbol.hpp"
+
+namespace bas {
+
+// Opcodes for the register VM. Operands are register numbers, constant/name
+// indices or jump targets depending on the opcode (see comments).
+enum class Op : uint8_t {
+  LoadK,      // a=dst, b=const
+  LoadNil,    // a=dst
+  Move,       // a=dst, b=src
+  GetVar,     // a=dst, b=name
+  SetVar,     // a=name, b=src
+  DeclVar,    // a=name
+  GetSlot,    // a=dst, b=slot
+  SetSlot,    // a=slot, b=src
+  DeclSlot,   // a=slot
+  Add, Sub, Mul, Div, IntDiv, Pow, Mod,  // a=dst, b=lhs, c=rhs
+  Eq, Neq, Lt, Lte, Gt, Gte,             // a=dst, b=lhs, c=rhs
+  And, Or, Xor,                          // a=dst, b=lhs, c=rhs (both sides evaluated)
+  Neg, Pos, Not, BitNot,                 // a=dst, b=src
+  // Quickened forms of Add..Gte (same operands). The VM rewrites a generic
+  // op to the form matching the operand types it observes and back on a
+  // miss: Int = two integers, Num = two numbers, at least one a double.
+  AddInt, AddNum, AddStr, SubInt, SubNum, MulInt, MulNum,
+  EqInt, EqNum, NeqInt, NeqNum, LtInt, LtNum, LteInt, LteNum, GtInt, GtNum, GteInt, GteNum,
+  Jmp,        // a=target
+  JmpIfFalse, // a=cond, b=target
+  JmpIfTrue,  // a=cond, b=target
+  JmpIfNotNil,// a=src, b=target
+  Call,       // a=dst, b=callsite, c=first arg register
+  CallStmt,   // b=callsite, c=first arg register
+  CallInPlace,// b=callsite, c=first arg register (first arg is the callsite's target variable)
+  Print,      // a=src
+  PrintC,     // a=src
+  Index,      // a=dst, b=base, c=index
+  GetField,   // a=dst, b=object, c=expr (the MemberAccess node, which caches packed field slots)
+  SetIndex,   // a=variable (store target), b=first index register, c=index count; the value follows the indices
+  SetField,   // a=variable (store target) or kNoStoreTarget for an object in b, c=stmt (the AssignMember node); the value is in b+1
+  NewArray,   // a=dst, b=first element register, c=count
+  ForPrep,    // a=loop (init/limit/step in a..a+2), b=slot, c=exit target
+  ForLoop,    // a=loop, b=slot, c=body target
+  ForLoopInt, // ForLoop for an integer counter, limit and step; ForPrep selects it
+  ForEachNext,// a=loop (collection, position in a, a+1), b=variable (store target), c=exit target
+  Eval,       // a=dst, b=expr (tree-walker fallback)
+  Exec,       // a=stmt (tree-walker fallback)
+  Signal,     // a=signal kind, b=name (raises an unresolved BREAK/CONTINUE/EXIT)
+  Gosub,      // a=target
+  GosubReturn,// pops the GOSUB stack; falls through when it is empty
+  Yield,      // a=src or -1: suspends a coroutine body with that value (no-op outside coroutines)
+  Await,      // a=src: suspends a coroutine body until the awaitable in a is ready (blocks elsewhere)
+  Ret,        // a=src
+  RetNil,
+  Halt,
+  Fail,       // a=message const
+  Nop
+};
+
+// Variables written by SetIndex, SetField and ForEachNext are encoded as a
+// store target: the frame slot, or -1 - the name index for a name without one.
+constexpr int32_t kNoStoreTarget = INT32_MIN;
+
+struct Instr {
+  mutable Op op{Op::Nop};  // mutable so the VM can quicken a const Chunk
+  int32_t a{0}, b{0}, c{0};
+};
+
+// Call site metadata shared by Op::Call, Op::CallStmt and Op::CallInPlace.
+// For CallInPlace, `target` is the variable passed as the first argument;
+// `assign` is set when the result is stored back into it (`x = F(x, ...)`).
+struct CallSite {
+  std::string name;
+  int argc{0};
+  Symbol target{0};
+  bool assign{false};
+  mutable CallCache cache{};
+};
+
+// Enclosing compiled loop, used to route control-flow signals raised by
+// statements that run through the tree-walker fallback.
+struct LoopContext {
+  std::string kind;  // "for", "while", "do", "repeat"
+  int break_target{-1};
+  int continue_target{-1};
+  int parent{-1};
+};
+
+// True when EXIT <target> leaves a loop of the given kind.
+[[nodiscard]] inline bool exit_matches(const std::string& kind, const std::string& target) {
+  if (kind == target) return true;
+  return (kind == "do" && target == "loop") || (kind == "repeat" && target == "until");
+}
+
+// Signal kinds for Op::Signal.
+enum class SignalKind : int32_t { Break, Continue, Exit };
+
+// Variables of one frame resolved to flat slots, indexed by the interned
+// symbol the interpreter's environment keys them on.
+struct FrameLayout {
+  std::vector<std::string> names;  // folded, for messages and enumeration
+  std::vector<Symbol> syms;
+  std::unordered_map<Symbol, int> index;
+  [[nodiscard]] int find(Symbol key) const {
+    if (index.empty()) return -1;
+    auto it = index.find(key);
+    return it == index.end() ? -1 : it->second;
+  }
+  int add(const std::string& name) {
+    Symbol key = intern(name);
+    auto [it, inserted] = index.emplace(key, static_cast<int>(names.size()));
+    if (inserted) {
+      names.push_back(symbol_name(key));
+      syms.push_back(key);
+    }
+    return it->second;
+  }
+};
+
+// A compiled unit: the program's top level or one SUB/FUNCTION body.
+struct Chunk {
+  std::string name;
+  std::vector<Instr> code;
+  std::vector<Value> consts;
+  std::vector<Symbol> names;  // variables accessed by name, and EXIT targets
+  std::vector<CallSite> calls;
+  std::vector<const Expr*> exprs;
+  std::vector<const Stmt*> stmts;
+  std::vector<LoopContext> loops;
+  std::vector<int32_t> loop_at;  // innermost loop context per instruction, -1 outside loops
+  std::vector<int32_t> line_at;  // source line per instruction, 0 when unknown
+  std::unordered_map<std::string, int> labels;  // folded label -> address, for jumps out of Exec statements
+  FrameLayout frame;
+  std::vector<int> param_slots;  // slot per parameter, -1 when bound by name
+  int num_regs{0};
+};
+
+// Lowers an AST into bytecode. Nodes without a native lowering are emitted
+// as Eval/Exec instructions that defer to the tree-walking interpreter.
+// Variables are resolved to frame slots as they are compiled; names listed
+// in a GLOBAL statement anywhere in the unit keep by-name lookup.
+class BytecodeCompiler {
+public:
+  // Compile the program's top level. SUB/FUNCTION bodies are skipped. In
+  // every unit, labels (including line numbers) anywhere in the body become
+  // jump targets for GOTO/GOSUB, resolved when the unit is compiled.
+  [[nodiscard]] std::unique_ptr<Chunk> compile_program(const Program& prog);
+  // Compile a SUB or FUNCTION body. `kind` is "sub" or "function" and lets
+  // EXIT SUB / EXIT FUNCTION lower to a plain return.
+  [[nodiscard]] std::unique_ptr<Chunk> compile_body(const std::string& name, const std::string& kind,
+                                                    const std::vector<std::string>& params,
+                                                    const std::vector<std::unique_ptr<Stmt>>& body);
+private:
+  struct LoopScope { int ctx; std::vector<int> breaks; std::vector<int> continues; };
+
+  Chunk* chunk{nullptr};
+  bool top_level{false};
+  std::string body_kind;
+  int next_reg{0};
+  std::vector<LoopScope> loop_stack;
+  std::unordered_map<std::string, int> labels;
+  std::vector<std::pair<int, std::string>> label_fixups;
+  std::unordered_set<std::string> by_name;  // GLOBAL names, never given a slot
+  bool uses_gosub{false};  // RETURN must first resume a pending GOSUB
+  int loop_state_regs{0};  // registers loops may pin, counted by prescan()
+  int next_loop_reg{0};
+  int line{0};  // source line of the statement being compiled
+
+  int emit(Op op, int32_t a = 0, int32_t b = 0, int32_t c = 0);
+  int here() const { return static_cast<int>(chunk->code.size()); }
+  void patch(int at, int target);
+  int alloc_reg();
+  // `n` registers that hold a loop's state across its body. A GOSUB
+  // subroutine runs in the middle of the body with temporaries of its own,
+  // so in a unit with GOSUB they lie below every temporary.
+  int loop_regs(int n);
+  void free_to(int mark) { next_reg = mark; }
+  int const_index(Value v);
+  int name_index(const std::string& name);
+  int slot_index(const std::string& name);  // -1 when the name must be looked up by name
+  int store_target(const std::string& name);
+  // Records GLOBAL names, whether the unit uses GOSUB and how many
+  // registers its loops keep state in.
+  void prescan(const std::vector<std::unique_ptr<Stmt>>& body);
+  void resolve_labels();
+
+  void compile_block(const std::vector<std::unique_ptr<Stmt>>& body);
+  void compile_stmt(const Stmt* s);
+  void compile_expr(const Expr* e, int dst);
+  void compile_call(const std::string& name, const std::vector<std::unique_ptr<Expr>>& args, int dst, bool stmt);
+  // Calls whose first argument is the variable `target` may update it in
+  // place; returns false when the call has no such shape.
+  bool compile_inplace(const std::string& name, const std::vector<std::unique_ptr<Expr>>& args,
+                       const std::string* target);
+  void compile_fallback(const Stmt* s);
+  void compile_signal(SignalKind kind, const std::string& target);
+
+  int current_loop() const { return loop_stack.empty() ? -1 : loop_stack.back().ctx; }
+  int push_loop(const std::string& kind);
+  // Loop conditions are evaluated outside the loop body, so signals raised
+  // there belong to the enclosing loop: end_loop() detaches the scope before
+  // they are compiled and close_loop() patches its jumps afterwards.
+  LoopScope end_loop();
+  void close_loop(LoopScope scope, int break_target, int continue_target);
+  void finish();
+};
+
+} // namespace bas
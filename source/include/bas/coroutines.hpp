@@ -0,0 +1,52 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include "value.hpp"
+#include "runtime.hpp"
+
+namespace bas {
+
+// ===== Script coroutines =====
+// A coroutine runs a SUB or FUNCTION body that suspends at YIELD and AWAIT
+// statements in that body and later resumes where it left off, with its
+// locals intact. Script handles are maps with _type "coroutine". The
+// scheduler side is implemented by the interpreter.
+
+// Create a suspended coroutine running SUB/FUNCTION `name` with `args`.
+// `scheduled` coroutines are also resumed by coroutine_update().
+[[nodiscard]] Value coroutine_create(const std::string& name, NativeArgs args, bool scheduled);
+// Run the coroutine until it suspends or finishes. Returns the YIELDed value,
+// or the RETURN value once it finishes; nil while its AWAIT is pending.
+Value coroutine_resume(const Value& handle);
+// "suspended", "waiting" (AWAIT pending), "running" or "done".
+[[nodiscard]] std::string coroutine_status(const Value& handle);
+void coroutine_cancel(const Value& handle);
+// Resume every scheduled coroutine that is ready, once each (call per frame).
+// Returns the number of scheduled coroutines still alive.
+size_t coroutine_update();
+
+// ===== Futures =====
+// Completion handle for native work finishing asynchronously (HTTP requests,
+// file loads). `result` is written before `done` is set. Script handles are
+// maps with _type "future" that share ownership of the state, so it lives
+// as long as the script or the worker holds it; AWAIT suspends a coroutine
+// until one completes.
+struct FutureState {
+  std::atomic<bool> done{false};
+  Value result;
+};
+
+[[nodiscard]] Value make_future(std::shared_ptr<FutureState> state);
+[[nodiscard]] std::shared_ptr<FutureState> find_future(const Value& handle);
+void complete_future(FutureState& state, Value result);
+// Run `work` on a worker thread and return a future for its result. `work`
+// must not touch interpreter state.
+[[nodiscard]] Value run_async(std::function<Value()> work);
+
+// COROUTINE_* and FUTURE_* natives
+void register_coroutine_functions(FunctionRegistry& R);
+
+} // namespace bas
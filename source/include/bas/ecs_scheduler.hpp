@@ -0,0 +1,27 @@
+#pragma once
+#include "ecs_system.hpp"
+#include <vector>
+
+namespace bas {
+
+// ===== ECS system scheduler =====
+// Each frame the systems are placed in stages. A system goes one stage
+// after the last earlier system it conflicts with: one writes a component
+// the other reads or writes. A system that has not declared its access
+// conflicts with every other. The systems of a stage run together. Thread
+// safe systems are split into chunks of entities and run on a pool of
+// worker threads. The other systems, which include every system written in
+// BASIC, run on the calling thread, and that thread helps with the chunks
+// when it is done.
+//
+// Structural changes made by systems, creating entities included, are
+// deferred to the end of the frame (see update_systems), so queries stay
+// still while the stages run. A new entity's handle is reserved at once
+// without touching the entity store, so any system, on any thread, may
+// create entities.
+
+// Run one frame of `systems`, given in priority order, over the entities
+// of `sceneId` (-1: every scene)
+void run_system_frame(std::vector<SystemRegistration>& systems, double deltaTime, int sceneId);
+
+} // namespace bas
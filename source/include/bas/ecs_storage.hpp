@@ -0,0 +1,158 @@
+#pragma once
+#include "value.hpp"
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+namespace bas {
+
+// Entity handle: the entity's slot index in the low 32 bits and the slot's
+// generation in the high 32. Destroying an entity advances its slot's
+// generation, so old handles to it go stale and the slot can be reused.
+// Slot 0 is never used, which keeps INVALID_ENTITY distinct from every
+// handle.
+using EntityID = int64_t;
+constexpr EntityID INVALID_ENTITY = 0;
+
+[[nodiscard]] constexpr uint32_t entity_index(EntityID id) {
+    return static_cast<uint32_t>(static_cast<uint64_t>(id));
+}
+[[nodiscard]] constexpr uint32_t entity_generation(EntityID id) {
+    return static_cast<uint32_t>(static_cast<uint64_t>(id) >> 32);
+}
+[[nodiscard]] constexpr EntityID make_entity_id(uint32_t index, uint32_t generation) {
+    return static_cast<EntityID>((static_cast<uint64_t>(generation) << 32) | index);
+}
+
+// ===== Archetype component storage =====
+// Entities with the same set of components share an archetype. Each
+// component of an archetype is a table of columns, one per field of the
+// component type, and row i of every table belongs to the archetype's i-th
+// entity. Fields whose default is a number, integer, boolean or string get a
+// typed column; other fields, and fields that are later given a value of
+// another type, hold boxed Values.
+
+using ComponentTypeID = size_t;
+constexpr size_t MAX_COMPONENT_TYPES = 64;
+using ComponentMask = std::bitset<MAX_COMPONENT_TYPES>;
+
+enum class FieldKind : uint8_t { Number, Int, Bool, String, Boxed };
+
+struct FieldDesc {
+    std::string name;  // as first declared, used for component maps
+    FieldKind kind{FieldKind::Boxed};
+    Value defaultValue;
+};
+
+struct ComponentType {
+    ComponentTypeID id{0};
+    std::string name;  // upper case
+    std::vector<FieldDesc> fields;
+    std::unordered_map<std::string, int> fieldIndex;  // upper-case field name -> column
+
+    // Column of a field (upper-case name), or -1
+    [[nodiscard]] int field(const std::string& upperName) const {
+        auto it = fieldIndex.find(upperName);
+        return it == fieldIndex.end() ? -1 : it->second;
+    }
+};
+
+using Column = std::variant<std::vector<double>, std::vector<long long>, std::vector<uint8_t>,
+                            std::vector<std::string>, std::vector<Value>>;
+
+// Typed data of a column, or nullptr when it holds another kind
+template <typename T>
+[[nodiscard]] T* column_data(Column& column) {
+    auto* v = std::get_if<std::vector<T>>(&column);
+    return v ? v->data() : nullptr;
+}
+
+struct ComponentTable {
+    ComponentTypeID type{0};
+    std::vector<Column> columns;  // indexed like ComponentType::fields
+};
+
+struct Archetype {
+    ComponentMask mask;
+    std::vector<EntityID> entities;
+    std::vector<ComponentTable> tables;  // ordered by type id
+    std::array<int8_t, MAX_COMPONENT_TYPES> tableIndex{};  // type id -> tables index, -1 when absent
+
+    [[nodiscard]] ComponentTable* table(ComponentTypeID type) {
+        int i = tableIndex[type];
+        return i < 0 ? nullptr : &tables[static_cast<size_t>(i)];
+    }
+    [[nodiscard]] const ComponentTable* table(ComponentTypeID type) const {
+        int i = tableIndex[type];
+        return i < 0 ? nullptr : &tables[static_cast<size_t>(i)];
+    }
+};
+
+// Archetype and row holding an entity's components
+struct EntityLocation {
+    uint32_t archetype{0};
+    uint32_t row{0};
+};
+
+struct EntityData;
+
+// Component type of a name (any case), created on first use. Built-in
+// components (TRANSFORM, SPRITE, ...) start with their standard fields.
+ComponentType& ecs_component_type(const std::string& name);
+ComponentType& ecs_component_type(ComponentTypeID id);
+// Existing component type, or nullptr
+ComponentType* ecs_find_component_type(const std::string& name);
+// Declare fields and their defaults; fields already declared take the new
+// default, and rows that already exist get the defaults of new fields.
+ComponentType& ecs_define_component(const std::string& name, const Value::Map& defaults);
+// Column of a field, declared as a boxed field with a NIL default if missing
+int ecs_field_for_write(ComponentType& type, const std::string& name);
+
+// All archetypes; indices stay valid, but the vector grows as new component
+// combinations appear.
+std::vector<Archetype>& ecs_archetypes();
+
+// Place a new entity, without components, in the storage / take it out
+void ecs_attach(EntityData& entity);
+void ecs_detach(EntityData& entity);
+// Move an entity to the archetype with one component more or less. New
+// components start with their defaults. Return false when nothing changed.
+bool ecs_add_component(EntityData& entity, ComponentTypeID type);
+bool ecs_remove_component(EntityData& entity, ComponentTypeID type);
+
+[[nodiscard]] Value ecs_get_field(const EntityData& entity, ComponentTypeID type, int field);
+void ecs_set_field(EntityData& entity, ComponentTypeID type, int field, const Value& value);
+// Set the fields named in `data`; keys starting with '_' are skipped
+void ecs_set_fields(EntityData& entity, ComponentTypeID type, const Value::Map& data);
+// Component as a map: _type, _entityId and every field
+[[nodiscard]] Value::Map ecs_component_map(const EntityData& entity, ComponentTypeID type);
+
+// ===== Cached queries =====
+// A query lists the active entities, of one scene or of all scenes, that
+// have every one of its components. The storage keeps the list current as
+// entities are attached, detached, gain or lose components and are
+// activated or deactivated, so reading a query costs only its matches.
+// Changes made while walking a list may move entities within it.
+
+using QueryID = uint32_t;
+
+struct EntityQuery {
+    ComponentMask required;
+    int sceneId{-1};  // -1: every scene
+    std::vector<EntityID> entities;
+    std::vector<uint32_t> position;  // by entity slot index: index in entities, or UINT32_MAX
+};
+
+// Query for `required` in `sceneId`, created and filled on first use; the
+// same mask and scene always give the same query.
+QueryID ecs_cached_query(const ComponentMask& required, int sceneId = -1);
+// References stay valid as queries are added
+[[nodiscard]] const EntityQuery& ecs_query_data(QueryID id);
+// Change an entity's active flag, entering or leaving queries
+void ecs_set_active(EntityData& entity, bool active);
+
+} // namespace bas
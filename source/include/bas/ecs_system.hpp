@@ -1,7 +1,10 @@
 #pragma once
+#include "ecs_storage.hpp"
 #include "runtime.hpp"
 #include "value.hpp"
+#include <atomic>
 #include <bitset>
+#include <deque>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -10,9 +13,6 @@
 
 namespace bas {
 
-using EntityID = int;
-constexpr EntityID INVALID_ENTITY = 0;
-
 // Component descriptor for registry
 struct ComponentDescriptor {
     std::string name;
@@ -27,32 +27,81 @@ using SystemUpdateFn = std::function<void(EntityID, double)>;
 struct SystemRegistration {
     std::string name;
     std::vector<std::string> requiredComponents;
+    ComponentMask requiredMask;  // of requiredComponents, resolved at registration
+    // Components the update writes; it only reads its other required
+    // components. Without a declaration, a system may touch anything.
+    ComponentMask writeMask;
+    bool accessDeclared{false};
+    bool threadSafe{false};  // updates may run on worker threads
     SystemUpdateFn updateFn;
     int priority{0}; // Lower = higher priority
     bool enabled{true};
 };
 
-struct ComponentStorage {
-    std::unordered_map<EntityID, Value::Map> components;
-};
-
 struct EntityData {
     EntityID id{INVALID_ENTITY};
     std::string name;
     bool active{true};
-    std::bitset<64> componentMask;
-    std::unordered_map<std::string, Value::Map> components;
+    ComponentMask componentMask;
+    EntityLocation location;  // where ecs_storage keeps its components
     int sceneId{0};
     EntityID parent{INVALID_ENTITY};
     std::vector<EntityID> children;
-    int generation{0}; // For safer handles
+    uint32_t generation{0}; // of the entity's slot, part of its handle
+};
+
+// Entities in a slot map. A handle's index picks the slot and the handle is
+// valid while the slot holds an entity under the same generation, so a
+// lookup is an index and a compare. Destroyed slots are reused.
+class EntityStore {
+public:
+    // Entity of a handle, or nullptr when the handle is stale or invalid
+    [[nodiscard]] EntityData* find(EntityID id) {
+        uint32_t index = entity_index(id);
+        if (index == 0 || index >= slots_.size() || slots_[index].id != id) return nullptr;
+        return &slots_[index];
+    }
+    [[nodiscard]] const EntityData* find(EntityID id) const {
+        return const_cast<EntityStore*>(this)->find(id);
+    }
+
+    // New entity, its id set to a fresh handle. References to entities stay
+    // valid as others are created.
+    EntityData& create();
+    // Empty the entity's slot; every handle to it goes stale
+    void destroy(EntityID id);
+
+    // Handle of an entity to be placed later, taken from a free slot or past
+    // the last one without touching the slots. Any number of threads may
+    // reserve at once, as long as none changes the store meanwhile; find()
+    // knows no reserved handle until it is placed.
+    [[nodiscard]] EntityID reserve();
+    // Give the slots taken by reserve() to their handles' entities, which
+    // place() then fills in, one handle at a time
+    void commit_reservations();
+    EntityData& place(EntityID id);
+
+    [[nodiscard]] size_t size() const { return live_; }
+
+    template <typename Fn>
+    void for_each(Fn&& fn) {
+        for (EntityData& entity : slots_) {
+            if (entity.id != INVALID_ENTITY) fn(entity);
+        }
+    }
+
+private:
+    std::deque<EntityData> slots_{1};  // slot 0 stays empty
+    std::vector<uint32_t> free_;
+    size_t live_{0};
+    std::atomic<uint32_t> freeReserved_{0};  // taken from the back of free_, may overshoot it
+    std::atomic<uint32_t> newReserved_{0};   // taken past the last slot
 };
 
 struct SceneData {
     int id{0};
     std::string name;
     std::vector<EntityID> entities;
-    std::unordered_map<std::string, ComponentStorage> componentStorages;
 };
 
 // Component registry
@@ -60,7 +109,7 @@ extern std::unordered_map<std::string, ComponentDescriptor> g_component_registry
 // System registry
 extern std::vector<SystemRegistration> g_systems;
 
-extern std::unordered_map<EntityID, EntityData> g_entities;
+extern EntityStore g_entities;
 extern std::unordered_map<int, SceneData> g_scenes;
 
 // Component registry functions
@@ -70,6 +119,15 @@ ComponentDescriptor* get_component_descriptor(const std::string& name);
 
 // System registration
 void register_system(const std::string& name, const std::vector<std::string>& components, SystemUpdateFn fn, int priority = 0);
+// System that reads `reads`, writes `writes` and touches no other component
+// (see ecs_scheduler.hpp). With `threadSafe`, its updates may run on worker
+// threads, alongside systems it does not conflict with.
+void register_system(const std::string& name, const std::vector<std::string>& reads,
+                     const std::vector<std::string>& writes, SystemUpdateFn fn, int priority = 0,
+                     bool threadSafe = true);
+// Declare that a registered system writes only `writes` of its components;
+// false when there is no system of that name
+bool declare_system_access(const std::string& name, const std::vector<std::string>& writes);
 void unregister_system(const std::string& name);
 void enable_system(const std::string& name, bool enabled);
 
@@ -82,6 +140,27 @@ Value::Array query_entities_with_filter(const std::vector<std::string>& componen
 // Update all systems
 void update_systems(double deltaTime, int sceneId = -1);
 
+// ===== Structural changes =====
+// Creating and destroying entities, adding or removing components and
+// activating or deactivating entities move entities between archetypes and
+// queries. While update_systems runs, these changes are recorded in a
+// command buffer of the calling thread. They are played back, buffer by
+// buffer and in order, after the frame's last system, so the queries stay
+// still while systems walk them. An entity created meanwhile gets a
+// reserved handle at once, which later changes recorded in the frame may
+// use, and enters its slot, scene and the storage at playback. Field writes
+// are not structural and apply at once.
+
+// New active entity of `sceneId`, a child of `parent` if that is set
+EntityID ecs_create_entity(int sceneId, const std::string& name, EntityID parent = INVALID_ENTITY);
+// Destroy an entity and its descendants
+void ecs_destroy_entity(EntityID id);
+// Give an entity a component, starting from its defaults, if it lacks it;
+// then set the fields in `data`
+void add_component(EntityID id, ComponentTypeID type, const Value::Map* data = nullptr);
+void remove_component(EntityID id, ComponentTypeID type);
+void set_entity_active(EntityID id, bool active);
+
 void register_ecs_system(FunctionRegistry& registry);
 
 } // namespace bas
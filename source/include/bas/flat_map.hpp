@@ -0,0 +1,231 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace bas {
+
+// Insertion-ordered map from strings to T, used for Value::Map. Entries are
+// stored in one contiguous vector: maps of up to kSmall entries are searched
+// with a linear scan, larger ones add an open-addressing index (linear
+// probing) holding entry positions. Unlike std::map, inserting or erasing
+// may move entries, invalidating iterators and references into the map.
+// Keys are exact. find_any_case() also matches keys that differ only in
+// ASCII case, as BASIC identifiers do; the index hashes keys folded, so it
+// serves both lookups.
+template <typename T>
+class FlatMap {
+public:
+  using key_type = std::string;
+  using mapped_type = T;
+  using value_type = std::pair<std::string, T>;
+  using size_type = std::size_t;
+  using iterator = typename std::vector<value_type>::iterator;
+  using const_iterator = typename std::vector<value_type>::const_iterator;
+
+  static constexpr size_type kSmall = 8;
+
+  FlatMap() = default;
+  FlatMap(std::initializer_list<value_type> init) { insert(init.begin(), init.end()); }
+  template <typename It>
+  FlatMap(It first, It last) { insert(first, last); }
+
+  [[nodiscard]] iterator begin() noexcept { return entries_.begin(); }
+  [[nodiscard]] iterator end() noexcept { return entries_.end(); }
+  [[nodiscard]] const_iterator begin() const noexcept { return entries_.begin(); }
+  [[nodiscard]] const_iterator end() const noexcept { return entries_.end(); }
+  [[nodiscard]] const_iterator cbegin() const noexcept { return entries_.cbegin(); }
+  [[nodiscard]] const_iterator cend() const noexcept { return entries_.cend(); }
+
+  [[nodiscard]] size_type size() const noexcept { return entries_.size(); }
+  [[nodiscard]] bool empty() const noexcept { return entries_.empty(); }
+  void reserve(size_type n) { entries_.reserve(n); }
+  void clear() noexcept { entries_.clear(); index_.clear(); }
+
+  [[nodiscard]] iterator find(std::string_view key) {
+    std::ptrdiff_t i = locate(key);
+    return i < 0 ? end() : begin() + i;
+  }
+  [[nodiscard]] const_iterator find(std::string_view key) const {
+    std::ptrdiff_t i = locate(key);
+    return i < 0 ? end() : begin() + i;
+  }
+  // Entry of `key`, or else the first entry whose key equals it ignoring
+  // ASCII case. For member access and TYPE fields, not for data keys.
+  [[nodiscard]] iterator find_any_case(std::string_view key) {
+    std::ptrdiff_t i = locate_any_case(key);
+    return i < 0 ? end() : begin() + i;
+  }
+  [[nodiscard]] const_iterator find_any_case(std::string_view key) const {
+    std::ptrdiff_t i = locate_any_case(key);
+    return i < 0 ? end() : begin() + i;
+  }
+  [[nodiscard]] size_type count(std::string_view key) const { return locate(key) < 0 ? 0 : 1; }
+  [[nodiscard]] bool contains(std::string_view key) const { return locate(key) >= 0; }
+
+  [[nodiscard]] T& at(std::string_view key) {
+    std::ptrdiff_t i = locate(key);
+    if (i < 0) throw std::out_of_range("FlatMap::at: no such key");
+    return entries_[static_cast<size_type>(i)].second;
+  }
+  [[nodiscard]] const T& at(std::string_view key) const {
+    std::ptrdiff_t i = locate(key);
+    if (i < 0) throw std::out_of_range("FlatMap::at: no such key");
+    return entries_[static_cast<size_type>(i)].second;
+  }
+
+  // Keys are taken as anything convertible to std::string_view; an rvalue
+  // std::string is moved into a new entry.
+  template <typename K>
+  T& operator[](K&& key) { return try_emplace(std::forward<K>(key)).first->second; }
+
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> try_emplace(K&& key, Args&&... args) {
+    std::ptrdiff_t i = locate(std::string_view(key));
+    if (i >= 0) return {begin() + i, false};
+    entries_.emplace_back(std::piecewise_construct, std::forward_as_tuple(std::forward<K>(key)),
+                          std::forward_as_tuple(std::forward<Args>(args)...));
+    index_added();
+    return {end() - 1, true};
+  }
+  template <typename K, typename V>
+  std::pair<iterator, bool> emplace(K&& key, V&& value) {
+    return try_emplace(std::forward<K>(key), std::forward<V>(value));
+  }
+  template <typename K, typename V>
+  std::pair<iterator, bool> insert_or_assign(K&& key, V&& value) {
+    auto r = try_emplace(std::forward<K>(key), std::forward<V>(value));
+    if (!r.second) r.first->second = std::forward<V>(value);
+    return r;
+  }
+  std::pair<iterator, bool> insert(const value_type& kv) { return try_emplace(kv.first, kv.second); }
+  std::pair<iterator, bool> insert(value_type&& kv) { return try_emplace(std::move(kv.first), std::move(kv.second)); }
+  template <typename It>
+  void insert(It first, It last) {
+    for (; first != last; ++first) try_emplace(first->first, first->second);
+  }
+
+  size_type erase(std::string_view key) {
+    std::ptrdiff_t i = locate(key);
+    if (i < 0) return 0;
+    erase(cbegin() + i);
+    return 1;
+  }
+  iterator erase(const_iterator pos) {
+    auto i = pos - cbegin();
+    entries_.erase(entries_.begin() + i);
+    rebuild_index();
+    return begin() + i;
+  }
+
+  void swap(FlatMap& other) noexcept {
+    entries_.swap(other.entries_);
+    index_.swap(other.index_);
+  }
+
+  // Maps are equal when they hold the same keys with equal values, in any order.
+  bool operator==(const FlatMap& other) const {
+    if (size() != other.size()) return false;
+    for (const auto& [k, v] : entries_) {
+      auto it = other.find(k);
+      if (it == other.end() || !(it->second == v)) return false;
+    }
+    return true;
+  }
+  bool operator!=(const FlatMap& other) const { return !(*this == other); }
+
+private:
+  std::vector<value_type> entries_;
+  // Open-addressing table of entry position + 1 (0 = empty); its size is a
+  // power of two. Empty while the map has at most kSmall entries.
+  std::vector<uint32_t> index_;
+
+  [[nodiscard]] static char fold(char c) noexcept { return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c; }
+
+  // FNV-1a over the folded key
+  [[nodiscard]] static size_t hash(std::string_view key) noexcept {
+    uint64_t h = 14695981039346656037ull;
+    for (char c : key) {
+      h ^= static_cast<unsigned char>(fold(c));
+      h *= 1099511628211ull;
+    }
+    return static_cast<size_t>(h);
+  }
+
+  [[nodiscard]] static bool same_key(std::string_view a, std::string_view b) noexcept {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i)
+      if (fold(a[i]) != fold(b[i])) return false;
+    return true;
+  }
+
+  [[nodiscard]] std::ptrdiff_t locate(std::string_view key) const noexcept {
+    if (index_.empty()) {
+      for (size_type i = 0; i < entries_.size(); ++i)
+        if (entries_[i].first == key) return static_cast<std::ptrdiff_t>(i);
+      return -1;
+    }
+    const size_t mask = index_.size() - 1;
+    for (size_t h = hash(key) & mask;; h = (h + 1) & mask) {
+      uint32_t slot = index_[h];
+      if (slot == 0) return -1;
+      if (entries_[slot - 1].first == key) return static_cast<std::ptrdiff_t>(slot - 1);
+    }
+  }
+
+  // Keys equal ignoring case share a probe chain, so one walk finds the
+  // exact key or the earliest of the others
+  [[nodiscard]] std::ptrdiff_t locate_any_case(std::string_view key) const noexcept {
+    std::ptrdiff_t first = -1;
+    auto consider = [&](size_type i) {
+      if (entries_[i].first == key) return true;
+      if ((first < 0 || static_cast<std::ptrdiff_t>(i) < first) && same_key(entries_[i].first, key))
+        first = static_cast<std::ptrdiff_t>(i);
+      return false;
+    };
+    if (index_.empty()) {
+      for (size_type i = 0; i < entries_.size(); ++i)
+        if (consider(i)) return static_cast<std::ptrdiff_t>(i);
+      return first;
+    }
+    const size_t mask = index_.size() - 1;
+    for (size_t h = hash(key) & mask;; h = (h + 1) & mask) {
+      uint32_t slot = index_[h];
+      if (slot == 0) return first;
+      if (consider(slot - 1)) return static_cast<std::ptrdiff_t>(slot - 1);
+    }
+  }
+
+  void place(size_type pos) noexcept {
+    const size_t mask = index_.size() - 1;
+    size_t h = hash(entries_[pos].first) & mask;
+    while (index_[h] != 0) h = (h + 1) & mask;
+    index_[h] = static_cast<uint32_t>(pos + 1);
+  }
+
+  // Called after appending an entry: keeps the index at most half full.
+  void index_added() {
+    if (entries_.size() <= kSmall) return;
+    if (index_.empty() || entries_.size() * 2 > index_.size()) rebuild_index();
+    else place(entries_.size() - 1);
+  }
+
+  void rebuild_index() {
+    if (entries_.size() <= kSmall) {
+      index_.clear();
+      return;
+    }
+    size_t cap = 32;
+    while (cap < entries_.size() * 2) cap *= 2;
+    index_.assign(cap, 0);
+    for (size_type i = 0; i < entries_.size(); ++i) place(i);
+  }
+};
+
+} // namespace bas
@@ -2,6 +2,7 @@
 
 #include "bas/runtime.hpp"
 #include "bas/value.hpp"
+#include "bas/symbol.hpp"
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -67,8 +68,8 @@ public:
     [[nodiscard]] std::vector<std::string> get_namespaces() const;
 
 private:
-    // Map namespace name -> (method name -> function name)
-    std::unordered_map<std::string, std::unordered_map<std::string, std::string>> namespaces_;
+    // Map namespace symbol -> (method symbol -> function name)
+    std::unordered_map<Symbol, std::unordered_map<Symbol, std::string>> namespaces_;
 };
 
 /**
@@ -7,22 +7,24 @@
 namespace bas {
 
 // Advanced networking function implementations
-Value http_get_impl(const std::vector<Value>& args);
-Value http_post_impl(const std::vector<Value>& args);
-Value download_file_impl(const std::vector<Value>& args);
-Value upload_file_impl(const std::vector<Value>& args);
-Value websocket_connect_impl(const std::vector<Value>& args);
-Value websocket_send_impl(const std::vector<Value>& args);
-Value websocket_receive_impl(const std::vector<Value>& args);
-Value websocket_close_impl(const std::vector<Value>& args);
-Value tcp_connect_impl(const std::vector<Value>& args);
-Value tcp_send_impl(const std::vector<Value>& args);
-Value tcp_receive_impl(const std::vector<Value>& args);
-Value tcp_close_impl(const std::vector<Value>& args);
-Value udp_create_impl(const std::vector<Value>& args);
-Value udp_send_impl(const std::vector<Value>& args);
-Value udp_receive_impl(const std::vector<Value>& args);
-Value udp_close_impl(const std::vector<Value>& args);
+Value http_get_impl(NativeArgs args);
+Value http_post_impl(NativeArgs args);
+Value http_get_async_impl(NativeArgs args);
+Value http_post_async_impl(NativeArgs args);
+Value download_file_impl(NativeArgs args);
+Value upload_file_impl(NativeArgs args);
+Value websocket_connect_impl(NativeArgs args);
+Value websocket_send_impl(NativeArgs args);
+Value websocket_receive_impl(NativeArgs args);
+Value websocket_close_impl(NativeArgs args);
+Value tcp_connect_impl(NativeArgs args);
+Value tcp_send_impl(NativeArgs args);
+Value tcp_receive_impl(NativeArgs args);
+Value tcp_close_impl(NativeArgs args);
+Value udp_create_impl(NativeArgs args);
+Value udp_send_impl(NativeArgs args);
+Value udp_receive_impl(NativeArgs args);
+Value udp_close_impl(NativeArgs args);
 
 } // namespace bas
 
@@ -1,6 +1,8 @@
 #pragma once
 #include "ast.hpp"
 #include "diag.hpp"
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace bas {
@@ -22,6 +24,12 @@ private:
   bool check(Tok k) const { return peek().kind==k; }
   void skipNewlines(){ while(check(Tok::Newline)) advance(); }
   void consume_statement_separators(){ while(peek().kind == Tok::Newline || peek().kind == Tok::Colon) advance(); }
+  // A classic line number: an unsigned integer literal
+  static bool is_line_number(const Token& t){
+    if(t.kind != Tok::Number || t.lex.empty()) return false;
+    for(char c : t.lex) if(c < '0' || c > '9') return false;
+    return true;
+  }
   
   // Helper: Check if we're at ENDIF (single token) or END IF (two tokens)
   bool check_end_if() const {
@@ -136,5 +144,16 @@ private:
   std::unique_ptr<Expr> unary();
   std::unique_ptr<Expr> primary();
   std::unique_ptr<Expr> parse_postfix(std::unique_ptr<Expr> base);
+
+  // Constant folding. Binary/Unary nodes whose operands are literals are
+  // replaced by their value as they are built. Top-level CONSTs declared
+  // once, with a literal value, before any other executable statement are
+  // bound before user code runs; later reads of them fold as literals too.
+  std::unordered_map<std::string, int> const_decls;  // CONST declarations per name
+  std::unordered_map<std::string, Value> known_consts;
+  bool leading_consts{true};
+  std::unique_ptr<Expr> fold(std::unique_ptr<Expr> e);
+  std::unique_ptr<Expr> substitute_const(std::unique_ptr<Expr> e);
+  void note_top_level(const Stmt* s);
 };
 } // namespace bas
@@ -0,0 +1,69 @@
+#pragma once
+#include <atomic>
+#include <string>
+#include <string_view>
+
+namespace bas {
+
+struct NativeFn;
+
+// ===== Sampling profiler =====
+// Started with --profile. A timer thread counts sampling ticks and raises
+// g_profile_due. The interpreter polls the flag between VM instructions and
+// tree-walker statements, and charges the ticks since the previous sample to
+// its current stack of frames. Each SUB/FUNCTION frame is charged at the
+// source line it is executing. Natives called from scripts get a frame of
+// their own and are timed call by call. While the profiler is off, the VM
+// runs its uninstrumented loop and every other hook is a single branch.
+
+// Set only while the profiler runs.
+inline bool g_profiling = false;
+inline std::atomic<bool> g_profile_due{false};
+
+// Start sampling every `interval_us` microseconds.
+void profiler_start(const std::string& folded_path, int interval_us = 1000);
+// Stop sampling and report. Folded stacks go to the path given to
+// profiler_start(), one "frame;frame;... count" line per distinct stack, as
+// read by flamegraph.pl and speedscope. A summary of the render frames and
+// of the hottest functions, lines and natives goes to stderr.
+void profiler_stop();
+
+// ----- Interpreter hooks -----
+
+// Push a SUB/FUNCTION frame, or a native frame when `native` is set. `name`
+// must outlive the frame.
+void profile_enter(std::string_view name, const NativeFn* native = nullptr);
+void profile_leave();
+// Source line of the innermost frame. The reference stays valid until that
+// frame is left, so the VM updates it without a call per instruction.
+[[nodiscard]] int& profile_line();
+// Charge the ticks counted since the last sample to the current stack.
+void profile_sample();
+// End the current render frame, recording its time and samples. Returning
+// from ENDDRAWING, SYNC, GAMELOOPEND, GAME_ENDFRAME or PROFILE_FRAME (for
+// scripts without a window) does this.
+void profile_frame();
+
+// Poll point of the tree-walker: `line` is the statement about to run.
+inline void profile_statement(int line) {
+  if (line > 0) profile_line() = line;
+  if (g_profile_due.load(std::memory_order_relaxed)) profile_sample();
+}
+
+// Frame for the extent of a call; does nothing while the profiler is off.
+class ProfileScope {
+public:
+  explicit ProfileScope(std::string_view name, const NativeFn* native = nullptr) : active_(g_profiling) {
+    if (active_) profile_enter(name, native);
+  }
+  ~ProfileScope() {
+    if (active_) profile_leave();
+  }
+  ProfileScope(const ProfileScope&) = delete;
+  ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+  bool active_;
+};
+
+} // namespace bas
@@ -0,0 +1,42 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "ast.hpp"
+
+namespace bas {
+
+// ===== Compiled program cache (.bbc) =====
+// A .bbc file stores a parsed program with its IMPORTs expanded, together
+// with the content hash of every source file it was built from. Loading one
+// memory-maps it and rebuilds the AST without lexing or parsing; a cache
+// whose sources changed, or that was written by a different format version,
+// is ignored.
+
+// Source file a cache was built from. `path` is relative to the directory of
+// the cache file, so a precompiled project can be moved as a whole.
+struct CacheSource {
+  std::string path;
+  uint64_t hash{0};
+};
+
+// 64-bit FNV-1a hash of a file's contents.
+[[nodiscard]] uint64_t content_hash(std::string_view bytes);
+
+// Cache file for a program: `game.bas` -> `game.bbc`.
+[[nodiscard]] std::filesystem::path program_cache_path(const std::filesystem::path& source);
+
+// Write `prog`, built from `sources` (main file first), to `file`. Returns
+// false, with `error` set, when the file cannot be written.
+bool write_program_cache(const std::filesystem::path& file, const Program& prog,
+                         const std::vector<CacheSource>& sources, std::string* error = nullptr);
+
+// Program stored in `file`, or nullopt when there is no usable cache: the
+// file is missing or damaged, has another format version, or one of its
+// sources no longer matches the recorded hash.
+[[nodiscard]] std::optional<Program> load_program_cache(const std::filesystem::path& file);
+
+} // namespace bas
@@ -28,8 +28,15 @@ inline ::Rectangle Map_to_Rectangle(const Value::Map& m) {
     return r;
 }
 
+// Rectangle <-> packed Value (the representation RECTANGLE() creates)
+inline Value Rectangle_to_Value(::Rectangle r) {
+    return Value::from_packed(Packed::rectangle(r.x, r.y, r.width, r.height));
+}
+
 inline ::Rectangle Value_to_Rectangle(const Value& val) {
-    if (!val.is_map()) throw std::runtime_error("Expected a map for Rectangle");
+    if (const Packed* p = val.packed(); p && p->kind == Packed::Kind::Rectangle)
+        return { p->f[0], p->f[1], p->f[2], p->f[3] };
+    if (!val.is_map()) throw std::runtime_error("Expected a Rectangle");
     return Map_to_Rectangle(val.as_map());
 }
 
@@ -50,8 +57,15 @@ inline ::Color Map_to_Color(const Value::Map& m) {
     return c;
 }
 
+// Color <-> packed Value (the representation COLOR() creates)
+inline Value Color_to_Value(::Color c) {
+    return Value::from_packed(Packed::color(c.r, c.g, c.b, c.a));
+}
+
 inline ::Color Value_to_Color(const Value& val) {
-    if (!val.is_map()) throw std::runtime_error("Expected a map for Color");
+    if (const Packed* p = val.packed(); p && p->kind == Packed::Kind::Color)
+        return { (unsigned char)p->f[0], (unsigned char)p->f[1], (unsigned char)p->f[2], (unsigned char)p->f[3] };
+    if (!val.is_map()) throw std::runtime_error("Expected a Color");
     return Map_to_Color(val.as_map());
 }
 
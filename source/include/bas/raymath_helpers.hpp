@@ -21,8 +21,16 @@ inline ::Vector2 Map_to_Vector2(const Value::Map& m) {
     return v;
 }
 
+// Vector2 <-> packed Value (the representation VECTOR2() creates)
+inline Value Vector2_to_Value(::Vector2 v) {
+    return Value::from_packed(Packed::vector2(v.x, v.y));
+}
+
+// Accepts a packed Vector2 or Vector3 (x and y are read), or a map.
 inline ::Vector2 Value_to_Vector2(const Value& val) {
-    if (!val.is_map()) throw std::runtime_error("Expected a map for Vector2");
+    if (const Packed* p = val.packed(); p && (p->kind == Packed::Kind::Vector2 || p->kind == Packed::Kind::Vector3))
+        return { p->f[0], p->f[1] };
+    if (!val.is_map()) throw std::runtime_error("Expected a Vector2");
     return Map_to_Vector2(val.as_map());
 }
 
@@ -39,8 +47,16 @@ inline ::Vector3 Map_to_Vector3(const Value::Map& m) {
     return v;
 }
 
+// Vector3 <-> packed Value (the representation VECTOR3() creates)
+inline Value Vector3_to_Value(::Vector3 v) {
+    return Value::from_packed(Packed::vector3(v.x, v.y, v.z));
+}
+
+// Accepts a packed Vector3 or Vector2 (z reads as 0), or a map.
 inline ::Vector3 Value_to_Vector3(const Value& val) {
-    if (!val.is_map()) throw std::runtime_error("Expected a map for Vector3");
+    if (const Packed* p = val.packed(); p && (p->kind == Packed::Kind::Vector3 || p->kind == Packed::Kind::Vector2))
+        return { p->f[0], p->f[1], p->f[2] };
+    if (!val.is_map()) throw std::runtime_error("Expected a Vector3");
     return Map_to_Vector3(val.as_map());
 }
 
@@ -108,8 +124,8 @@ inline ::Matrix Value_to_Matrix(const Value& val) {
 // Camera2D <-> Value::Map
 inline Value::Map Camera2D_to_Map(::Camera2D cam) {
     Value::Map result;
-    result["offset"] = Value::from_map(Vector2_to_Map(cam.offset));
-    result["target"] = Value::from_map(Vector2_to_Map(cam.target));
+    result["offset"] = Vector2_to_Value(cam.offset);
+    result["target"] = Vector2_to_Value(cam.target);
     result["rotation"] = Value::from_number(cam.rotation);
     result["zoom"] = Value::from_number(cam.zoom);
     return result;
@@ -117,8 +133,8 @@ inline Value::Map Camera2D_to_Map(::Camera2D cam) {
 
 inline ::Camera2D Map_to_Camera2D(const Value::Map& m) {
     ::Camera2D cam = { {0, 0}, {0, 0}, 0.0f, 1.0f };
-    if (auto it = m.find("offset"); it != m.end()) cam.offset = Map_to_Vector2(it->second.as_map());
-    if (auto it = m.find("target"); it != m.end()) cam.target = Map_to_Vector2(it->second.as_map());
+    if (auto it = m.find("offset"); it != m.end()) cam.offset = Value_to_Vector2(it->second);
+    if (auto it = m.find("target"); it != m.end()) cam.target = Value_to_Vector2(it->second);
     if (auto it = m.find("rotation"); it != m.end()) cam.rotation = (float)it->second.as_number();
     if (auto it = m.find("zoom"); it != m.end()) cam.zoom = (float)it->second.as_number();
     return cam;
@@ -132,9 +148,9 @@ inline ::Camera2D Value_to_Camera2D(const Value& val) {
 // Camera3D <-> Value::Map
 inline Value::Map Camera3D_to_Map(::Camera3D cam) {
     Value::Map result;
-    result["position"] = Value::from_map(Vector3_to_Map(cam.position));
-    result["target"] = Value::from_map(Vector3_to_Map(cam.target));
-    result["up"] = Value::from_map(Vector3_to_Map(cam.up));
+    result["position"] = Vector3_to_Value(cam.position);
+    result["target"] = Vector3_to_Value(cam.target);
+    result["up"] = Vector3_to_Value(cam.up);
     result["fovy"] = Value::from_number(cam.fovy);
     result["projection"] = Value::from_int(cam.projection);
     return result;
@@ -142,9 +158,9 @@ inline Value::Map Camera3D_to_Map(::Camera3D cam) {
 
 inline ::Camera3D Map_to_Camera3D(const Value::Map& m) {
     ::Camera3D cam = { {0, 0, 0}, {0, 0, 0}, {0, 1, 0}, 60.0f, ::CAMERA_PERSPECTIVE };
-    if (auto it = m.find("position"); it != m.end()) cam.position = Map_to_Vector3(it->second.as_map());
-    if (auto it = m.find("target"); it != m.end()) cam.target = Map_to_Vector3(it->second.as_map());
-    if (auto it = m.find("up"); it != m.end()) cam.up = Map_to_Vector3(it->second.as_map());
+    if (auto it = m.find("position"); it != m.end()) cam.position = Value_to_Vector3(it->second);
+    if (auto it = m.find("target"); it != m.end()) cam.target = Value_to_Vector3(it->second);
+    if (auto it = m.find("up"); it != m.end()) cam.up = Value_to_Vector3(it->second);
     if (auto it = m.find("fovy"); it != m.end()) cam.fovy = (float)it->second.as_number();
     if (auto it = m.find("projection"); it != m.end()) cam.projection = (int)it->second.as_int();
     return cam;
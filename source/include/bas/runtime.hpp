@@ -1,13 +1,17 @@
 #pragma once
 #include <functional>
 #include <optional>
+#include <span>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 #include <cctype>
+#include <cstdint>
 // Include these BEFORE opening namespace bas to avoid nested namespace issues
 #include "value.hpp"
 #include "ast.hpp"
+#include "symbol.hpp"
 
 namespace bas {
 
@@ -22,59 +26,87 @@ inline std::string normalize_identifier(const std::string& s) {
   return r;
 }
 
+// Arguments of a native call: a view over interpreter-owned storage (VM
+// registers or the interpreter's argument stack), valid for the call only.
+using NativeArgs = std::span<const Value>;
+
 // Native function entry for the runtime registry.
 struct NativeFn {
   std::string name; 
-  int arity; 
-  std::function<Value(const std::vector<Value>&)> fn;
+  int arity{0}; 
+  std::function<Value(NativeArgs)> fn;
+  // Optional in-place form used for `x = NAME(x, ...)` and the statement
+  // `NAME x, ...`: updates `target` (the first argument) by reference to the
+  // value `fn` would return. `rest` holds the remaining arguments.
+  std::function<void(Value& target, NativeArgs rest)> inplace{};
+
+  NativeFn() = default;
+  // Callables taking NativeArgs are stored as-is. Older ones written against
+  // `const std::vector<Value>&` are adapted, at the cost of copying the
+  // arguments into a vector on every call.
+  template <typename F>
+  NativeFn(std::string n, int a, F f) : name(std::move(n)), arity(a), fn(adapt(std::move(f))) {}
   
-  [[nodiscard]] Value operator()(const std::vector<Value>& args) const { 
+  [[nodiscard]] Value operator()(NativeArgs args) const { 
     return fn(args); 
   }
+
+private:
+  template <typename F>
+  static std::function<Value(NativeArgs)> adapt(F f) {
+    if constexpr (std::is_invocable_v<F&, NativeArgs>) {
+      return f;
+    } else {
+      return [f = std::move(f)](NativeArgs args) { return f(std::vector<Value>(args.begin(), args.end())); };
+    }
+  }
 };
 
 // Registry for native functions callable from BASIC.
 class FunctionRegistry {
 public:
   void add(const std::string& name, const NativeFn& fn){
-    std::string normalized_name;
-    normalized_name.reserve(name.size());
-    for (char c : name) normalized_name += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    const Symbol key = intern(name);
     // Duplicate detection: do not allow silent overwrite of existing functions
-    if (fns.find(normalized_name) != fns.end()) {
-      throw std::runtime_error(std::string("Duplicate native function registration: ") + normalized_name);
+    if (fns.find(key) != fns.end()) {
+      throw std::runtime_error(std::string("Duplicate native function registration: ") + symbol_name(key));
     }
-    fns[normalized_name] = fn;
+    fns[key] = fn;
+    ++version_;
   }
   
   // Add with collision policy for generated bindings
   void add_with_policy(const std::string& name, const NativeFn& fn, bool allow_override = false){
-    std::string normalized_name;
-    normalized_name.reserve(name.size());
-    for (char c : name) normalized_name += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
-    if (fns.find(normalized_name) != fns.end()) {
+    const Symbol key = intern(name);
+    if (fns.find(key) != fns.end()) {
       if (!allow_override) {
-        throw std::runtime_error(std::string("Duplicate native function registration: ") + normalized_name);
+        throw std::runtime_error(std::string("Duplicate native function registration: ") + symbol_name(key));
       }
       // Log override in debug builds
       #ifdef DEBUG
-      std::cerr << "Warning: Overriding function " << normalized_name << std::endl;
+      std::cerr << "Warning: Overriding function " << symbol_name(key) << std::endl;
       #endif
     }
-    fns[normalized_name] = fn;
+    fns[key] = fn;
+    ++version_;
   }
   
+  // Lookup is case-insensitive; a name that was never interned cannot have
+  // been registered.
   [[nodiscard]] const NativeFn* find(const std::string& name) const {
-    std::string normalized_name;
-    normalized_name.reserve(name.size());
-    for (char c : name) normalized_name += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
-    auto it=fns.find(normalized_name); 
+    return find(find_symbol(name));
+  }
+  [[nodiscard]] const NativeFn* find(Symbol key) const {
+    auto it=fns.find(key); 
     return it==fns.end() ? nullptr : &it->second;
   }
   
   [[nodiscard]] size_t size() const noexcept { return fns.size(); }
+  // Bumped on every registration; lets callers cache find() results.
+  [[nodiscard]] uint64_t version() const noexcept { return version_; }
 private:
-  std::unordered_map<std::string, NativeFn> fns;
+  std::unordered_map<Symbol, NativeFn> fns;
+  uint64_t version_{0};
 };
 
 void register_builtins(FunctionRegistry&);
@@ -105,6 +137,13 @@ void register_advanced_features(FunctionRegistry&);
 
 // Call a native function by name with arguments.
 [[nodiscard]] Value call(FunctionRegistry&, const std::string& name, const std::vector<Value>&);
+// Call an already resolved native; `fn` may be null (reported as unknown `name`).
+[[nodiscard]] Value call_native(const NativeFn* fn, const std::string& name, NativeArgs args);
+
+// Callback argument of a native: a function value, or the name of a SUB,
+// FUNCTION or native of the running program, resolved here once so the
+// native can keep the handle and call it directly. Null when `fn` is neither.
+[[nodiscard]] std::shared_ptr<const Callable> to_callable(const Value& fn);
 
 // Interpret a parsed program. Returns 0 on success, non-zero on runtime error.
 [[nodiscard]] int interpret(const Program&, FunctionRegistry&, bool debug_mode);
@@ -113,6 +152,9 @@ void register_advanced_features(FunctionRegistry&);
 class NamespaceRegistry;
 void set_namespace_registry(NamespaceRegistry* registry);
 
+// Select the execution engine: bytecode VM (default) or the AST tree-walker
+void set_bytecode_enabled(bool enabled);
+
 // Runtime YAML module loader for dynamic module loading
 class YamlModuleLoader;
 class NativeFunctionRegistry;
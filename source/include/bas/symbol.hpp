@@ -0,0 +1,41 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace bas {
+
+// Interned identifier. Names are folded to lowercase once, when interned, so
+// two names that differ only in case share a symbol and case-insensitive
+// comparison is an integer compare. Symbol 0 is the empty name.
+using Symbol = uint32_t;
+
+// Symbol for `name`, folding it to lowercase and interning it on first use.
+[[nodiscard]] Symbol intern(std::string_view name);
+
+// Symbol for `name` if it has been interned, otherwise 0. Never adds a name.
+[[nodiscard]] Symbol find_symbol(std::string_view name);
+
+// Folded name of an interned symbol. The reference stays valid for the life
+// of the program.
+[[nodiscard]] const std::string& symbol_name(Symbol s);
+
+// True when `name` has no uppercase ASCII letters, i.e. is already folded.
+[[nodiscard]] inline bool is_folded(std::string_view name) noexcept {
+  for (char c : name) if (c >= 'A' && c <= 'Z') return false;
+  return true;
+}
+
+// Case-insensitive (ASCII) equality that does not allocate.
+[[nodiscard]] inline bool iequals(std::string_view a, std::string_view b) noexcept {
+  if (a.size() != b.size()) return false;
+  for (size_t i = 0; i < a.size(); ++i) {
+    char x = a[i], y = b[i];
+    if (x >= 'A' && x <= 'Z') x = static_cast<char>(x - 'A' + 'a');
+    if (y >= 'A' && y <= 'Z') y = static_cast<char>(y - 'A' + 'a');
+    if (x != y) return false;
+  }
+  return true;
+}
+
+} // namespace bas
@@ -1,5 +1,6 @@
 #pragma once
 #include <string>
+#include "symbol.hpp"
 
 namespace bas {
 
@@ -42,12 +43,14 @@ enum class Tok {
   Nil, None, Null, Void, End, Await, Coroutine
 };
 
-// Token with lexeme and position.
+// Token with lexeme and position. Identifiers and keywords carry the
+// interned symbol of their (folded) lexeme.
 struct Token {
   Tok kind{};
   ::std::string lex;
   int line{1};
   int col{1};
+  Symbol sym{0};
 };
 
 } // namespace bas
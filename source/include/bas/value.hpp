@@ -3,22 +3,105 @@
 #include <string>
 #include <stdexcept>
 #include <vector>
-#include <map>
+#include <memory>
+#include <span>
+#include <climits>
+#include <cstdint>
+#include <string_view>
+#include "flat_map.hpp"
 
 namespace bas {
-// Dynamically-typed value used by the interpreter.
+// Shared, reference-counted storage with copy-on-write. Copying a Cow is
+// O(1); the first mutable access through a shared handle clones the payload.
+template <typename T>
+class Cow {
+public:
+  Cow() : p_(std::make_shared<T>()) {}
+  explicit Cow(T v) : p_(std::make_shared<T>(std::move(v))) {}
+  [[nodiscard]] const T& get() const noexcept { return *p_; }
+  [[nodiscard]] T& mut() {
+    if (p_.use_count() > 1) p_ = std::make_shared<T>(*p_);
+    return *p_;
+  }
+  [[nodiscard]] bool shares_with(const Cow& other) const noexcept { return p_ == other.p_; }
+private:
+  std::shared_ptr<T> p_;
+};
+
+// Small fixed-layout value types (Vector2, Vector3, Color, Rectangle) held
+// inline in a Value, so creating or copying one never allocates. Fields are
+// floats, laid out as in the matching raylib struct.
+struct Packed {
+  enum class Kind : uint8_t { Vector2, Vector3, Color, Rectangle };
+  Kind kind{Kind::Vector2};
+  float f[4]{};
+
+  [[nodiscard]] static Packed vector2(float x, float y) noexcept { return {Kind::Vector2, {x, y, 0.0f, 0.0f}}; }
+  [[nodiscard]] static Packed vector3(float x, float y, float z) noexcept { return {Kind::Vector3, {x, y, z, 0.0f}}; }
+  [[nodiscard]] static Packed color(float r, float g, float b, float a) noexcept { return {Kind::Color, {r, g, b, a}}; }
+  [[nodiscard]] static Packed rectangle(float x, float y, float w, float h) noexcept { return {Kind::Rectangle, {x, y, w, h}}; }
+
+  bool operator==(const Packed&) const = default;
+};
+
+// Type name of a packed value, folded like identifiers ("vector3"); method
+// lookup resolves `v.m` to the native `<type>_<m>`.
+[[nodiscard]] inline const char* packed_type_name(Packed::Kind k) noexcept {
+  switch (k) {
+    case Packed::Kind::Vector2: return "vector2";
+    case Packed::Kind::Vector3: return "vector3";
+    case Packed::Kind::Color: return "color";
+    case Packed::Kind::Rectangle: return "rectangle";
+  }
+  return "";
+}
+
+// Index of the field named `name` (folded to lowercase) in a packed value of
+// kind `k`, or -1 when it has no such field.
+[[nodiscard]] inline int packed_field(Packed::Kind k, std::string_view name) noexcept {
+  static constexpr std::string_view vec[] = {"x", "y", "z"};
+  static constexpr std::string_view rgba[] = {"r", "g", "b", "a"};
+  static constexpr std::string_view rect[] = {"x", "y", "width", "height"};
+  const std::string_view* names = vec;
+  int n = 0;
+  switch (k) {
+    case Packed::Kind::Vector2: n = 2; break;
+    case Packed::Kind::Vector3: n = 3; break;
+    case Packed::Kind::Color: names = rgba; n = 4; break;
+    case Packed::Kind::Rectangle: names = rect; n = 4; break;
+  }
+  for (int i = 0; i < n; ++i) if (names[i] == name) return i;
+  return -1;
+}
+
+struct Value;
+
+// First-class function value: a LAMBDA closure, or a SUB, FUNCTION or native
+// resolved by name. Natives that keep a callback hold one and call it
+// directly, without looking the name up again. Implemented by the interpreter.
+struct Callable {
+  virtual ~Callable() = default;
+  virtual Value call(std::span<const Value> args) const = 0;
+};
+
+// Dynamically-typed value used by the interpreter. Arrays and maps are held
+// behind Cow handles, so copying a Value never copies container contents;
+// the const accessors read shared storage and the non-const ones detach it.
 struct Value {
   using Array = std::vector<Value>;
-  using Map = std::map<std::string, Value>;
-  using V = std::variant<std::monostate, double, long long, bool, std::string, Array, Map>;
+  using Map = FlatMap<Value>;  // insertion-ordered
+  using V = std::variant<std::monostate, double, long long, bool, std::string, Cow<Array>, Cow<Map>, Packed,
+                         std::shared_ptr<const Callable>>;
   V v;
   [[nodiscard]] static Value nil() noexcept { return Value{std::monostate{}}; }
   [[nodiscard]] static Value from_number(double d) noexcept { return Value{d}; }
   [[nodiscard]] static Value from_int(long long i) noexcept { return Value{i}; }
   [[nodiscard]] static Value from_bool(bool b) noexcept { return Value{b}; }
   [[nodiscard]] static Value from_string(std::string s) { return Value{std::move(s)}; }
-  [[nodiscard]] static Value from_array(Array a) { return Value{std::move(a)}; }
-  [[nodiscard]] static Value from_map(Map m) { return Value{std::move(m)}; }
+  [[nodiscard]] static Value from_array(Array a) { return Value{Cow<Array>(std::move(a))}; }
+  [[nodiscard]] static Value from_map(Map m) { return Value{Cow<Map>(std::move(m))}; }
+  [[nodiscard]] static Value from_packed(Packed p) noexcept { return Value{p}; }
+  [[nodiscard]] static Value from_callable(std::shared_ptr<const Callable> f) noexcept { return Value{std::move(f)}; }
 
   [[nodiscard]] constexpr bool is_nil() const noexcept { return std::holds_alternative<std::monostate>(v); }
   [[nodiscard]] constexpr bool is_string() const noexcept { return std::holds_alternative<std::string>(v); }
@@ -50,35 +133,57 @@ struct Value {
     if (auto s=std::get_if<std::string>(&v)) return *s;
     throw std::runtime_error("Expected string");
   }
-  [[nodiscard]] constexpr bool is_array() const noexcept { return std::holds_alternative<Array>(v); }
+  [[nodiscard]] constexpr bool is_array() const noexcept { return std::holds_alternative<Cow<Array>>(v); }
   [[nodiscard]] const Array& as_array() const {
-    if (auto a=std::get_if<Array>(&v)) return *a;
+    if (auto a=std::get_if<Cow<Array>>(&v)) return a->get();
     throw std::runtime_error("Expected array");
   }
   [[nodiscard]] Array& as_array() {
-    if (auto a=std::get_if<Array>(&v)) return *a;
+    if (auto a=std::get_if<Cow<Array>>(&v)) return a->mut();
     throw std::runtime_error("Expected array");
   }
-  [[nodiscard]] constexpr bool is_map() const noexcept { return std::holds_alternative<Map>(v); }
+  [[nodiscard]] constexpr bool is_map() const noexcept { return std::holds_alternative<Cow<Map>>(v); }
   [[nodiscard]] const Map& as_map() const {
-    if (auto m=std::get_if<Map>(&v)) return *m;
+    if (auto m=std::get_if<Cow<Map>>(&v)) return m->get();
     throw std::runtime_error("Expected map");
   }
   [[nodiscard]] Map& as_map() {
-    if (auto m=std::get_if<Map>(&v)) return *m;
+    if (auto m=std::get_if<Cow<Map>>(&v)) return m->mut();
     throw std::runtime_error("Expected map");
   }
   
+  [[nodiscard]] constexpr bool is_packed() const noexcept { return std::holds_alternative<Packed>(v); }
+  [[nodiscard]] const Packed* packed() const noexcept { return std::get_if<Packed>(&v); }
+  [[nodiscard]] Packed* packed() noexcept { return std::get_if<Packed>(&v); }
+
+  [[nodiscard]] constexpr bool is_callable() const noexcept { return std::holds_alternative<std::shared_ptr<const Callable>>(v); }
+  // The function held, or null when this is not a function value
+  [[nodiscard]] std::shared_ptr<const Callable> as_callable() const {
+    if (auto f=std::get_if<std::shared_ptr<const Callable>>(&v)) return *f;
+    return nullptr;
+  }
+  
   // Comparison operators for Value
+  // Integers and doubles compare by numeric value.
   bool operator==(const Value& other) const {
+    if (is_number() && other.is_number()) {
+      if (is_int() && other.is_int()) return as_int() == other.as_int();
+      return as_number() == other.as_number();
+    }
     if (v.index() != other.v.index()) return false;
     if (is_nil()) return true;
     if (is_bool()) return as_bool() == other.as_bool();
-    if (is_int()) return as_int() == other.as_int();
-    if (is_number()) return as_number() == other.as_number();
     if (is_string()) return as_string() == other.as_string();
-    if (is_array()) return as_array() == other.as_array();
-    if (is_map()) return as_map() == other.as_map();
+    if (is_array()) {
+      const auto& a = std::get<Cow<Array>>(v);
+      return a.shares_with(std::get<Cow<Array>>(other.v)) || a.get() == other.as_array();
+    }
+    if (is_map()) {
+      const auto& m = std::get<Cow<Map>>(v);
+      return m.shares_with(std::get<Cow<Map>>(other.v)) || m.get() == other.as_map();
+    }
+    if (is_packed()) return *packed() == *other.packed();
+    if (is_callable()) return as_callable() == other.as_callable();  // same function object
     return false;
   }
   
@@ -86,4 +191,40 @@ struct Value {
     return !(*this == other);
   }
 };
+
+// Integer +, - and * yield integers; a result that does not fit in 64 bits
+// falls back to the double computation.
+[[nodiscard]] inline Value int_add(long long a, long long b) noexcept {
+  long long r;
+#if defined(__GNUC__) || defined(__clang__)
+  if (__builtin_add_overflow(a, b, &r)) return Value::from_number(static_cast<double>(a) + static_cast<double>(b));
+#else
+  if ((b > 0 && a > LLONG_MAX - b) || (b < 0 && a < LLONG_MIN - b))
+    return Value::from_number(static_cast<double>(a) + static_cast<double>(b));
+  r = a + b;
+#endif
+  return Value::from_int(r);
+}
+[[nodiscard]] inline Value int_sub(long long a, long long b) noexcept {
+  long long r;
+#if defined(__GNUC__) || defined(__clang__)
+  if (__builtin_sub_overflow(a, b, &r)) return Value::from_number(static_cast<double>(a) - static_cast<double>(b));
+#else
+  if ((b < 0 && a > LLONG_MAX + b) || (b > 0 && a < LLONG_MIN + b))
+    return Value::from_number(static_cast<double>(a) - static_cast<double>(b));
+  r = a - b;
+#endif
+  return Value::from_int(r);
+}
+[[nodiscard]] inline Value int_mul(long long a, long long b) noexcept {
+  long long r;
+#if defined(__GNUC__) || defined(__clang__)
+  if (__builtin_mul_overflow(a, b, &r)) return Value::from_number(static_cast<double>(a) * static_cast<double>(b));
+#else
+  double d = static_cast<double>(a) * static_cast<double>(b);
+  if (d >= 9.2e18 || d <= -9.2e18) return Value::from_number(d);
+  r = a * b;
+#endif
+  return Value::from_int(r);
+}
 } // namespace bas
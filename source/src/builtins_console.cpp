@@ -20,7 +20,7 @@ static void print_value(const Value& v) {
 
 void register_builtins_console(FunctionRegistry& R) {
     // PRINT ...
-    R.add("PRINT", NativeFn{"PRINT", -1, [](const std::vector<Value>& a){
+    R.add("PRINT", NativeFn{"PRINT", -1, [](NativeArgs a){
         for (size_t i = 0; i < a.size(); ++i) {
             print_value(a[i]);
             if (i < a.size() - 1) {
@@ -31,7 +31,7 @@ void register_builtins_console(FunctionRegistry& R) {
         return Value::nil();
     }});
     // PRINTC (print without newline)
-    R.add("PRINTC", NativeFn{"PRINTC", -1, [](const std::vector<Value>& a){
+    R.add("PRINTC", NativeFn{"PRINTC", -1, [](NativeArgs a){
         for (size_t i = 0; i < a.size(); ++i) {
             print_value(a[i]);
             if (i < a.size() - 1) {
@@ -42,14 +42,14 @@ void register_builtins_console(FunctionRegistry& R) {
         return Value::nil();
     }});
   // SETCURSORVISIBLE(flag)
-  R.add("SETCURSORVISIBLE", NativeFn{"SETCURSORVISIBLE", 1, [](const std::vector<Value>& a){
+  R.add("SETCURSORVISIBLE", NativeFn{"SETCURSORVISIBLE", 1, [](NativeArgs a){
     bool show = a[0].as_bool();
     if(show) std::cout << "\x1b[?25h"; else std::cout << "\x1b[?25l";
     return Value::nil();
   }});
 
   // INK(r,g,b): set ANSI color (best-effort). Values 0-255, mapped to 38;2;r;g;bm
-  R.add("INK", NativeFn{"INK", 3, [](const std::vector<Value>& a){
+  R.add("INK", NativeFn{"INK", 3, [](NativeArgs a){
     int r = static_cast<int>((int)a[0].as_int()); int g=static_cast<int>((int)a[1].as_int()); int b=static_cast<int>((int)a[2].as_int());
     if(r<0) { r=0; } if(r>255) { r=255; }
     if(g<0) { g=0; } if(g>255) { g=255; }
@@ -1,5 +1,6 @@
 #include "bas/builtins.hpp"
 #include "bas/input.hpp"
+#include "bas/coroutines.hpp"
 #include <iostream>
 #include <random>
 #include <chrono>
@@ -13,6 +14,7 @@
 #include <cstdlib>
 #include <filesystem>
 #include <map>
+#include <utility>
 #ifdef _WIN32
 #include <direct.h>
 #include <io.h>
@@ -31,6 +33,28 @@ static std::string to_string_value(const Value& v){
   return std::string{};
 }
 
+// Whole contents of a file, or "" when it cannot be opened. Touches no
+// interpreter state, so it may run on a worker thread.
+static Value read_file(const std::string& path){
+  std::ifstream f(path, std::ios::binary);
+  if(!f.is_open()) return Value::from_string("");
+  std::ostringstream ss; ss << f.rdbuf();
+  return Value::from_string(ss.str());
+}
+
+// Registers an array builtin given its in-place form. The value-returning form
+// applies the same operation to a copy of the first argument.
+using ArrayOp = void (*)(Value&, NativeArgs);
+static void add_array_op(FunctionRegistry& R, const char* name, int arity, ArrayOp op){
+  NativeFn f{name, arity, [op](NativeArgs a){
+    Value copy = a[0];
+    op(copy, a.subspan(1));
+    return copy;
+  }};
+  f.inplace = op;
+  R.add(name, f);
+}
+
 // Forward declarations for category registrars implemented in other compilation units
 void register_builtins_console(FunctionRegistry&);
 void register_builtins_graphics(FunctionRegistry&);
@@ -42,7 +66,7 @@ void bas::register_builtins(FunctionRegistry& R){
 
   // Core I/O
 
-  R.add("INPUT", NativeFn{"INPUT", -1, [](const std::vector<Value>& a){
+  R.add("INPUT", NativeFn{"INPUT", -1, [](NativeArgs a){
     if(!a.empty()) std::cout << to_string_value(a[0]);
     std::string line;
     std::getline(std::cin, line);
@@ -50,11 +74,11 @@ void bas::register_builtins(FunctionRegistry& R){
   }});
 
   // String helpers
-  R.add("STR", NativeFn{"STR", 1, [](const std::vector<Value>& a){
+  R.add("STR", NativeFn{"STR", 1, [](NativeArgs a){
     return Value::from_string(to_string_value(a[0]));
   }});
 
-  R.add("VAL", NativeFn{"VAL", 1, [](const std::vector<Value>& a){
+  R.add("VAL", NativeFn{"VAL", 1, [](NativeArgs a){
     if(std::holds_alternative<double>(a[0].v)) return a[0];
     if(std::holds_alternative<long long>(a[0].v)) return Value::from_number(static_cast<double>(std::get<long long>(a[0].v)));
     if(std::holds_alternative<std::string>(a[0].v)) return Value::from_number(std::stod(std::get<std::string>(a[0].v)));
@@ -62,7 +86,7 @@ void bas::register_builtins(FunctionRegistry& R){
     return Value::from_number(0.0);
   }});
 
-  R.add("LEN", NativeFn{"LEN", 1, [](const std::vector<Value>& a){
+  R.add("LEN", NativeFn{"LEN", 1, [](NativeArgs a){
     if (std::holds_alternative<std::string>(a[0].v)) {
       return Value::from_int(static_cast<long long>(a[0].as_string().size()));
     }
@@ -73,7 +97,7 @@ void bas::register_builtins(FunctionRegistry& R){
     return Value::from_int(0);
   }});
 
-  R.add("SUBSTR", NativeFn{"SUBSTR", 3, [](const std::vector<Value>& a){
+  R.add("SUBSTR", NativeFn{"SUBSTR", 3, [](NativeArgs a){
     const std::string& s = a[0].as_string();
     long long start = a[1].as_int();
     long long len = a[2].as_int();
@@ -85,7 +109,7 @@ void bas::register_builtins(FunctionRegistry& R){
   }});
 
   // Random/time
-  R.add("RANDOM", NativeFn{"RANDOM", -1, [](const std::vector<Value>& a){
+  R.add("RANDOM", NativeFn{"RANDOM", -1, [](NativeArgs a){
     static std::mt19937_64 eng{std::random_device{}()};
     if(a.empty()){
       std::uniform_real_distribution<double> dist(0.0,1.0); return Value::from_number(dist(eng));
@@ -93,7 +117,7 @@ void bas::register_builtins(FunctionRegistry& R){
     long long n = a[0].as_int(); if(n<=0) return Value::from_int(0);
     std::uniform_int_distribution<long long> dist(0,n-1); return Value::from_int(dist(eng));
   }});
-  R.add("RND", NativeFn{"RND", -1, [](const std::vector<Value>& a){
+  R.add("RND", NativeFn{"RND", -1, [](NativeArgs a){
     static std::mt19937_64 eng{std::random_device{}()};
     if(a.empty()){
       std::uniform_real_distribution<double> dist(0.0,1.0); return Value::from_number(dist(eng));
@@ -102,7 +126,7 @@ void bas::register_builtins(FunctionRegistry& R){
     std::uniform_int_distribution<long long> dist(0,n-1); return Value::from_int(dist(eng));
   }});
 
-  R.add("RNDINT", NativeFn{"RNDINT", 2, [](const std::vector<Value>& a){
+  R.add("RNDINT", NativeFn{"RNDINT", 2, [](NativeArgs a){
       static std::mt19937_64 eng{std::random_device{}()};
       long long lo = a[0].as_int();
       long long hi = a[1].as_int();
@@ -111,14 +135,14 @@ void bas::register_builtins(FunctionRegistry& R){
       return Value::from_int(dist(eng));
   }});
 
-  R.add("SEED", NativeFn{"SEED", 1, [](const std::vector<Value>& a){
+  R.add("SEED", NativeFn{"SEED", 1, [](NativeArgs a){
     static std::mt19937_64 eng; eng.seed(static_cast<uint64_t>(a[0].as_int())); return Value::nil();
   }});
-  R.add("RANDOMIZE", NativeFn{"RANDOMIZE", 1, [](const std::vector<Value>& a){
+  R.add("RANDOMIZE", NativeFn{"RANDOMIZE", 1, [](NativeArgs a){
     static std::mt19937_64 eng; eng.seed(static_cast<uint64_t>(a[0].as_int())); return Value::nil();
   }});
 
-  R.add("TIME", NativeFn{"TIME", 0, [](const std::vector<Value>&){
+  R.add("TIME", NativeFn{"TIME", 0, [](NativeArgs){
     using clock = std::chrono::system_clock;
     auto now = clock::now().time_since_epoch();
     auto secs = std::chrono::duration_cast<std::chrono::seconds>(now).count();
@@ -126,13 +150,13 @@ void bas::register_builtins(FunctionRegistry& R){
   }});
 
   // Assertions
-  R.add("ASSERT", NativeFn{"ASSERT", 1, [](const std::vector<Value>& a){
+  R.add("ASSERT", NativeFn{"ASSERT", 1, [](NativeArgs a){
     if(!a[0].as_bool()) throw std::runtime_error("ASSERT failed");
     return Value::nil();
   }});
 
-  // Arrays (immutable ops returning new arrays)
-  R.add("ARRAY", NativeFn{"ARRAY", 1, [](const std::vector<Value>& a){
+  // Arrays. The mutating builtins also expose an in-place form (see add_array_op)
+  R.add("ARRAY", NativeFn{"ARRAY", 1, [](NativeArgs a){
     long long nll = a[0].as_int();
     if(nll < 0) nll = 0;
     size_t n = static_cast<size_t>(nll);
@@ -140,82 +164,63 @@ void bas::register_builtins(FunctionRegistry& R){
     return Value::from_array(std::move(arr));
   }});
 
-  R.add("PUSH", NativeFn{"PUSH", 2, [](const std::vector<Value>& a){
-    if(!a[0].is_array()) throw std::runtime_error("PUSH: first argument must be an array");
-    bas::Value::Array copy = a[0].as_array();
-    copy.push_back(a[1]);
-    return Value::from_array(std::move(copy));
-  }});
+  add_array_op(R, "PUSH", 2, [](Value& arr, NativeArgs rest){
+    if(!arr.is_array()) throw std::runtime_error("PUSH: first argument must be an array");
+    arr.as_array().push_back(rest[0]);
+  });
 
-  R.add("APPEND", NativeFn{"APPEND", 2, [](const std::vector<Value>& a){
-    if(!a[0].is_array()) throw std::runtime_error("APPEND: first argument must be an array");
-    bas::Value::Array copy = a[0].as_array();
-    copy.push_back(a[1]);
-    return Value::from_array(std::move(copy));
-  }});
+  add_array_op(R, "APPEND", 2, [](Value& arr, NativeArgs rest){
+    if(!arr.is_array()) throw std::runtime_error("APPEND: first argument must be an array");
+    arr.as_array().push_back(rest[0]);
+  });
 
-  R.add("POP", NativeFn{"POP", 1, [](const std::vector<Value>& a){
-    if(!a[0].is_array()) throw std::runtime_error("POP: argument must be an array");
-    bas::Value::Array copy = a[0].as_array();
-    if(!copy.empty()) copy.pop_back();
-    return Value::from_array(std::move(copy));
-  }});
+  add_array_op(R, "POP", 1, [](Value& arr, NativeArgs){
+    if(!arr.is_array()) throw std::runtime_error("POP: argument must be an array");
+    if(!std::as_const(arr).as_array().empty()) arr.as_array().pop_back();
+  });
 
-  R.add("INSERT", NativeFn{"INSERT", 3, [](const std::vector<Value>& a){
-    if(!a[0].is_array()) throw std::runtime_error("INSERT: first argument must be an array");
-    bas::Value::Array copy = a[0].as_array();
-    long long idx = a[1].as_int();
+  add_array_op(R, "INSERT", 3, [](Value& arr, NativeArgs rest){
+    if(!arr.is_array()) throw std::runtime_error("INSERT: first argument must be an array");
+    auto& elems = arr.as_array();
+    long long idx = rest[0].as_int();
     if(idx < 0) idx = 0;
-    if((size_t)idx > copy.size()) idx = (long long)copy.size();
-    copy.insert(copy.begin() + (size_t)idx, a[2]);
-    return Value::from_array(std::move(copy));
-  }});
-
-  R.add("REMOVE", NativeFn{"REMOVE", 2, [](const std::vector<Value>& a){
-    if(!a[0].is_array()) throw std::runtime_error("REMOVE: first arg must be an array");
-    auto arr = a[0].as_array();
-    long long idx = a[1].as_int();
-    if(idx < 0 || idx >= static_cast<long long>(arr.size())) throw std::runtime_error("REMOVE: index out of bounds");
-    arr.erase(arr.begin() + idx);
-    return Value::from_array(arr);
-  }});
-
-  R.add("SORT", NativeFn{"SORT", 1, [](const std::vector<Value>& a){
-    if (!a[0].is_array()) throw std::runtime_error("SORT: argument must be an array");
-    auto arr = a[0].as_array();
-    if (arr.empty()) return Value::from_array(arr);
-
-    std::sort(arr.begin(), arr.end(), [](const Value& v1, const Value& v2) {
-        bool v1_is_num = std::holds_alternative<double>(v1.v) || std::holds_alternative<long long>(v1.v);
-        bool v2_is_num = std::holds_alternative<double>(v2.v) || std::holds_alternative<long long>(v2.v);
-        bool v1_is_str = std::holds_alternative<std::string>(v1.v);
-        bool v2_is_str = std::holds_alternative<std::string>(v2.v);
-
-        if (v1_is_num && v2_is_num) {
-            return v1.as_number() < v2.as_number();
-        } else if (v1_is_str && v2_is_str) {
-            return v1.as_string() < v2.as_string();
-        } else {
-            throw std::runtime_error("SORT: all array elements must be of the same comparable type (all numbers or all strings)");
-        }
+    if((size_t)idx > elems.size()) idx = (long long)elems.size();
+    elems.insert(elems.begin() + (size_t)idx, rest[1]);
+  });
+
+  add_array_op(R, "REMOVE", 2, [](Value& arr, NativeArgs rest){
+    if(!arr.is_array()) throw std::runtime_error("REMOVE: first arg must be an array");
+    long long idx = rest[0].as_int();
+    if(idx < 0 || idx >= static_cast<long long>(std::as_const(arr).as_array().size())) throw std::runtime_error("REMOVE: index out of bounds");
+    auto& elems = arr.as_array();
+    elems.erase(elems.begin() + idx);
+  });
+
+  add_array_op(R, "SORT", 1, [](Value& arr, NativeArgs){
+    if (!arr.is_array()) throw std::runtime_error("SORT: argument must be an array");
+    if (std::as_const(arr).as_array().size() < 2) return;
+    auto& elems = arr.as_array();
+    // Numbers and strings sort naturally; mixed types compare by their text
+    std::sort(elems.begin(), elems.end(), [](const Value& v1, const Value& v2) {
+        if (v1.is_number() && v2.is_number()) return v1.as_number() < v2.as_number();
+        if (v1.is_string() && v2.is_string()) return v1.as_string() < v2.as_string();
+        return to_string_value(v1) < to_string_value(v2);
     });
-
-    return Value::from_array(arr);
-  }});
+  });
 
   // Map functions
-  R.add("MAP_CREATE", NativeFn{"MAP_CREATE", 0, [](const std::vector<Value>&){
+  R.add("MAP_CREATE", NativeFn{"MAP_CREATE", 0, [](NativeArgs){
     return Value::from_map({});
   }});
 
-  R.add("MAP_SET", NativeFn{"MAP_SET", 3, [](const std::vector<Value>& a){
+  R.add("MAP_SET", NativeFn{"MAP_SET", 3, [](NativeArgs a){
     if (!a[0].is_map()) throw std::runtime_error("MAP_SET: first argument must be a map");
     auto map = a[0].as_map(); // copy
     map[a[1].as_string()] = a[2];
     return Value::from_map(map);
   }});
 
-  R.add("MAP_GET", NativeFn{"MAP_GET", -1, [](const std::vector<Value>& a){
+  R.add("MAP_GET", NativeFn{"MAP_GET", -1, [](NativeArgs a){
     if (a.size() < 2) throw std::runtime_error("MAP_GET: requires at least 2 arguments");
     if (!a[0].is_map()) throw std::runtime_error("MAP_GET: first argument must be a map");
     const auto& map = a[0].as_map();
@@ -230,20 +235,20 @@ void bas::register_builtins(FunctionRegistry& R){
     throw std::runtime_error("MAP_GET: key not found and no default value provided");
   }});
 
-  R.add("MAP_HAS", NativeFn{"MAP_HAS", 2, [](const std::vector<Value>& a){
+  R.add("MAP_HAS", NativeFn{"MAP_HAS", 2, [](NativeArgs a){
     if (!a[0].is_map()) throw std::runtime_error("MAP_HAS: first argument must be a map");
     const auto& map = a[0].as_map();
     return Value::from_bool(map.count(a[1].as_string()) > 0);
   }});
 
-  R.add("MAP_REMOVE", NativeFn{"MAP_REMOVE", 2, [](const std::vector<Value>& a){
+  R.add("MAP_REMOVE", NativeFn{"MAP_REMOVE", 2, [](NativeArgs a){
     if (!a[0].is_map()) throw std::runtime_error("MAP_REMOVE: first argument must be a map");
     auto map = a[0].as_map(); // copy
     map.erase(a[1].as_string());
     return Value::from_map(map);
   }});
 
-  R.add("MAP_KEYS", NativeFn{"MAP_KEYS", 1, [](const std::vector<Value>& a){
+  R.add("MAP_KEYS", NativeFn{"MAP_KEYS", 1, [](NativeArgs a){
     if (!a[0].is_map()) throw std::runtime_error("MAP_KEYS: argument must be a map");
     const auto& map = a[0].as_map();
     std::vector<Value> keys;
@@ -254,7 +259,7 @@ void bas::register_builtins(FunctionRegistry& R){
     return Value::from_array(keys);
   }});
 
-  R.add("MAP_VALUES", NativeFn{"MAP_VALUES", 1, [](const std::vector<Value>& a){
+  R.add("MAP_VALUES", NativeFn{"MAP_VALUES", 1, [](NativeArgs a){
     if (!a[0].is_map()) throw std::runtime_error("MAP_VALUES: argument must be a map");
     const auto& map = a[0].as_map();
     std::vector<Value> values;
@@ -266,27 +271,31 @@ void bas::register_builtins(FunctionRegistry& R){
   }});
 
   // File I/O
-  R.add("FILEEXISTS", NativeFn{"FILEEXISTS", 1, [](const std::vector<Value>& a){
+  R.add("FILEEXISTS", NativeFn{"FILEEXISTS", 1, [](NativeArgs a){
     std::string filename = a[0].as_string();
     std::ifstream file(filename);
     return Value::from_bool(file.good());
   }});
 
-  R.add("FILESIZE", NativeFn{"FILESIZE", 1, [](const std::vector<Value>& a){
+  R.add("FILESIZE", NativeFn{"FILESIZE", 1, [](NativeArgs a){
     std::string filename = a[0].as_string();
     std::ifstream file(filename, std::ios::binary | std::ios::ate);
     if(!file.is_open()) return Value::from_number(0.0);
     return Value::from_number(static_cast<double>(file.tellg()));
   }});
 
-  R.add("READALL", NativeFn{"READALL", 1, [](const std::vector<Value>& a){
-    std::ifstream f(a[0].as_string(), std::ios::binary);
-    if(!f.is_open()) return Value::from_string("");
-    std::ostringstream ss; ss << f.rdbuf();
-    return Value::from_string(ss.str());
+  R.add("READALL", NativeFn{"READALL", 1, [](NativeArgs a){
+    return read_file(a[0].as_string());
+  }});
+
+  // READALL_ASYNC(path) -> future completing with what READALL would return;
+  // the file is read on a worker thread, so a coroutine can AWAIT a large
+  // asset without stalling the frame
+  R.add("READALL_ASYNC", NativeFn{"READALL_ASYNC", 1, [](NativeArgs a){
+    return run_async([path = a[0].as_string()]{ return read_file(path); });
   }});
 
-  R.add("WRITEALL", NativeFn{"WRITEALL", 2, [](const std::vector<Value>& a){
+  R.add("WRITEALL", NativeFn{"WRITEALL", 2, [](NativeArgs a){
     std::ofstream f(a[0].as_string(), std::ios::binary);
     if(!f.is_open()) return Value::from_bool(false);
     const std::string& data = a[1].as_string();
@@ -295,7 +304,7 @@ void bas::register_builtins(FunctionRegistry& R){
   }});
 
   // String manipulation
-  R.add("LEFT", NativeFn{"LEFT", 2, [](const std::vector<Value>& a){
+  R.add("LEFT", NativeFn{"LEFT", 2, [](NativeArgs a){
     std::string str = a[0].as_string();
     int count = static_cast<int>(a[1].as_number());
     if(count <= 0) return Value::from_string("");
@@ -303,7 +312,7 @@ void bas::register_builtins(FunctionRegistry& R){
     return Value::from_string(str.substr(0, count));
   }});
 
-  R.add("RIGHT", NativeFn{"RIGHT", 2, [](const std::vector<Value>& a){
+  R.add("RIGHT", NativeFn{"RIGHT", 2, [](NativeArgs a){
     std::string str = a[0].as_string();
     int count = static_cast<int>(a[1].as_number());
     if(count <= 0) return Value::from_string("");
@@ -311,7 +320,7 @@ void bas::register_builtins(FunctionRegistry& R){
     return Value::from_string(str.substr(str.length() - count));
   }});
 
-  R.add("MID", NativeFn{"MID", 3, [](const std::vector<Value>& a){
+  R.add("MID", NativeFn{"MID", 3, [](NativeArgs a){
     std::string str = a[0].as_string();
     int start = static_cast<int>(a[1].as_number());
     int count = static_cast<int>(a[2].as_number());
@@ -322,39 +331,39 @@ void bas::register_builtins(FunctionRegistry& R){
     return Value::from_string(str.substr(startPos, endPos - startPos));
   }});
 
-  R.add("UCASE", NativeFn{"UCASE", 1, [](const std::vector<Value>& a){
+  R.add("UCASE", NativeFn{"UCASE", 1, [](NativeArgs a){
     std::string str = a[0].as_string();
     std::transform(str.begin(), str.end(), str.begin(), ::toupper);
     return Value::from_string(str);
   }});
 
-  R.add("LCASE", NativeFn{"LCASE", 1, [](const std::vector<Value>& a){
+  R.add("LCASE", NativeFn{"LCASE", 1, [](NativeArgs a){
     std::string str = a[0].as_string();
     std::transform(str.begin(), str.end(), str.begin(), ::tolower);
     return Value::from_string(str);
   }});
 
-  R.add("LTRIM", NativeFn{"LTRIM", 1, [](const std::vector<Value>& a){
+  R.add("LTRIM", NativeFn{"LTRIM", 1, [](NativeArgs a){
     const std::string& s = a[0].as_string();
     size_t i = 0; while(i < s.size() && std::isspace(static_cast<unsigned char>(s[i]))) ++i;
     return Value::from_string(s.substr(i));
   }});
 
-  R.add("RTRIM", NativeFn{"RTRIM", 1, [](const std::vector<Value>& a){
+  R.add("RTRIM", NativeFn{"RTRIM", 1, [](NativeArgs a){
     const std::string& s = a[0].as_string();
     if(s.empty()) return Value::from_string("");
     size_t j = s.size(); while(j > 0 && std::isspace(static_cast<unsigned char>(s[j-1]))) --j;
     return Value::from_string(s.substr(0, j));
   }});
 
-  R.add("TRIM", NativeFn{"TRIM", 1, [](const std::vector<Value>& a){
+  R.add("TRIM", NativeFn{"TRIM", 1, [](NativeArgs a){
     const std::string& s = a[0].as_string();
     size_t i = 0; while(i < s.size() && std::isspace(static_cast<unsigned char>(s[i]))) ++i;
     size_t j = s.size(); while(j > i && std::isspace(static_cast<unsigned char>(s[j-1]))) --j;
     return Value::from_string(s.substr(i, j - i));
   }});
 
-  R.add("INSTR", NativeFn{"INSTR", -1, [](const std::vector<Value>& a){
+  R.add("INSTR", NativeFn{"INSTR", -1, [](NativeArgs a){
     if(a.size() < 2) throw std::runtime_error("INSTR: need at least 2 args");
     const std::string& s = a[0].as_string();
     const std::string& sub = a[1].as_string();
@@ -366,7 +375,7 @@ void bas::register_builtins(FunctionRegistry& R){
     return Value::from_int(static_cast<long long>(pos + 1));
   }});
 
-  R.add("REPLACE", NativeFn{"REPLACE", 3, [](const std::vector<Value>& a){
+  R.add("REPLACE", NativeFn{"REPLACE", 3, [](NativeArgs a){
     std::string str = a[0].as_string();
     const std::string& from = a[1].as_string();
     const std::string& to = a[2].as_string();
@@ -379,18 +388,18 @@ void bas::register_builtins(FunctionRegistry& R){
     return Value::from_string(str);
   }});
 
-  R.add("CHR", NativeFn{"CHR", 1, [](const std::vector<Value>& a){
+  R.add("CHR", NativeFn{"CHR", 1, [](NativeArgs a){
     long long code = a[0].as_int();
     return Value::from_string(std::string(1, static_cast<char>(code)));
   }});
 
-  R.add("ASC", NativeFn{"ASC", 1, [](const std::vector<Value>& a){
+  R.add("ASC", NativeFn{"ASC", 1, [](NativeArgs a){
     const std::string& s = a[0].as_string();
     if (s.empty()) return Value::from_int(0);
     return Value::from_int(static_cast<unsigned char>(s[0]));
   }});
 
-  R.add("SPLIT", NativeFn{"SPLIT", 2, [](const std::vector<Value>& a){
+  R.add("SPLIT", NativeFn{"SPLIT", 2, [](NativeArgs a){
     const std::string& str = a[0].as_string();
     const std::string& delim = a[1].as_string();
     std::vector<Value> result;
@@ -411,7 +420,7 @@ void bas::register_builtins(FunctionRegistry& R){
     return Value::from_array(result);
   }});
 
-  R.add("JOIN", NativeFn{"JOIN", 2, [](const std::vector<Value>& a){
+  R.add("JOIN", NativeFn{"JOIN", 2, [](NativeArgs a){
       if (!a[0].is_array()) throw std::runtime_error("JOIN: first argument must be an array");
       const auto& arr = a[0].as_array();
       const std::string& delim = a[1].as_string();
@@ -425,7 +434,7 @@ void bas::register_builtins(FunctionRegistry& R){
       return Value::from_string(ss.str());
   }});
 
-  R.add("FORMAT", NativeFn{"FORMAT", -1, [](const std::vector<Value>& a){
+  R.add("FORMAT", NativeFn{"FORMAT", -1, [](NativeArgs a){
     if (a.empty()) throw std::runtime_error("FORMAT: requires a format string");
     const std::string& fmt = a[0].as_string();
     std::stringstream result;
@@ -473,105 +482,111 @@ void bas::register_builtins(FunctionRegistry& R){
   }});
 
   // Math & system
-  R.add("SGN", NativeFn{"SGN", 1, [](const std::vector<Value>& a){
+  R.add("SGN", NativeFn{"SGN", 1, [](NativeArgs a){
     double num = a[0].as_number();
     return Value::from_number((num > 0) - (num < 0));
   }});
 
-  R.add_with_policy("MIN", NativeFn{"MIN", 2, [](const std::vector<Value>& a){
+  R.add_with_policy("MIN", NativeFn{"MIN", 2, [](NativeArgs a){
     double n1 = a[0].as_number();
     double n2 = a[1].as_number();
     return Value::from_number(std::min(n1, n2));
   }}, true);
 
-  R.add_with_policy("MAX", NativeFn{"MAX", 2, [](const std::vector<Value>& a){
+  R.add_with_policy("MAX", NativeFn{"MAX", 2, [](NativeArgs a){
     double n1 = a[0].as_number();
     double n2 = a[1].as_number();
     return Value::from_number(std::max(n1, n2));
   }}, true);
 
-  R.add_with_policy("CLAMP", NativeFn{"CLAMP", 3, [](const std::vector<Value>& a){
+  R.add_with_policy("CLAMP", NativeFn{"CLAMP", 3, [](NativeArgs a){
     double val = a[0].as_number();
     double min_val = a[1].as_number();
     double max_val = a[2].as_number();
     return Value::from_number(std::max(min_val, std::min(val, max_val)));
   }}, true);
 
-  R.add("ABS", NativeFn{"ABS", 1, [](const std::vector<Value>& a){
+  R.add("ABS", NativeFn{"ABS", 1, [](NativeArgs a){
     double num = a[0].as_number();
     return Value::from_number(std::abs(num));
   }});
-  R.add("SIN", NativeFn{"SIN", 1, [](const std::vector<Value>& a){
+  R.add("SIN", NativeFn{"SIN", 1, [](NativeArgs a){
     double angle = a[0].as_number();
     return Value::from_number(std::sin(angle));
   }});
-  R.add("COS", NativeFn{"COS", 1, [](const std::vector<Value>& a){
+  R.add("COS", NativeFn{"COS", 1, [](NativeArgs a){
     double angle = a[0].as_number();
     return Value::from_number(std::cos(angle));
   }});
-  R.add("TAN", NativeFn{"TAN", 1, [](const std::vector<Value>& a){
+  R.add("TAN", NativeFn{"TAN", 1, [](NativeArgs a){
     double angle = a[0].as_number();
     return Value::from_number(std::tan(angle));
   }});
-  R.add("ATAN", NativeFn{"ATAN", 1, [](const std::vector<Value>& a){
+  R.add("ATAN", NativeFn{"ATAN", 1, [](NativeArgs a){
     double num = a[0].as_number();
     return Value::from_number(std::atan(num));
   }});
-  R.add("ASIN", NativeFn{"ASIN", 1, [](const std::vector<Value>& a){
+  R.add("ASIN", NativeFn{"ASIN", 1, [](NativeArgs a){
     double num = a[0].as_number();
     if (num < -1.0 || num > 1.0) throw std::runtime_error("ASIN: argument out of range [-1, 1]");
     return Value::from_number(std::asin(num));
   }});
-  R.add("ACOS", NativeFn{"ACOS", 1, [](const std::vector<Value>& a){
+  R.add("ACOS", NativeFn{"ACOS", 1, [](NativeArgs a){
     double num = a[0].as_number();
     if (num < -1.0 || num > 1.0) throw std::runtime_error("ACOS: argument out of range [-1, 1]");
     return Value::from_number(std::acos(num));
   }});
-  R.add("ATAN2", NativeFn{"ATAN2", 2, [](const std::vector<Value>& a){
+  R.add("ATAN2", NativeFn{"ATAN2", 2, [](NativeArgs a){
     double y = a[0].as_number();
     double x = a[1].as_number();
     return Value::from_number(std::atan2(y, x));
   }});
-  R.add("SQRT", NativeFn{"SQRT", 1, [](const std::vector<Value>& a){
+  R.add("SQRT", NativeFn{"SQRT", 1, [](NativeArgs a){
     double num = a[0].as_number();
     if(num < 0) throw std::runtime_error("SQRT: cannot take square root of negative number");
     return Value::from_number(std::sqrt(num));
   }});
-  R.add("POW", NativeFn{"POW", 2, [](const std::vector<Value>& a){
+  R.add("POW", NativeFn{"POW", 2, [](NativeArgs a){
     double base = a[0].as_number();
     double exponent = a[1].as_number();
     return Value::from_number(std::pow(base, exponent));
   }});
-  R.add("LOG", NativeFn{"LOG", 1, [](const std::vector<Value>& a){
+  R.add("LOG", NativeFn{"LOG", 1, [](NativeArgs a){
     double num = a[0].as_number();
     if(num <= 0) throw std::runtime_error("LOG: cannot take log of non-positive number");
     return Value::from_number(std::log(num));
   }});
-  R.add("EXP", NativeFn{"EXP", 1, [](const std::vector<Value>& a){
+  R.add("EXP", NativeFn{"EXP", 1, [](NativeArgs a){
     double num = a[0].as_number();
     return Value::from_number(std::exp(num));
   }});
-  R.add("INT", NativeFn{"INT", 1, [](const std::vector<Value>& a){
+  R.add("INT", NativeFn{"INT", 1, [](NativeArgs a){
     double num = a[0].as_number();
     return Value::from_int(static_cast<long long>(std::floor(num)));
   }});
-  R.add("FIX", NativeFn{"FIX", 1, [](const std::vector<Value>& a){
+  R.add("FIX", NativeFn{"FIX", 1, [](NativeArgs a){
     double num = a[0].as_number();
     return Value::from_int(static_cast<long long>(num));
   }});
-  R.add("ROUND", NativeFn{"ROUND", 1, [](const std::vector<Value>& a){
+  R.add("ROUND", NativeFn{"ROUND", 1, [](NativeArgs a){
     double num = a[0].as_number();
     return Value::from_int(static_cast<long long>(std::round(num)));
   }});
 
-  R.add_with_policy("LERP", NativeFn{"LERP", 3, [](const std::vector<Value>& a){
+  R.add_with_policy("LERP", NativeFn{"LERP", 3, [](NativeArgs a){
       double v0 = a[0].as_number();
       double v1 = a[1].as_number();
       double t = a[2].as_number();
       return Value::from_number(v0 + t * (v1 - v0));
   }}, true);
 
-  R.add("SLEEP", NativeFn{"SLEEP", 1, [](const std::vector<Value>& a){
+  // PROFILE_FRAME(): end a frame of the --profile summary. The profiler marks
+  // it when the call returns, as it does for ENDDRAWING.
+  R.add("PROFILE_FRAME", NativeFn{"PROFILE_FRAME", 0, [](NativeArgs){
+    return Value::nil();
+  }});
+
+  R.add("SLEEP", NativeFn{"SLEEP", 1, [](NativeArgs a){
     double seconds = a[0].as_number();
     if(seconds > 0) {
       std::this_thread::sleep_for(std::chrono::milliseconds(static_cast<long long>(seconds * 1000)));
@@ -580,7 +595,7 @@ void bas::register_builtins(FunctionRegistry& R){
   }});
   
   // WAIT and DELAY are aliases for SLEEP (common BASIC commands)
-  R.add("WAIT", NativeFn{"WAIT", 1, [](const std::vector<Value>& a){
+  R.add("WAIT", NativeFn{"WAIT", 1, [](NativeArgs a){
     double seconds = a[0].as_number();
     if(seconds > 0) {
       std::this_thread::sleep_for(std::chrono::milliseconds(static_cast<long long>(seconds * 1000)));
@@ -588,7 +603,7 @@ void bas::register_builtins(FunctionRegistry& R){
     return Value::nil();
   }});
   
-  R.add("DELAY", NativeFn{"DELAY", 1, [](const std::vector<Value>& a){
+  R.add("DELAY", NativeFn{"DELAY", 1, [](NativeArgs a){
     double seconds = a[0].as_number();
     if(seconds > 0) {
       std::this_thread::sleep_for(std::chrono::milliseconds(static_cast<long long>(seconds * 1000)));
@@ -596,26 +611,26 @@ void bas::register_builtins(FunctionRegistry& R){
     return Value::nil();
   }});
 
-  R.add("BEEP", NativeFn{"BEEP", 0, [](const std::vector<Value>&){
+  R.add("BEEP", NativeFn{"BEEP", 0, [](NativeArgs){
     std::cout << "\a" << std::flush;
     return Value::nil();
   }});
 
   // System functions
-  R.add("SHELL", NativeFn{"SHELL", 1, [](const std::vector<Value>& a){
+  R.add("SHELL", NativeFn{"SHELL", 1, [](NativeArgs a){
     std::string cmd = a[0].as_string();
     int result = std::system(cmd.c_str());
     return Value::from_int(static_cast<long long>(result));
   }});
 
   // Clipboard functions (platform-specific, simplified)
-  R.add("CLIPBOARD_GET", NativeFn{"CLIPBOARD_GET", 0, [](const std::vector<Value>&){
+  R.add("CLIPBOARD_GET", NativeFn{"CLIPBOARD_GET", 0, [](NativeArgs){
     // Platform-specific clipboard access would go here
     // For now, return empty string
     return Value::from_string("");
   }});
 
-  R.add("CLIPBOARD_SET", NativeFn{"CLIPBOARD_SET", 1, [](const std::vector<Value>& a){
+  R.add("CLIPBOARD_SET", NativeFn{"CLIPBOARD_SET", 1, [](NativeArgs a){
     std::string text = a[0].as_string();
     // Platform-specific clipboard set would go here
     (void)text; // Suppress unused warning
@@ -623,13 +638,13 @@ void bas::register_builtins(FunctionRegistry& R){
   }});
 
   // Environment variables
-  R.add("ENV_GET", NativeFn{"ENV_GET", 1, [](const std::vector<Value>& a){
+  R.add("ENV_GET", NativeFn{"ENV_GET", 1, [](NativeArgs a){
     std::string key = a[0].as_string();
     const char* val = std::getenv(key.c_str());
     return Value::from_string(val ? val : "");
   }});
 
-  R.add("ENV_SET", NativeFn{"ENV_SET", 2, [](const std::vector<Value>& a){
+  R.add("ENV_SET", NativeFn{"ENV_SET", 2, [](NativeArgs a){
     std::string key = a[0].as_string();
     std::string val = a[1].as_string();
 #ifdef _WIN32
@@ -641,13 +656,13 @@ void bas::register_builtins(FunctionRegistry& R){
   }});
 
   // File operations
-  R.add("FILE_DELETE", NativeFn{"FILE_DELETE", 1, [](const std::vector<Value>& a){
+  R.add("FILE_DELETE", NativeFn{"FILE_DELETE", 1, [](NativeArgs a){
     std::string path = a[0].as_string();
     std::remove(path.c_str());
     return Value::nil();
   }});
 
-  R.add("FILE_COPY", NativeFn{"FILE_COPY", 2, [](const std::vector<Value>& a){
+  R.add("FILE_COPY", NativeFn{"FILE_COPY", 2, [](NativeArgs a){
     std::string src = a[0].as_string();
     std::string dst = a[1].as_string();
     std::ifstream srcFile(src, std::ios::binary);
@@ -660,7 +675,7 @@ void bas::register_builtins(FunctionRegistry& R){
 
   // File handle operations (simple implementation using file paths)
   // Note: Full #n file handle support would require parser changes
-  R.add("EOF", NativeFn{"EOF", 1, [](const std::vector<Value>& a){
+  R.add("EOF", NativeFn{"EOF", 1, [](NativeArgs a){
     std::string path = a[0].as_string();
     std::ifstream file(path);
     if(!file.is_open()) return Value::from_bool(true);
@@ -671,14 +686,14 @@ void bas::register_builtins(FunctionRegistry& R){
     return Value::from_bool(cur >= end);
   }});
 
-  R.add("LOF", NativeFn{"LOF", 1, [](const std::vector<Value>& a){
+  R.add("LOF", NativeFn{"LOF", 1, [](NativeArgs a){
     std::string path = a[0].as_string();
     std::ifstream file(path, std::ios::binary | std::ios::ate);
     if(!file.is_open()) return Value::from_number(0.0);
     return Value::from_number(static_cast<double>(file.tellg()));
   }});
 
-  R.add("SEEK", NativeFn{"SEEK", 2, [](const std::vector<Value>& a){
+  R.add("SEEK", NativeFn{"SEEK", 2, [](NativeArgs a){
     std::string path = a[0].as_string();
     long long pos = a[1].as_int();
     (void)path; (void)pos; // Suppress unused variable warnings
@@ -688,7 +703,7 @@ void bas::register_builtins(FunctionRegistry& R){
   }});
 
   // Directory operations
-  R.add("DIR_CREATE", NativeFn{"DIR_CREATE", 1, [](const std::vector<Value>& a){
+  R.add("DIR_CREATE", NativeFn{"DIR_CREATE", 1, [](NativeArgs a){
     std::string path = a[0].as_string();
 #ifdef _WIN32
     _mkdir(path.c_str());
@@ -698,7 +713,7 @@ void bas::register_builtins(FunctionRegistry& R){
     return Value::nil();
   }});
 
-  R.add("DIR_DELETE", NativeFn{"DIR_DELETE", 1, [](const std::vector<Value>& a){
+  R.add("DIR_DELETE", NativeFn{"DIR_DELETE", 1, [](NativeArgs a){
     std::string path = a[0].as_string();
 #ifdef _WIN32
     _rmdir(path.c_str());
@@ -708,31 +723,31 @@ void bas::register_builtins(FunctionRegistry& R){
     return Value::nil();
   }});
 
-  R.add("DIR_LIST", NativeFn{"DIR_LIST", 1, [](const std::vector<Value>& a){
+  R.add("DIR_LIST", NativeFn{"DIR_LIST", 1, [](NativeArgs a){
     std::string path = a[0].as_string();
     std::vector<Value> files;
     // Simplified - would need proper directory iteration
     return Value::from_array(files);
   }});
 
-  R.add("CHDIR", NativeFn{"CHDIR", 1, [](const std::vector<Value>& a){
+  R.add("CHDIR", NativeFn{"CHDIR", 1, [](NativeArgs a){
     std::string path = a[0].as_string();
     std::filesystem::current_path(path);
     return Value::nil();
   }});
 
-  R.add("CURDIR", NativeFn{"CURDIR", 0, [](const std::vector<Value>&){
+  R.add("CURDIR", NativeFn{"CURDIR", 0, [](NativeArgs){
     return Value::from_string(std::filesystem::current_path().string());
   }});
 
-  R.add("PATH_JOIN", NativeFn{"PATH_JOIN", 2, [](const std::vector<Value>& a){
+  R.add("PATH_JOIN", NativeFn{"PATH_JOIN", 2, [](NativeArgs a){
     std::string a_path = a[0].as_string();
     std::string b_path = a[1].as_string();
     return Value::from_string((std::filesystem::path(a_path) / b_path).string());
   }});
 
   // Date/Time functions
-  R.add("DATE_NOW", NativeFn{"DATE_NOW", 0, [](const std::vector<Value>&){
+  R.add("DATE_NOW", NativeFn{"DATE_NOW", 0, [](NativeArgs){
     auto now = std::chrono::system_clock::now();
     auto time = std::chrono::system_clock::to_time_t(now);
     char buffer[100];
@@ -740,7 +755,7 @@ void bas::register_builtins(FunctionRegistry& R){
     return Value::from_string(buffer);
   }});
 
-  R.add("UNIX_TIME", NativeFn{"UNIX_TIME", 0, [](const std::vector<Value>&){
+  R.add("UNIX_TIME", NativeFn{"UNIX_TIME", 0, [](NativeArgs){
     auto now = std::chrono::system_clock::now();
     auto time = std::chrono::system_clock::to_time_t(now);
     return Value::from_int(static_cast<long long>(time));
@@ -748,13 +763,13 @@ void bas::register_builtins(FunctionRegistry& R){
 
   // Timer functions (simple implementation)
   static std::map<std::string, std::chrono::steady_clock::time_point> timers;
-  R.add("TIMER_START", NativeFn{"TIMER_START", 1, [](const std::vector<Value>& a){
+  R.add("TIMER_START", NativeFn{"TIMER_START", 1, [](NativeArgs a){
     std::string id = a[0].as_string();
     timers[id] = std::chrono::steady_clock::now();
     return Value::nil();
   }});
 
-  R.add("TIMER_ELAPSED", NativeFn{"TIMER_ELAPSED", 1, [](const std::vector<Value>& a){
+  R.add("TIMER_ELAPSED", NativeFn{"TIMER_ELAPSED", 1, [](NativeArgs a){
     std::string id = a[0].as_string();
     auto it = timers.find(id);
     if(it == timers.end()) return Value::from_number(0.0);
@@ -767,4 +782,7 @@ void bas::register_builtins(FunctionRegistry& R){
   register_builtins_console(R);
   register_builtins_graphics(R);
   register_builtins_audio(R);
+
+  // Coroutines and futures
+  register_coroutine_functions(R);
 }
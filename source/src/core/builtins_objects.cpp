@@ -15,72 +15,52 @@ using namespace bas;
     return Value::from_map(std::move(obj));
 }
 
+// Packed value constructors. Colors are clamped to 0-255.
+static Value make_vector2(double x, double y) {
+    return Value::from_packed(Packed::vector2(static_cast<float>(x), static_cast<float>(y)));
+}
+
+static Value make_vector3(double x, double y, double z) {
+    return Value::from_packed(Packed::vector3(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z)));
+}
+
+static Value make_color(double r, double g, double b, double a) {
+    auto clamp = [](double c) { return static_cast<float>(std::max(0.0, std::min(255.0, c))); };
+    return Value::from_packed(Packed::color(clamp(r), clamp(g), clamp(b), clamp(a)));
+}
+
 // Vector3 object constructor: Vector3(x, y, z)
-static Value vector3_constructor(const std::vector<Value>& args) {
+static Value vector3_constructor(NativeArgs args) {
     double x = args.size() > 0 ? args[0].as_number() : 0.0;
     double y = args.size() > 1 ? args[1].as_number() : 0.0;
     double z = args.size() > 2 ? args[2].as_number() : 0.0;
-    
-    Value::Map vec;
-    vec[normalize_identifier("_type")] = Value::from_string(normalize_identifier("Vector3"));
-    vec[normalize_identifier("x")] = Value::from_number(x);
-    vec[normalize_identifier("y")] = Value::from_number(y);
-    vec[normalize_identifier("z")] = Value::from_number(z);
-    
-    return Value::from_map(std::move(vec));
+    return make_vector3(x, y, z);
 }
 
 // Vector2 object constructor: Vector2(x, y)
-static Value vector2_constructor(const std::vector<Value>& args) {
+static Value vector2_constructor(NativeArgs args) {
     double x = args.size() > 0 ? args[0].as_number() : 0.0;
     double y = args.size() > 1 ? args[1].as_number() : 0.0;
-    
-    Value::Map vec;
-    vec[normalize_identifier("_type")] = Value::from_string(normalize_identifier("Vector2"));
-    vec[normalize_identifier("x")] = Value::from_number(x);
-    vec[normalize_identifier("y")] = Value::from_number(y);
-    
-    return Value::from_map(std::move(vec));
+    return make_vector2(x, y);
 }
 
 // Color object constructor: Color(r, g, b, a)
-static Value color_constructor(const std::vector<Value>& args) {
+static Value color_constructor(NativeArgs args) {
     double r = args.size() > 0 ? args[0].as_number() : 0.0;
     double g = args.size() > 1 ? args[1].as_number() : 0.0;
     double b = args.size() > 2 ? args[2].as_number() : 0.0;
     double a = args.size() > 3 ? args[3].as_number() : 255.0;
-    
-    // Clamp values to 0-255
-    r = std::max(0.0, std::min(255.0, r));
-    g = std::max(0.0, std::min(255.0, g));
-    b = std::max(0.0, std::min(255.0, b));
-    a = std::max(0.0, std::min(255.0, a));
-    
-    Value::Map color;
-    color[normalize_identifier("_type")] = Value::from_string(normalize_identifier("Color"));
-    color[normalize_identifier("r")] = Value::from_number(r);
-    color[normalize_identifier("g")] = Value::from_number(g);
-    color[normalize_identifier("b")] = Value::from_number(b);
-    color[normalize_identifier("a")] = Value::from_number(a);
-    
-    return Value::from_map(std::move(color));
+    return make_color(r, g, b, a);
 }
 
 // Rectangle object constructor: Rectangle(x, y, width, height)
-static Value rectangle_constructor(const std::vector<Value>& args) {
+static Value rectangle_constructor(NativeArgs args) {
     double x = args.size() > 0 ? args[0].as_number() : 0.0;
     double y = args.size() > 1 ? args[1].as_number() : 0.0;
     double w = args.size() > 2 ? args[2].as_number() : 0.0;
     double h = args.size() > 3 ? args[3].as_number() : 0.0;
-    
-    Value::Map rect;
-    rect[normalize_identifier("_type")] = Value::from_string(normalize_identifier("Rectangle"));
-    rect[normalize_identifier("x")] = Value::from_number(x);
-    rect[normalize_identifier("y")] = Value::from_number(y);
-    rect[normalize_identifier("width")] = Value::from_number(w);
-    rect[normalize_identifier("height")] = Value::from_number(h);
-    
-    return Value::from_map(std::move(rect));
+    return Value::from_packed(Packed::rectangle(static_cast<float>(x), static_cast<float>(y),
+                                                static_cast<float>(w), static_cast<float>(h)));
 }
 
 // Camera3D object constructor: Camera3D()
@@ -88,49 +68,48 @@ static Value camera3d_constructor(const std::vector<Value>& args) {
     Value::Map camera;
     camera[normalize_identifier("_type")] = Value::from_string(normalize_identifier("Camera3D"));
     
-    // Default camera properties - create Vector3 objects properly
-    Value::Map position;
-    position[normalize_identifier("_type")] = Value::from_string(normalize_identifier("Vector3"));
-    position[normalize_identifier("x")] = Value::from_number(0.0);
-    position[normalize_identifier("y")] = Value::from_number(0.0);
-    position[normalize_identifier("z")] = Value::from_number(10.0);
-    
-    Value::Map target;
-    target[normalize_identifier("_type")] = Value::from_string(normalize_identifier("Vector3"));
-    target[normalize_identifier("x")] = Value::from_number(0.0);
-    target[normalize_identifier("y")] = Value::from_number(0.0);
-    target[normalize_identifier("z")] = Value::from_number(0.0);
-    
-    Value::Map up;
-    up[normalize_identifier("_type")] = Value::from_string(normalize_identifier("Vector3"));
-    up[normalize_identifier("x")] = Value::from_number(0.0);
-    up[normalize_identifier("y")] = Value::from_number(1.0);
-    up[normalize_identifier("z")] = Value::from_number(0.0);
-    
-    camera[normalize_identifier("position")] = Value::from_map(std::move(position));
-    camera[normalize_identifier("target")] = Value::from_map(std::move(target));
-    camera[normalize_identifier("up")] = Value::from_map(std::move(up));
+    // Default camera properties
+    camera[normalize_identifier("position")] = make_vector3(0.0, 0.0, 10.0);
+    camera[normalize_identifier("target")] = make_vector3(0.0, 0.0, 0.0);
+    camera[normalize_identifier("up")] = make_vector3(0.0, 1.0, 0.0);
     camera[normalize_identifier("fovy")] = Value::from_number(60.0);
     camera[normalize_identifier("projection")] = Value::from_number(0.0); // CAMERA_PERSPECTIVE
     
     return Value::from_map(std::move(camera));
 }
 
-// Helper to extract Vector3 components
-static void get_vector3_components(const Value& vec, double& x, double& y, double& z) {
-    if(!vec.is_map()) {
-        x = y = z = 0.0;
+// Vector, color and rectangle methods take packed values; maps with the same
+// field names (built by scripts or older modules) are still accepted.
+static bool is_object(const Value& v) {
+    return v.is_packed() || v.is_map();
+}
+
+// Reads up to `n` fields into `out`. Packed values are read by position,
+// maps by field name; missing fields keep the value already in `out`.
+static void get_components(const Value& v, const char* const* names, int n, double* out) {
+    if(const Packed* p = v.packed()) {
+        for(int i = 0; i < n; ++i) out[i] = p->f[i];
         return;
     }
-    const auto& map = vec.as_map();
-    x = map.count(normalize_identifier("x")) ? map.at(normalize_identifier("x")).as_number() : 0.0;
-    y = map.count(normalize_identifier("y")) ? map.at(normalize_identifier("y")).as_number() : 0.0;
-    z = map.count(normalize_identifier("z")) ? map.at(normalize_identifier("z")).as_number() : 0.0;
+    if(!v.is_map()) return;
+    const auto& map = v.as_map();
+    for(int i = 0; i < n; ++i) {
+        auto it = map.find(names[i]);
+        if(it != map.end()) out[i] = it->second.as_number();
+    }
+}
+
+// Helper to extract Vector3 components
+static void get_vector3_components(const Value& vec, double& x, double& y, double& z) {
+    static const char* const names[] = {"x", "y", "z"};
+    double c[3] = {0.0, 0.0, 0.0};
+    get_components(vec, names, 3, c);
+    x = c[0]; y = c[1]; z = c[2];
 }
 
 // Vector3 methods
-static Value vector3_length(const std::vector<Value>& args) {
-    if(args.empty() || !args[0].is_map()) {
+static Value vector3_length(NativeArgs args) {
+    if(args.empty() || !is_object(args[0])) {
         return Value::from_number(0.0);
     }
     double x, y, z;
@@ -138,26 +117,22 @@ static Value vector3_length(const std::vector<Value>& args) {
     return Value::from_number(std::sqrt(x*x + y*y + z*z));
 }
 
-static Value vector3_normalize(const std::vector<Value>& args) {
-    if(args.empty() || !args[0].is_map()) {
-        return vector3_constructor({});
+static Value vector3_normalize(NativeArgs args) {
+    if(args.empty() || !is_object(args[0])) {
+        return make_vector3(0.0, 0.0, 0.0);
     }
     double x, y, z;
     get_vector3_components(args[0], x, y, z);
     
     double len = std::sqrt(x*x + y*y + z*z);
     if(len < 0.0001) {
-        return vector3_constructor({});
+        return make_vector3(0.0, 0.0, 0.0);
     }
-    return vector3_constructor({
-        Value::from_number(x / len),
-        Value::from_number(y / len),
-        Value::from_number(z / len)
-    });
+    return make_vector3(x / len, y / len, z / len);
 }
 
-static Value vector3_dot(const std::vector<Value>& args) {
-    if(args.size() < 2 || !args[0].is_map() || !args[1].is_map()) {
+static Value vector3_dot(NativeArgs args) {
+    if(args.size() < 2 || !is_object(args[0]) || !is_object(args[1])) {
         return Value::from_number(0.0);
     }
     double x1, y1, z1, x2, y2, z2;
@@ -166,22 +141,18 @@ static Value vector3_dot(const std::vector<Value>& args) {
     return Value::from_number(x1*x2 + y1*y2 + z1*z2);
 }
 
-static Value vector3_cross(const std::vector<Value>& args) {
-    if(args.size() < 2 || !args[0].is_map() || !args[1].is_map()) {
-        return vector3_constructor({});
+static Value vector3_cross(NativeArgs args) {
+    if(args.size() < 2 || !is_object(args[0]) || !is_object(args[1])) {
+        return make_vector3(0.0, 0.0, 0.0);
     }
     double x1, y1, z1, x2, y2, z2;
     get_vector3_components(args[0], x1, y1, z1);
     get_vector3_components(args[1], x2, y2, z2);
-    return vector3_constructor({
-        Value::from_number(y1*z2 - z1*y2),
-        Value::from_number(z1*x2 - x1*z2),
-        Value::from_number(x1*y2 - y1*x2)
-    });
+    return make_vector3(y1*z2 - z1*y2, z1*x2 - x1*z2, x1*y2 - y1*x2);
 }
 
-static Value vector3_distance(const std::vector<Value>& args) {
-    if(args.size() < 2 || !args[0].is_map() || !args[1].is_map()) {
+static Value vector3_distance(NativeArgs args) {
+    if(args.size() < 2 || !is_object(args[0]) || !is_object(args[1])) {
         return Value::from_number(0.0);
     }
     double x1, y1, z1, x2, y2, z2;
@@ -195,17 +166,14 @@ static Value vector3_distance(const std::vector<Value>& args) {
 
 // Vector2 methods
 static void get_vector2_components(const Value& vec, double& x, double& y) {
-    if(!vec.is_map()) {
-        x = y = 0.0;
-        return;
-    }
-    const auto& map = vec.as_map();
-    x = map.count(normalize_identifier("x")) ? map.at(normalize_identifier("x")).as_number() : 0.0;
-    y = map.count(normalize_identifier("y")) ? map.at(normalize_identifier("y")).as_number() : 0.0;
+    static const char* const names[] = {"x", "y"};
+    double c[2] = {0.0, 0.0};
+    get_components(vec, names, 2, c);
+    x = c[0]; y = c[1];
 }
 
-static Value vector2_length(const std::vector<Value>& args) {
-    if(args.empty() || !args[0].is_map()) {
+static Value vector2_length(NativeArgs args) {
+    if(args.empty() || !is_object(args[0])) {
         return Value::from_number(0.0);
     }
     double x, y;
@@ -213,24 +181,21 @@ static Value vector2_length(const std::vector<Value>& args) {
     return Value::from_number(std::sqrt(x*x + y*y));
 }
 
-static Value vector2_normalize(const std::vector<Value>& args) {
-    if(args.empty() || !args[0].is_map()) {
-        return vector2_constructor({});
+static Value vector2_normalize(NativeArgs args) {
+    if(args.empty() || !is_object(args[0])) {
+        return make_vector2(0.0, 0.0);
     }
     double x, y;
     get_vector2_components(args[0], x, y);
     double len = std::sqrt(x*x + y*y);
     if(len < 0.0001) {
-        return vector2_constructor({});
+        return make_vector2(0.0, 0.0);
     }
-    return vector2_constructor({
-        Value::from_number(x / len),
-        Value::from_number(y / len)
-    });
+    return make_vector2(x / len, y / len);
 }
 
-static Value vector2_dot(const std::vector<Value>& args) {
-    if(args.size() < 2 || !args[0].is_map() || !args[1].is_map()) {
+static Value vector2_dot(NativeArgs args) {
+    if(args.size() < 2 || !is_object(args[0]) || !is_object(args[1])) {
         return Value::from_number(0.0);
     }
     double x1, y1, x2, y2;
@@ -240,220 +205,163 @@ static Value vector2_dot(const std::vector<Value>& args) {
 }
 
 // Color methods
-static Value color_brightness(const std::vector<Value>& args) {
-    if(args.empty() || !args[0].is_map()) {
+static void get_color_components(const Value& color, double& r, double& g, double& b, double& a) {
+    static const char* const names[] = {"r", "g", "b", "a"};
+    double c[4] = {0.0, 0.0, 0.0, 255.0};
+    get_components(color, names, 4, c);
+    r = c[0]; g = c[1]; b = c[2]; a = c[3];
+}
+
+static Value color_brightness(NativeArgs args) {
+    if(args.empty() || !is_object(args[0])) {
         return Value::from_number(0.0);
     }
-    const auto& color = args[0].as_map();
-    double r = color.count(normalize_identifier("r")) ? color.at(normalize_identifier("r")).as_number() : 0.0;
-    double g = color.count(normalize_identifier("g")) ? color.at(normalize_identifier("g")).as_number() : 0.0;
-    double b = color.count(normalize_identifier("b")) ? color.at(normalize_identifier("b")).as_number() : 0.0;
+    double r, g, b, a;
+    get_color_components(args[0], r, g, b, a);
     // Calculate perceived brightness (luminance)
     return Value::from_number(0.299*r + 0.587*g + 0.114*b);
 }
 
-static Value color_darken(const std::vector<Value>& args) {
-    if(args.empty() || !args[0].is_map()) {
-        return color_constructor({});
+static Value color_darken(NativeArgs args) {
+    if(args.empty() || !is_object(args[0])) {
+        return make_color(0.0, 0.0, 0.0, 255.0);
     }
-    const auto& color = args[0].as_map();
-    double r = color.count(normalize_identifier("r")) ? color.at(normalize_identifier("r")).as_number() : 0.0;
-    double g = color.count(normalize_identifier("g")) ? color.at(normalize_identifier("g")).as_number() : 0.0;
-    double b = color.count(normalize_identifier("b")) ? color.at(normalize_identifier("b")).as_number() : 0.0;
-    double a = color.count(normalize_identifier("a")) ? color.at(normalize_identifier("a")).as_number() : 255.0;
+    double r, g, b, a;
+    get_color_components(args[0], r, g, b, a);
     double factor = args.size() > 1 ? args[1].as_number() : 0.5;
     factor = std::max(0.0, std::min(1.0, factor));
-    return color_constructor({
-        Value::from_number(r * factor),
-        Value::from_number(g * factor),
-        Value::from_number(b * factor),
-        Value::from_number(a)
-    });
+    return make_color(r * factor, g * factor, b * factor, a);
 }
 
 // More Vector3 methods for chaining
-static Value vector3_scale(const std::vector<Value>& args) {
-    if(args.empty() || !args[0].is_map()) {
-        return vector3_constructor({});
+static Value vector3_scale(NativeArgs args) {
+    if(args.empty() || !is_object(args[0])) {
+        return make_vector3(0.0, 0.0, 0.0);
     }
     double x, y, z;
     get_vector3_components(args[0], x, y, z);
     double factor = args.size() > 1 ? args[1].as_number() : 1.0;
-    return vector3_constructor({
-        Value::from_number(x * factor),
-        Value::from_number(y * factor),
-        Value::from_number(z * factor)
-    });
+    return make_vector3(x * factor, y * factor, z * factor);
 }
 
-static Value vector3_add(const std::vector<Value>& args) {
-    if(args.size() < 2 || !args[0].is_map() || !args[1].is_map()) {
-        return vector3_constructor({});
+static Value vector3_add(NativeArgs args) {
+    if(args.size() < 2 || !is_object(args[0]) || !is_object(args[1])) {
+        return make_vector3(0.0, 0.0, 0.0);
     }
     double x1, y1, z1, x2, y2, z2;
     get_vector3_components(args[0], x1, y1, z1);
     get_vector3_components(args[1], x2, y2, z2);
-    return vector3_constructor({
-        Value::from_number(x1 + x2),
-        Value::from_number(y1 + y2),
-        Value::from_number(z1 + z2)
-    });
+    return make_vector3(x1 + x2, y1 + y2, z1 + z2);
 }
 
-static Value vector3_subtract(const std::vector<Value>& args) {
-    if(args.size() < 2 || !args[0].is_map() || !args[1].is_map()) {
-        return vector3_constructor({});
+static Value vector3_subtract(NativeArgs args) {
+    if(args.size() < 2 || !is_object(args[0]) || !is_object(args[1])) {
+        return make_vector3(0.0, 0.0, 0.0);
     }
     double x1, y1, z1, x2, y2, z2;
     get_vector3_components(args[0], x1, y1, z1);
     get_vector3_components(args[1], x2, y2, z2);
-    return vector3_constructor({
-        Value::from_number(x1 - x2),
-        Value::from_number(y1 - y2),
-        Value::from_number(z1 - z2)
-    });
+    return make_vector3(x1 - x2, y1 - y2, z1 - z2);
 }
 
-static Value vector3_multiply(const std::vector<Value>& args) {
-    if(args.empty() || !args[0].is_map()) {
-        return vector3_constructor({});
+static Value vector3_multiply(NativeArgs args) {
+    if(args.empty() || !is_object(args[0])) {
+        return make_vector3(0.0, 0.0, 0.0);
     }
     double x, y, z;
     get_vector3_components(args[0], x, y, z);
     double factor = args.size() > 1 ? args[1].as_number() : 1.0;
-    return vector3_constructor({
-        Value::from_number(x * factor),
-        Value::from_number(y * factor),
-        Value::from_number(z * factor)
-    });
+    return make_vector3(x * factor, y * factor, z * factor);
 }
 
-static Value vector3_lerp(const std::vector<Value>& args) {
-    if(args.size() < 3 || !args[0].is_map() || !args[1].is_map()) {
-        return vector3_constructor({});
+static Value vector3_lerp(NativeArgs args) {
+    if(args.size() < 3 || !is_object(args[0]) || !is_object(args[1])) {
+        return make_vector3(0.0, 0.0, 0.0);
     }
     double x1, y1, z1, x2, y2, z2;
     get_vector3_components(args[0], x1, y1, z1);
     get_vector3_components(args[1], x2, y2, z2);
     double t = args[2].as_number();
     t = std::max(0.0, std::min(1.0, t));
-    return vector3_constructor({
-        Value::from_number(x1 + (x2 - x1) * t),
-        Value::from_number(y1 + (y2 - y1) * t),
-        Value::from_number(z1 + (z2 - z1) * t)
-    });
+    return make_vector3(x1 + (x2 - x1) * t, y1 + (y2 - y1) * t, z1 + (z2 - z1) * t);
 }
 
 // More Vector2 methods
-static Value vector2_scale(const std::vector<Value>& args) {
-    if(args.empty() || !args[0].is_map()) {
-        return vector2_constructor({});
+static Value vector2_scale(NativeArgs args) {
+    if(args.empty() || !is_object(args[0])) {
+        return make_vector2(0.0, 0.0);
     }
     double x, y;
     get_vector2_components(args[0], x, y);
     double factor = args.size() > 1 ? args[1].as_number() : 1.0;
-    return vector2_constructor({
-        Value::from_number(x * factor),
-        Value::from_number(y * factor)
-    });
+    return make_vector2(x * factor, y * factor);
 }
 
-static Value vector2_add(const std::vector<Value>& args) {
-    if(args.size() < 2 || !args[0].is_map() || !args[1].is_map()) {
-        return vector2_constructor({});
+static Value vector2_add(NativeArgs args) {
+    if(args.size() < 2 || !is_object(args[0]) || !is_object(args[1])) {
+        return make_vector2(0.0, 0.0);
     }
     double x1, y1, x2, y2;
     get_vector2_components(args[0], x1, y1);
     get_vector2_components(args[1], x2, y2);
-    return vector2_constructor({
-        Value::from_number(x1 + x2),
-        Value::from_number(y1 + y2)
-    });
+    return make_vector2(x1 + x2, y1 + y2);
 }
 
-static Value vector2_subtract(const std::vector<Value>& args) {
-    if(args.size() < 2 || !args[0].is_map() || !args[1].is_map()) {
-        return vector2_constructor({});
+static Value vector2_subtract(NativeArgs args) {
+    if(args.size() < 2 || !is_object(args[0]) || !is_object(args[1])) {
+        return make_vector2(0.0, 0.0);
     }
     double x1, y1, x2, y2;
     get_vector2_components(args[0], x1, y1);
     get_vector2_components(args[1], x2, y2);
-    return vector2_constructor({
-        Value::from_number(x1 - x2),
-        Value::from_number(y1 - y2)
-    });
+    return make_vector2(x1 - x2, y1 - y2);
 }
 
-static Value vector2_lerp(const std::vector<Value>& args) {
-    if(args.size() < 3 || !args[0].is_map() || !args[1].is_map()) {
-        return vector2_constructor({});
+static Value vector2_lerp(NativeArgs args) {
+    if(args.size() < 3 || !is_object(args[0]) || !is_object(args[1])) {
+        return make_vector2(0.0, 0.0);
     }
     double x1, y1, x2, y2;
     get_vector2_components(args[0], x1, y1);
     get_vector2_components(args[1], x2, y2);
     double t = args[2].as_number();
     t = std::max(0.0, std::min(1.0, t));
-    return vector2_constructor({
-        Value::from_number(x1 + (x2 - x1) * t),
-        Value::from_number(y1 + (y2 - y1) * t)
-    });
+    return make_vector2(x1 + (x2 - x1) * t, y1 + (y2 - y1) * t);
 }
 
 // More Color methods
-static Value color_lighten(const std::vector<Value>& args) {
-    if(args.empty() || !args[0].is_map()) {
-        return color_constructor({});
+static Value color_lighten(NativeArgs args) {
+    if(args.empty() || !is_object(args[0])) {
+        return make_color(0.0, 0.0, 0.0, 255.0);
     }
-    const auto& color = args[0].as_map();
-    double r = color.count(normalize_identifier("r")) ? color.at(normalize_identifier("r")).as_number() : 0.0;
-    double g = color.count(normalize_identifier("g")) ? color.at(normalize_identifier("g")).as_number() : 0.0;
-    double b = color.count(normalize_identifier("b")) ? color.at(normalize_identifier("b")).as_number() : 0.0;
-    double a = color.count(normalize_identifier("a")) ? color.at(normalize_identifier("a")).as_number() : 255.0;
+    double r, g, b, a;
+    get_color_components(args[0], r, g, b, a);
     double factor = args.size() > 1 ? args[1].as_number() : 0.5;
     factor = std::max(0.0, std::min(1.0, factor));
-    return color_constructor({
-        Value::from_number(std::min(255.0, r + (255.0 - r) * factor)),
-        Value::from_number(std::min(255.0, g + (255.0 - g) * factor)),
-        Value::from_number(std::min(255.0, b + (255.0 - b) * factor)),
-        Value::from_number(a)
-    });
-}
-
-static Value color_mix(const std::vector<Value>& args) {
-    if(args.size() < 2 || !args[0].is_map() || !args[1].is_map()) {
-        return color_constructor({});
-    }
-    const auto& c1 = args[0].as_map();
-    const auto& c2 = args[1].as_map();
-    double r1 = c1.count(normalize_identifier("r")) ? c1.at(normalize_identifier("r")).as_number() : 0.0;
-    double g1 = c1.count(normalize_identifier("g")) ? c1.at(normalize_identifier("g")).as_number() : 0.0;
-    double b1 = c1.count(normalize_identifier("b")) ? c1.at(normalize_identifier("b")).as_number() : 0.0;
-    double a1 = c1.count(normalize_identifier("a")) ? c1.at(normalize_identifier("a")).as_number() : 255.0;
-    double r2 = c2.count(normalize_identifier("r")) ? c2.at(normalize_identifier("r")).as_number() : 0.0;
-    double g2 = c2.count(normalize_identifier("g")) ? c2.at(normalize_identifier("g")).as_number() : 0.0;
-    double b2 = c2.count(normalize_identifier("b")) ? c2.at(normalize_identifier("b")).as_number() : 0.0;
-    double a2 = c2.count(normalize_identifier("a")) ? c2.at(normalize_identifier("a")).as_number() : 255.0;
+    return make_color(r + (255.0 - r) * factor, g + (255.0 - g) * factor, b + (255.0 - b) * factor, a);
+}
+
+static Value color_mix(NativeArgs args) {
+    if(args.size() < 2 || !is_object(args[0]) || !is_object(args[1])) {
+        return make_color(0.0, 0.0, 0.0, 255.0);
+    }
+    double r1, g1, b1, a1, r2, g2, b2, a2;
+    get_color_components(args[0], r1, g1, b1, a1);
+    get_color_components(args[1], r2, g2, b2, a2);
     double t = args.size() > 2 ? args[2].as_number() : 0.5;
     t = std::max(0.0, std::min(1.0, t));
-    return color_constructor({
-        Value::from_number(r1 + (r2 - r1) * t),
-        Value::from_number(g1 + (g2 - g1) * t),
-        Value::from_number(b1 + (b2 - b1) * t),
-        Value::from_number(a1 + (a2 - a1) * t)
-    });
+    return make_color(r1 + (r2 - r1) * t, g1 + (g2 - g1) * t, b1 + (b2 - b1) * t, a1 + (a2 - a1) * t);
 }
 
-static Value color_toHex(const std::vector<Value>& args) {
-    if(args.empty() || !args[0].is_map()) {
+static Value color_toHex(NativeArgs args) {
+    if(args.empty() || !is_object(args[0])) {
         return Value::from_string("#000000");
     }
-    const auto& color = args[0].as_map();
-    int r = static_cast<int>(color.count(normalize_identifier("r")) ? color.at(normalize_identifier("r")).as_number() : 0.0);
-    int g = static_cast<int>(color.count(normalize_identifier("g")) ? color.at(normalize_identifier("g")).as_number() : 0.0);
-    int b = static_cast<int>(color.count(normalize_identifier("b")) ? color.at(normalize_identifier("b")).as_number() : 0.0);
-    r = std::max(0, std::min(255, r));
-    g = std::max(0, std::min(255, g));
-    b = std::max(0, std::min(255, b));
+    double rd, gd, bd, ad;
+    get_color_components(args[0], rd, gd, bd, ad);
+    int r = std::max(0, std::min(255, static_cast<int>(rd)));
+    int g = std::max(0, std::min(255, static_cast<int>(gd)));
+    int b = std::max(0, std::min(255, static_cast<int>(bd)));
     char hex[8];
     std::snprintf(hex, sizeof(hex), "#%02X%02X%02X", r, g, b);
     return Value::from_string(hex);
@@ -0,0 +1,632 @@
+#include "bas/bytecode.hpp"
+#include <cctype>
+#include <stdexcept>
+
+using namespace bas;
+
+// Labels and variables are matched case-insensitively.
+static std::string fold_name(const std::string& name) {
+  std::string r;
+  r.reserve(name.size());
+  for (char c : name) r.push_back(static_cast<char>(std::tolower(static_cast<unsigned char>(c))));
+  return r;
+}
+
+std::unique_ptr<Chunk> BytecodeCompiler::compile_program(const Program& prog) {
+  auto out = std::make_unique<Chunk>();
+  out->name = "<main>";
+  chunk = out.get();
+  top_level = true;
+  body_kind.clear();
+  next_reg = 0;
+  loop_stack.clear();
+  labels.clear();
+  label_fixups.clear();
+  by_name.clear();
+  uses_gosub = false;
+  loop_state_regs = 0;
+  line = 0;
+  prescan(prog.stmts);
+  next_loop_reg = 0;
+  if (uses_gosub) next_reg = chunk->num_regs = loop_state_regs;
+
+  for (const auto& s : prog.stmts) {
+    if (dynamic_cast<const SubDecl*>(s.get()) || dynamic_cast<const FunctionDecl*>(s.get())) continue;
+    if (dynamic_cast<const End*>(s.get())) {
+      emit(Op::Halt);
+      continue;
+    }
+    compile_stmt(s.get());
+  }
+  emit(Op::Halt);
+  resolve_labels();
+  finish();
+  return out;
+}
+
+std::unique_ptr<Chunk> BytecodeCompiler::compile_body(const std::string& name, const std::string& kind,
+                                                      const std::vector<std::string>& params,
+                                                      const std::vector<std::unique_ptr<Stmt>>& body) {
+  auto out = std::make_unique<Chunk>();
+  out->name = name;
+  chunk = out.get();
+  top_level = false;
+  body_kind = kind;
+  next_reg = 0;
+  loop_stack.clear();
+  labels.clear();
+  label_fixups.clear();
+  by_name.clear();
+  uses_gosub = false;
+  loop_state_regs = 0;
+  line = 0;
+  prescan(body);
+  next_loop_reg = 0;
+  if (uses_gosub) next_reg = chunk->num_regs = loop_state_regs;
+  for (const auto& p : params) out->param_slots.push_back(slot_index(p));
+  compile_block(body);
+  emit(Op::RetNil);
+  resolve_labels();
+  finish();
+  return out;
+}
+
+int BytecodeCompiler::emit(Op op, int32_t a, int32_t b, int32_t c) {
+  chunk->code.push_back(Instr{op, a, b, c});
+  chunk->loop_at.push_back(current_loop());
+  chunk->line_at.push_back(line);
+  return here() - 1;
+}
+
+void BytecodeCompiler::patch(int at, int target) {
+  Instr& in = chunk->code[at];
+  switch (in.op) {
+    case Op::Jmp:
+    case Op::Gosub:
+      in.a = target; break;
+    case Op::JmpIfFalse:
+    case Op::JmpIfTrue:
+    case Op::JmpIfNotNil:
+      in.b = target; break;
+    case Op::ForPrep:
+    case Op::ForLoop:
+    case Op::ForEachNext:
+      in.c = target; break;
+    default:
+      throw std::logic_error("bytecode: patch on non-branch instruction");
+  }
+}
+
+int BytecodeCompiler::alloc_reg() {
+  int r = next_reg++;
+  if (next_reg > chunk->num_regs) chunk->num_regs = next_reg;
+  return r;
+}
+
+int BytecodeCompiler::loop_regs(int n) {
+  if (!uses_gosub) {
+    int first = next_reg;
+    for (int i = 0; i < n; ++i) (void)alloc_reg();
+    return first;
+  }
+  int first = next_loop_reg;
+  next_loop_reg += n;
+  return first;
+}
+
+int BytecodeCompiler::const_index(Value v) {
+  chunk->consts.push_back(std::move(v));
+  return static_cast<int>(chunk->consts.size()) - 1;
+}
+
+int BytecodeCompiler::name_index(const std::string& name) {
+  const Symbol sym = intern(name);
+  for (size_t i = 0; i < chunk->names.size(); ++i) {
+    if (chunk->names[i] == sym) return static_cast<int>(i);
+  }
+  chunk->names.push_back(sym);
+  return static_cast<int>(chunk->names.size()) - 1;
+}
+
+int BytecodeCompiler::slot_index(const std::string& name) {
+  std::string key = fold_name(name);
+  if (by_name.count(key)) return -1;
+  return chunk->frame.add(key);
+}
+
+int BytecodeCompiler::store_target(const std::string& name) {
+  int slot = slot_index(name);
+  return slot >= 0 ? slot : -1 - name_index(name);
+}
+
+void BytecodeCompiler::resolve_labels() {
+  chunk->labels = labels;
+  for (const auto& [at, name] : label_fixups) {
+    auto it = labels.find(fold_name(name));
+    if (it == labels.end()) {
+      // Resolved lazily so a missing label only fails when the jump runs.
+      chunk->code[at] = Instr{Op::Fail, const_index(Value::from_string("Label not found: " + name)), 0, 0};
+    } else {
+      chunk->code[at].a = it->second;
+    }
+  }
+}
+
+void BytecodeCompiler::prescan(const std::vector<std::unique_ptr<Stmt>>& body) {
+  for (const auto& s : body) {
+    if (auto gd = dynamic_cast<const GlobalDecl*>(s.get())) {
+      for (const auto& n : gd->names) by_name.insert(fold_name(n));
+    } else if (dynamic_cast<const Gosub*>(s.get())) {
+      uses_gosub = true;
+    } else if (auto ic = dynamic_cast<const IfChain*>(s.get())) {
+      for (const auto& br : ic->branches) prescan(br.body);
+      prescan(ic->elseBody);
+    } else if (auto it = dynamic_cast<const IfThenEndIf*>(s.get())) {
+      prescan(it->body);
+    } else if (auto w = dynamic_cast<const WhileWend*>(s.get())) {
+      prescan(w->body);
+    } else if (auto f = dynamic_cast<const ForNext*>(s.get())) {
+      loop_state_regs += 3;
+      prescan(f->body);
+    } else if (auto fe = dynamic_cast<const ForEach*>(s.get())) {
+      loop_state_regs += 2;
+      prescan(fe->body);
+    } else if (auto d = dynamic_cast<const DoLoop*>(s.get())) {
+      prescan(d->body);
+    } else if (auto ru = dynamic_cast<const RepeatUntil*>(s.get())) {
+      prescan(ru->body);
+    } else if (auto sc = dynamic_cast<const SelectCaseStmt*>(s.get())) {
+      for (const auto& br : sc->branches) prescan(br.body);
+    }
+  }
+}
+
+int BytecodeCompiler::push_loop(const std::string& kind) {
+  LoopContext ctx;
+  ctx.kind = kind;
+  ctx.parent = current_loop();
+  chunk->loops.push_back(ctx);
+  int idx = static_cast<int>(chunk->loops.size()) - 1;
+  loop_stack.push_back(LoopScope{idx, {}, {}});
+  return idx;
+}
+
+BytecodeCompiler::LoopScope BytecodeCompiler::end_loop() {
+  LoopScope scope = std::move(loop_stack.back());
+  loop_stack.pop_back();
+  return scope;
+}
+
+void BytecodeCompiler::close_loop(LoopScope scope, int break_target, int continue_target) {
+  chunk->loops[scope.ctx].break_target = break_target;
+  chunk->loops[scope.ctx].continue_target = continue_target;
+  for (int at : scope.breaks) patch(at, break_target);
+  for (int at : scope.continues) patch(at, continue_target);
+}
+
+void BytecodeCompiler::finish() {
+  chunk = nullptr;
+}
+
+void BytecodeCompiler::compile_block(const std::vector<std::unique_ptr<Stmt>>& body) {
+  // Code the enclosing statement emits after its block keeps its own line
+  const int outer_line = line;
+  for (const auto& s : body) compile_stmt(s.get());
+  line = outer_line;
+}
+
+void BytecodeCompiler::compile_fallback(const Stmt* s) {
+  chunk->stmts.push_back(s);
+  emit(Op::Exec, static_cast<int32_t>(chunk->stmts.size()) - 1);
+}
+
+void BytecodeCompiler::compile_signal(SignalKind kind, const std::string& target) {
+  if (kind == SignalKind::Exit) {
+    if (!top_level && target == body_kind) {
+      emit(Op::RetNil);
+      return;
+    }
+    for (auto it = loop_stack.rbegin(); it != loop_stack.rend(); ++it) {
+      if (exit_matches(chunk->loops[it->ctx].kind, target)) {
+        it->breaks.push_back(emit(Op::Jmp, -1));
+        return;
+      }
+    }
+  } else if (!loop_stack.empty()) {
+    auto& scope = loop_stack.back();
+    if (kind == SignalKind::Break) scope.breaks.push_back(emit(Op::Jmp, -1));
+    else scope.continues.push_back(emit(Op::Jmp, -1));
+    return;
+  }
+  // No enclosing loop in this chunk: raise the signal like the tree-walker does
+  emit(Op::Signal, static_cast<int32_t>(kind), name_index(target));
+}
+
+void BytecodeCompiler::compile_stmt(const Stmt* s) {
+  const int mark = next_reg;
+  if (s->line > 0) line = s->line;
+  if (auto p = dynamic_cast<const Print*>(s)) {
+    int r = alloc_reg();
+    compile_expr(p->value.get(), r);
+    emit(Op::Print, r);
+  } else if (auto pc = dynamic_cast<const PrintC*>(s)) {
+    int r = alloc_reg();
+    compile_expr(pc->value.get(), r);
+    emit(Op::PrintC, r);
+  } else if (auto l = dynamic_cast<const Let*>(s)) {
+    int slot = slot_index(l->name);
+    if (slot >= 0) emit(Op::DeclSlot, slot);
+    else emit(Op::DeclVar, name_index(l->name));
+    int r = alloc_reg();
+    compile_expr(l->value.get(), r);
+    if (slot >= 0) emit(Op::SetSlot, slot, r);
+    else emit(Op::SetVar, name_index(l->name), r);
+  } else if (auto a = dynamic_cast<const Assign*>(s)) {
+    if (auto c = dynamic_cast<const Call*>(a->value.get()); c && c->namedArgs.empty()
+        && compile_inplace(c->callee, c->args, &a->name)) {
+      return;
+    }
+    int r = alloc_reg();
+    compile_expr(a->value.get(), r);
+    int slot = slot_index(a->name);
+    if (slot >= 0) emit(Op::SetSlot, slot, r);
+    else emit(Op::SetVar, name_index(a->name), r);
+  } else if (auto es = dynamic_cast<const ExprStmt*>(s)) {
+    if (auto c = dynamic_cast<const Call*>(es->expr.get()); c && c->namedArgs.empty()
+        && compile_inplace(c->callee, c->args, nullptr)) {
+      return;
+    }
+    int r = alloc_reg();
+    compile_expr(es->expr.get(), r);
+  } else if (auto cs = dynamic_cast<const CallStmt*>(s)) {
+    if (!compile_inplace(cs->name, cs->args, nullptr)) compile_call(cs->name, cs->args, -1, true);
+  } else if (auto ic = dynamic_cast<const IfChain*>(s)) {
+    std::vector<int> to_end;
+    for (const auto& br : ic->branches) {
+      int r = alloc_reg();
+      compile_expr(br.cond.get(), r);
+      free_to(mark);
+      int skip = emit(Op::JmpIfFalse, r, -1);
+      compile_block(br.body);
+      to_end.push_back(emit(Op::Jmp, -1));
+      patch(skip, here());
+    }
+    if (ic->hasElse) compile_block(ic->elseBody);
+    for (int at : to_end) patch(at, here());
+  } else if (auto it = dynamic_cast<const IfThenEndIf*>(s)) {
+    int r = alloc_reg();
+    compile_expr(it->cond.get(), r);
+    free_to(mark);
+    int skip = emit(Op::JmpIfFalse, r, -1);
+    compile_block(it->body);
+    patch(skip, here());
+  } else if (auto w = dynamic_cast<const WhileWend*>(s)) {
+    int top = here();
+    int r = alloc_reg();
+    compile_expr(w->cond.get(), r);
+    free_to(mark);
+    int exit = emit(Op::JmpIfFalse, r, -1);
+    push_loop("while");
+    compile_block(w->body);
+    LoopScope scope = end_loop();
+    emit(Op::Jmp, top);
+    patch(exit, here());
+    close_loop(std::move(scope), here(), top);
+  } else if (auto f = dynamic_cast<const ForNext*>(s); f && slot_index(f->var) >= 0) {
+    int loop = loop_regs(3);
+    compile_expr(f->init.get(), loop);
+    compile_expr(f->limit.get(), loop + 1);
+    if (f->step) compile_expr(f->step.get(), loop + 2);
+    else emit(Op::LoadK, loop + 2, const_index(Value::from_int(1)));
+    int slot = slot_index(f->var);
+    int prep = emit(Op::ForPrep, loop, slot, -1);
+    push_loop("for");
+    int body = here();
+    compile_block(f->body);
+    LoopScope scope = end_loop();
+    int cont = here();
+    emit(Op::ForLoop, loop, slot, body);
+    patch(prep, here());
+    close_loop(std::move(scope), here(), cont);
+  } else if (auto fe = dynamic_cast<const ForEach*>(s)) {
+    int loop = loop_regs(2);
+    compile_expr(fe->collection.get(), loop);
+    emit(Op::LoadK, loop + 1, const_index(Value::from_int(0)));
+    int next = emit(Op::ForEachNext, loop, store_target(fe->var), -1);
+    push_loop("for");
+    compile_block(fe->body);
+    LoopScope scope = end_loop();
+    emit(Op::Jmp, next);
+    patch(next, here());
+    close_loop(std::move(scope), here(), next);
+  } else if (auto ai = dynamic_cast<const AssignIndex*>(s); ai && !ai->indices.empty()) {
+    const int base = next_reg;
+    for (const auto& ie : ai->indices) {
+      int r = alloc_reg();
+      compile_expr(ie.get(), r);
+    }
+    compile_expr(ai->value.get(), alloc_reg());
+    emit(Op::SetIndex, store_target(ai->name), base, static_cast<int32_t>(ai->indices.size()));
+  } else if (auto am = dynamic_cast<const AssignMember*>(s)) {
+    // A variable is updated in place; any other object is a temporary
+    auto var = dynamic_cast<const Variable*>(am->object.get());
+    const int base = alloc_reg();
+    if (!var) compile_expr(am->object.get(), base);
+    compile_expr(am->value.get(), alloc_reg());
+    chunk->stmts.push_back(s);
+    emit(Op::SetField, var ? store_target(var->name) : kNoStoreTarget, base,
+         static_cast<int32_t>(chunk->stmts.size()) - 1);
+  } else if (auto sc = dynamic_cast<const SelectCaseStmt*>(s)) {
+    // The tests run in branch order and the first match wins; ELSE runs
+    // when none matches, wherever it is written.
+    const int sel = alloc_reg();
+    const int t = alloc_reg();
+    const int u = alloc_reg();
+    compile_expr(sc->selector.get(), sel);
+    std::vector<std::vector<int>> hits(sc->branches.size());
+    const CaseBranch* else_branch = nullptr;
+    for (size_t i = 0; i < sc->branches.size(); ++i) {
+      const CaseBranch& br = sc->branches[i];
+      if (br.isElse) {
+        if (!else_branch) else_branch = &br;
+      } else if (br.isRel) {
+        Op op;
+        switch (br.relOp) {
+          case Tok::Eq: op = Op::Eq; break;
+          case Tok::Neq: op = Op::Neq; break;
+          case Tok::Lt: op = Op::Lt; break;
+          case Tok::Lte: op = Op::Lte; break;
+          case Tok::Gt: op = Op::Gt; break;
+          case Tok::Gte: op = Op::Gte; break;
+          default: continue;  // never matches
+        }
+        compile_expr(br.relExpr.get(), t);
+        emit(op, t, sel, t);
+        hits[i].push_back(emit(Op::JmpIfTrue, t, -1));
+      } else if (br.isRange) {
+        compile_expr(br.rangeStart.get(), t);
+        compile_expr(br.rangeEnd.get(), u);
+        emit(Op::Gte, t, sel, t);
+        emit(Op::Lte, u, sel, u);
+        emit(Op::And, t, t, u);
+        hits[i].push_back(emit(Op::JmpIfTrue, t, -1));
+      } else {
+        for (const auto& v : br.values) {
+          compile_expr(v.get(), t);
+          emit(Op::Eq, t, sel, t);
+          hits[i].push_back(emit(Op::JmpIfTrue, t, -1));
+        }
+      }
+    }
+    free_to(mark);
+    int no_match = emit(Op::Jmp, -1);
+    std::vector<int> to_end;
+    for (size_t i = 0; i < sc->branches.size(); ++i) {
+      if (sc->branches[i].isElse) continue;
+      for (int at : hits[i]) patch(at, here());
+      compile_block(sc->branches[i].body);
+      to_end.push_back(emit(Op::Jmp, -1));
+    }
+    patch(no_match, here());
+    if (else_branch) compile_block(else_branch->body);
+    for (int at : to_end) patch(at, here());
+  } else if (auto d = dynamic_cast<const DoLoop*>(s)) {
+    push_loop("do");
+    int top = here();
+    compile_block(d->body);
+    LoopScope scope = end_loop();
+    int cont = here();
+    std::vector<int> exits;
+    if (d->hasUntil) {
+      int r = alloc_reg();
+      compile_expr(d->untilCond.get(), r);
+      free_to(mark);
+      exits.push_back(emit(Op::JmpIfTrue, r, -1));
+    }
+    if (d->hasWhile) {
+      int r = alloc_reg();
+      compile_expr(d->whileCond.get(), r);
+      free_to(mark);
+      exits.push_back(emit(Op::JmpIfFalse, r, -1));
+    }
+    emit(Op::Jmp, top);
+    for (int at : exits) patch(at, here());
+    close_loop(std::move(scope), here(), cont);
+  } else if (auto ru = dynamic_cast<const RepeatUntil*>(s)) {
+    push_loop("repeat");
+    int top = here();
+    compile_block(ru->body);
+    LoopScope scope = end_loop();
+    int cont = here();
+    int r = alloc_reg();
+    compile_expr(ru->cond.get(), r);
+    free_to(mark);
+    emit(Op::JmpIfFalse, r, top);
+    close_loop(std::move(scope), here(), cont);
+  } else if (auto lbl = dynamic_cast<const Label*>(s)) {
+    if (!labels.emplace(fold_name(lbl->name), here()).second) {
+      throw std::runtime_error("Duplicate label: " + lbl->name);
+    }
+  } else if (auto gt = dynamic_cast<const Goto*>(s)) {
+    label_fixups.emplace_back(emit(Op::Jmp, -1), gt->label);
+  } else if (auto gs = dynamic_cast<const Gosub*>(s)) {
+    label_fixups.emplace_back(emit(Op::Gosub, -1), gs->label);
+  } else if (dynamic_cast<const Return*>(s) && top_level) {
+    // RETURN from GOSUB; without one pending it behaves like a plain RETURN
+    emit(Op::GosubReturn);
+    compile_fallback(s);
+  } else if (auto ret = dynamic_cast<const Return*>(s)) {
+    if (uses_gosub) emit(Op::GosubReturn);
+    if (ret->value) {
+      int r = alloc_reg();
+      compile_expr(ret->value.get(), r);
+      emit(Op::Ret, r);
+    } else {
+      emit(Op::RetNil);
+    }
+  } else if (auto y = dynamic_cast<const YieldStmt*>(s)) {
+    int r = -1;
+    if (y->value) {
+      r = alloc_reg();
+      compile_expr(y->value.get(), r);
+    }
+    emit(Op::Yield, r);
+  } else if (auto aw = dynamic_cast<const AwaitStmt*>(s)) {
+    int r = alloc_reg();
+    compile_expr(aw->expression.get(), r);
+    emit(Op::Await, r);
+  } else if (dynamic_cast<const Break*>(s)) {
+    compile_signal(SignalKind::Break, "");
+  } else if (dynamic_cast<const Continue*>(s)) {
+    compile_signal(SignalKind::Continue, "");
+  } else if (auto ex = dynamic_cast<const Exit*>(s)) {
+    compile_signal(SignalKind::Exit, ex->target);
+  } else if (dynamic_cast<const SubDecl*>(s) || dynamic_cast<const FunctionDecl*>(s) ||
+             dynamic_cast<const ImportStmt*>(s)) {
+    // Collected before execution / expanded before interpretation
+  } else {
+    compile_fallback(s);
+  }
+  free_to(mark);
+}
+
+bool BytecodeCompiler::compile_inplace(const std::string& name, const std::vector<std::unique_ptr<Expr>>& args,
+                                       const std::string* target) {
+  if (args.empty()) return false;
+  auto var = dynamic_cast<const Variable*>(args[0].get());
+  if (!var || (target && fold_name(var->name) != fold_name(*target))) return false;
+  const int base = next_reg;
+  for (const auto& a : args) {
+    int r = alloc_reg();
+    compile_expr(a.get(), r);
+  }
+  chunk->calls.push_back(CallSite{name, static_cast<int>(args.size()), var->sym, target != nullptr});
+  emit(Op::CallInPlace, 0, static_cast<int32_t>(chunk->calls.size()) - 1, base);
+  free_to(base);
+  return true;
+}
+
+void BytecodeCompiler::compile_call(const std::string& name, const std::vector<std::unique_ptr<Expr>>& args,
+                                    int dst, bool stmt) {
+  const int base = next_reg;
+  for (const auto& a : args) {
+    int r = alloc_reg();
+    compile_expr(a.get(), r);
+  }
+  chunk->calls.push_back(CallSite{name, static_cast<int>(args.size())});
+  int site = static_cast<int>(chunk->calls.size()) - 1;
+  if (stmt) emit(Op::CallStmt, 0, site, base);
+  else emit(Op::Call, dst, site, base);
+  free_to(base);
+}
+
+void BytecodeCompiler::compile_expr(const Expr* e, int dst) {
+  const int mark = next_reg;
+  if (auto lit = dynamic_cast<const Literal*>(e)) {
+    if (lit->value.is_nil()) emit(Op::LoadNil, dst);
+    else emit(Op::LoadK, dst, const_index(lit->value));
+    return;
+  }
+  if (auto v = dynamic_cast<const Variable*>(e)) {
+    int slot = slot_index(v->name);
+    if (slot >= 0) emit(Op::GetSlot, dst, slot);
+    else emit(Op::GetVar, dst, name_index(v->name));
+    return;
+  }
+  if (auto u = dynamic_cast<const Unary*>(e)) {
+    Op op;
+    switch (u->op) {
+      case Tok::Minus: op = Op::Neg; break;
+      case Tok::Plus: op = Op::Pos; break;
+      case Tok::Not: op = Op::Not; break;
+      case Tok::BitNot: op = Op::BitNot; break;
+      default: {
+        chunk->exprs.push_back(e);
+        emit(Op::Eval, dst, static_cast<int32_t>(chunk->exprs.size()) - 1);
+        return;
+      }
+    }
+    compile_expr(u->right.get(), dst);
+    emit(op, dst, dst);
+    return;
+  }
+  if (auto b = dynamic_cast<const Binary*>(e)) {
+    Op op;
+    switch (b->op) {
+      case Tok::Plus: op = Op::Add; break;
+      case Tok::Minus: op = Op::Sub; break;
+      case Tok::Star: op = Op::Mul; break;
+      case Tok::Slash: op = Op::Div; break;
+      case Tok::IntDiv: op = Op::IntDiv; break;
+      case Tok::Power: op = Op::Pow; break;
+      case Tok::Mod: op = Op::Mod; break;
+      case Tok::Eq: op = Op::Eq; break;
+      case Tok::Neq: op = Op::Neq; break;
+      case Tok::Lt: op = Op::Lt; break;
+      case Tok::Lte: op = Op::Lte; break;
+      case Tok::Gt: op = Op::Gt; break;
+      case Tok::Gte: op = Op::Gte; break;
+      case Tok::And: op = Op::And; break;
+      case Tok::Or: op = Op::Or; break;
+      case Tok::Xor: op = Op::Xor; break;
+      default: {
+        chunk->exprs.push_back(e);
+        emit(Op::Eval, dst, static_cast<int32_t>(chunk->exprs.size()) - 1);
+        return;
+      }
+    }
+    compile_expr(b->left.get(), dst);
+    int rhs = alloc_reg();
+    compile_expr(b->right.get(), rhs);
+    emit(op, dst, dst, rhs);
+    free_to(mark);
+    return;
+  }
+  if (auto c = dynamic_cast<const Call*>(e); c && c->namedArgs.empty()) {
+    compile_call(c->callee, c->args, dst, false);
+    return;
+  }
+  if (auto idx = dynamic_cast<const Index*>(e)) {
+    compile_expr(idx->target.get(), dst);
+    int r = alloc_reg();
+    compile_expr(idx->index.get(), r);
+    emit(Op::Index, dst, dst, r);
+    free_to(mark);
+    return;
+  }
+  if (auto ma = dynamic_cast<const MemberAccess*>(e)) {
+    compile_expr(ma->object.get(), dst);
+    chunk->exprs.push_back(e);
+    emit(Op::GetField, dst, dst, static_cast<int32_t>(chunk->exprs.size()) - 1);
+    return;
+  }
+  if (auto arr = dynamic_cast<const ArrayLiteral*>(e)) {
+    const int base = next_reg;
+    for (const auto& el : arr->elements) {
+      int r = alloc_reg();
+      compile_expr(el.get(), r);
+    }
+    emit(Op::NewArray, dst, base, static_cast<int32_t>(arr->elements.size()));
+    free_to(mark);
+    return;
+  }
+  if (auto t = dynamic_cast<const TernaryExpr*>(e)) {
+    compile_expr(t->condition.get(), dst);
+    int skip = emit(Op::JmpIfFalse, dst, -1);
+    compile_expr(t->trueValue.get(), dst);
+    int done = emit(Op::Jmp, -1);
+    patch(skip, here());
+    compile_expr(t->falseValue.get(), dst);
+    patch(done, here());
+    return;
+  }
+  if (auto nc = dynamic_cast<const NullCoalesceExpr*>(e)) {
+    compile_expr(nc->left.get(), dst);
+    int done = emit(Op::JmpIfNotNil, dst, -1);
+    compile_expr(nc->right.get(), dst);
+    patch(done, here());
+    return;
+  }
+  chunk->exprs.push_back(e);
+  emit(Op::Eval, dst, static_cast<int32_t>(chunk->exprs.size()) - 1);
+}
@@ -0,0 +1,96 @@
+#include "bas/coroutines.hpp"
+#include <thread>
+
+using namespace bas;
+
+// ===== Futures =====
+
+namespace {
+// A handle owns its future through this function value, stored under
+// `_state`, so the state is freed with the last copy of the handle.
+// Calling it yields the result, or nil while pending.
+struct FutureRef : Callable {
+  std::shared_ptr<FutureState> state;
+  explicit FutureRef(std::shared_ptr<FutureState> s) : state(std::move(s)) {}
+  Value call(NativeArgs) const override {
+    return state->done.load(std::memory_order_acquire) ? state->result : Value::nil();
+  }
+};
+} // namespace
+
+Value bas::make_future(std::shared_ptr<FutureState> state){
+  Value::Map handle;
+  handle["_type"] = Value::from_string("future");
+  handle["_state"] = Value::from_callable(std::make_shared<FutureRef>(std::move(state)));
+  return Value::from_map(std::move(handle));
+}
+
+std::shared_ptr<FutureState> bas::find_future(const Value& handle){
+  if(!handle.is_map()) return nullptr;
+  const auto& m = handle.as_map();
+  auto type = m.find("_type");
+  auto state = m.find("_state");
+  if(type == m.end() || !type->second.is_string() || type->second.as_string() != "future") return nullptr;
+  if(state == m.end()) return nullptr;
+  auto ref = std::dynamic_pointer_cast<const FutureRef>(state->second.as_callable());
+  return ref ? ref->state : nullptr;
+}
+
+void bas::complete_future(FutureState& state, Value result){
+  state.result = std::move(result);
+  state.done.store(true, std::memory_order_release);
+}
+
+Value bas::run_async(std::function<Value()> work){
+  auto state = std::make_shared<FutureState>();
+  std::thread([state, work = std::move(work)]{
+    Value result;
+    try{
+      result = work();
+    } catch(const std::exception& e){
+      result = Value::from_string(std::string("Error: ") + e.what());
+    }
+    complete_future(*state, std::move(result));
+  }).detach();
+  return make_future(state);
+}
+
+// ===== Natives =====
+
+void bas::register_coroutine_functions(FunctionRegistry& R){
+  // COROUTINE_CREATE(name, args...) -> handle, resumed with COROUTINE_RESUME
+  R.add("COROUTINE_CREATE", NativeFn{"COROUTINE_CREATE", -1, [](NativeArgs a){
+    if(a.empty() || !a[0].is_string()) throw std::runtime_error("COROUTINE_CREATE: expected SUB or FUNCTION name");
+    return coroutine_create(a[0].as_string(), a.subspan(1), false);
+  }});
+  // COROUTINE_SPAWN(name, args...) -> handle, also resumed by COROUTINE_UPDATE
+  R.add("COROUTINE_SPAWN", NativeFn{"COROUTINE_SPAWN", -1, [](NativeArgs a){
+    if(a.empty() || !a[0].is_string()) throw std::runtime_error("COROUTINE_SPAWN: expected SUB or FUNCTION name");
+    return coroutine_create(a[0].as_string(), a.subspan(1), true);
+  }});
+  R.add("COROUTINE_RESUME", NativeFn{"COROUTINE_RESUME", 1, [](NativeArgs a){
+    return coroutine_resume(a[0]);
+  }});
+  R.add("COROUTINE_STATUS", NativeFn{"COROUTINE_STATUS", 1, [](NativeArgs a){
+    return Value::from_string(coroutine_status(a[0]));
+  }});
+  R.add("COROUTINE_CANCEL", NativeFn{"COROUTINE_CANCEL", 1, [](NativeArgs a){
+    coroutine_cancel(a[0]);
+    return Value::nil();
+  }});
+  // COROUTINE_UPDATE() -> number of scheduled coroutines still alive
+  R.add("COROUTINE_UPDATE", NativeFn{"COROUTINE_UPDATE", 0, [](NativeArgs){
+    return Value::from_int(static_cast<long long>(coroutine_update()));
+  }});
+
+  R.add("FUTURE_DONE", NativeFn{"FUTURE_DONE", 1, [](NativeArgs a){
+    auto f = find_future(a[0]);
+    return Value::from_bool(f && f->done.load(std::memory_order_acquire));
+  }});
+  // FUTURE_RESULT(f) -> result, or nil while pending
+  R.add("FUTURE_RESULT", NativeFn{"FUTURE_RESULT", 1, [](NativeArgs a){
+    auto f = find_future(a[0]);
+    if(!f || !f->done.load(std::memory_order_acquire)) return Value::nil();
+    return f->result;
+  }});
+}
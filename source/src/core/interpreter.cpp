@@ -1,12 +1,17 @@
 #include "bas/ast.hpp"
+#include "bas/bytecode.hpp"
+#include "bas/symbol.hpp"
 #include "bas/runtime.hpp"
 #include "bas/namespace_registry.hpp"
 #include "bas/type_system.hpp"
+#include "bas/coroutines.hpp"
+#include "bas/profiler.hpp"
 #include <unordered_map>
 #include <unordered_set>
 #include <map>
 #include <stdexcept>
 #include <cmath>
+#include <climits>
 #include <cctype>
 #include <memory>
 #include <algorithm>
@@ -14,9 +19,33 @@
 #include <sstream>
 #include <locale>
 #include <cstdlib>
+#include <utility>
+#include <chrono>
+#include <thread>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/resource.h>
+#endif
 
 using namespace bas;
 
+// Keeps cold code out of the frames of hot recursive functions
+#if defined(__GNUC__) || defined(__clang__)
+#define NOINLINE __attribute__((noinline))
+#elif defined(_MSC_VER)
+#define NOINLINE __declspec(noinline)
+#else
+#define NOINLINE
+#endif
+
 // Global namespace registry (initialized by runtime)
 static NamespaceRegistry* g_namespace_registry = nullptr;
 
@@ -30,20 +59,113 @@ static std::string value_to_string_safe(const Value& v){
 }
 
 namespace {
-// Exception classes for control flow
-struct ReturnSignal { Value v; };
-struct BreakSignal {};
-struct ContinueSignal {};
-struct ExitSignal { std::string target; }; // "FOR", "WHILE", "SUB", "FUNCTION"
+// Completion status of a statement. RETURN/BREAK/CONTINUE/EXIT are passed
+// back to the enclosing loop or call as a value; the RETURN value and the
+// EXIT target travel in g_return_value / g_exit_target.
+enum class Flow : uint8_t { Normal, Break, Continue, Return, Exit, Yield };  // Yield: a coroutine body suspended
+Value g_return_value;
+std::string g_exit_target; // "for", "while", "do"/"loop", "repeat"/"until", "sub", "function"
+
+// BASIC scoping is dynamic, so a BREAK/CONTINUE/EXIT may leave a SUB or
+// FUNCTION and end a loop in its caller. Only that escape is thrown; the
+// caller's statement boundary turns it back into a Flow.
+struct FlowEscape { Flow flow; };
+
+// A GOTO inside a block unwinds to the statement loop of the enclosing top
+// level or SUB/FUNCTION body, which resolves its label; nothing else may
+// catch it. Blocks the VM runs through the tree-walker raise GOSUB this way too.
+struct LabelJump { const Stmt* stmt; };
+
+// True when `f` terminates a loop of the given kind.
+bool leaves_loop(Flow f, const char* kind) {
+  return f == Flow::Break || (f == Flow::Exit && exit_matches(kind, g_exit_target));
+}
+
+// Storage for the slots and registers of running calls, kept like the
+// arguments of ArgFrame: a shared stack reserved once that never grows, and a
+// buffer of its own for a frame that does not fit. Elements are handed out
+// cleared and released in LIFO order. Frames that outlive their call
+// (coroutines, closures, the global frame) use own() instead.
+template <typename T>
+class FrameBuffer {
+public:
+  FrameBuffer() = default;
+  FrameBuffer(const FrameBuffer&) = delete;
+  FrameBuffer& operator=(const FrameBuffer&) = delete;
+  ~FrameBuffer(){ if(stacked_) stack().resize(mark_); }
+  T* push(size_t n){
+    std::vector<T>& s = stack();
+    if(n == 0) return nullptr;
+    if(s.capacity() - s.size() < n) return own(n);
+    mark_ = s.size();
+    stacked_ = true;
+    s.resize(mark_ + n);
+    return s.data() + mark_;
+  }
+  T* own(size_t n){
+    own_ = std::make_unique<T[]>(n);
+    return own_.get();
+  }
+private:
+  static std::vector<T>& stack(){
+    static std::vector<T> s = []{ std::vector<T> v; v.reserve(1u << 16); return v; }();
+    return s;
+  }
+  size_t mark_{0};
+  bool stacked_{false};
+  std::unique_ptr<T[]> own_;
+};
 
 // Env struct must be defined before helper functions that use Env::up()
+// Variables are keyed by interned symbol; the std::string overloads intern
+// the name first.
 struct Env {
-  std::unordered_map<std::string, Value> vars;
-  std::unordered_set<std::string> consts;
-  std::unordered_set<std::string> declared;
-  std::unordered_set<std::string> globals_here; // names in this scope that should bind to root env
+  // Names without a frame slot, constants, declarations and GLOBAL names.
+  // Most call frames need none of them, so the tables are allocated on first use.
+  struct Names {
+    std::unordered_map<Symbol, Value> vars;
+    std::unordered_set<Symbol> consts;
+    std::unordered_set<Symbol> declared;
+    std::unordered_set<Symbol> globals_here; // names in this scope that should bind to root env
+  };
+  std::unique_ptr<Names> names;
   bool strict{false};
   const Env* parent{nullptr};
+  // Frame slots assigned by the bytecode resolver. Names in `layout` are
+  // stored here instead of `names->vars`; by-name access maps onto the same
+  // slots. SlotNotConst caches that no constant of the slot's name is
+  // visible; it is cleared when a constant is defined into the slot.
+  enum : uint8_t { SlotBound = 1, SlotDeclared = 2, SlotNotConst = 4 };
+  const FrameLayout* layout{nullptr};
+  Value* slots{nullptr};
+  uint8_t* slot_state{nullptr};
+  size_t inherited_consts{0}; // constants defined in parent frames (they cannot change while this frame lives)
+
+  Env() = default;
+  explicit Env(const Env* p) : strict(p ? p->strict : false), parent(p) {
+    if(p) inherited_consts = p->inherited_consts + p->const_count();
+  }
+  Env(const Env&) = delete;
+  Env& operator=(const Env&) = delete;
+  // Slots owned by this frame
+  void bind_layout(const FrameLayout& l){
+    layout = &l;
+    slots = slot_values.own(l.names.size());
+    slot_state = slot_flags.own(l.names.size());
+  }
+  // Slots on the shared frame stack, for a call frame that is released
+  // before its caller continues
+  void bind_call_layout(const FrameLayout& l){
+    layout = &l;
+    slots = slot_values.push(l.names.size());
+    slot_state = slot_flags.push(l.names.size());
+  }
+  Names& names_here(){
+    if(!names) names = std::make_unique<Names>();
+    return *names;
+  }
+  size_t const_count() const { return names ? names->consts.size() : 0; }
+  size_t global_count() const { return names ? names->globals_here.size() : 0; }
   // Normalize identifier to lowercase for case-insensitive matching
   [[nodiscard]] static std::string normalize(const std::string& s){ 
     std::string r; 
@@ -53,71 +175,150 @@ struct Env {
   }
   // Legacy alias for backward compatibility (now normalizes to lowercase)
   [[nodiscard]] static std::string up(const std::string& s){ return normalize(s); }
-  bool is_declared_here(const std::string& ukey) const { return declared.find(ukey) != declared.end(); }
-  bool is_declared(const std::string& n) const {
-    auto key = up(n);
+  int slot_of(Symbol key) const { return layout ? layout->find(key) : -1; }
+  // Value bound in this frame (slot or map), or nullptr
+  const Value* find_here(Symbol key) const {
+    int s = slot_of(key);
+    if(s >= 0) return (slot_state[s] & SlotBound) ? &slots[s] : nullptr;
+    if(!names) return nullptr;
+    auto it = names->vars.find(key);
+    return it != names->vars.end() ? &it->second : nullptr;
+  }
+  Value* find_here(Symbol key){
+    return const_cast<Value*>(std::as_const(*this).find_here(key));
+  }
+  void store_here(Symbol key, Value v){
+    int s = slot_of(key);
+    if(s >= 0){
+      slots[s] = std::move(v);
+      slot_state[s] |= SlotBound;
+      return;
+    }
+    names_here().vars[key] = std::move(v);
+  }
+  template<typename F> void for_each_here(F&& f) const {
+    const size_t n = layout ? layout->names.size() : 0;
+    for(size_t i=0;i<n;++i) if(slot_state[i] & SlotBound) f(layout->names[i], slots[i]);
+    if(names) for(const auto& pair : names->vars) f(symbol_name(pair.first), pair.second);
+  }
+  bool is_declared_here(Symbol key) const {
+    int s = slot_of(key);
+    if(s >= 0) return (slot_state[s] & SlotDeclared) != 0;
+    return names && names->declared.count(key) != 0;
+  }
+  bool is_declared(Symbol key) const {
     if(is_declared_here(key)) return true;
-    return parent ? parent->is_declared(n) : false;
+    return parent ? parent->is_declared(key) : false;
+  }
+  void declare(Symbol key){
+    int s = slot_of(key);
+    if(s >= 0) slot_state[s] |= SlotDeclared;
+    else names_here().declared.insert(key);
   }
-  void declare(const std::string& n){ declared.insert(up(n)); }
-  bool is_global_here(const std::string& ukey) const { return globals_here.find(ukey) != globals_here.end(); }
+  bool is_global_here(Symbol key) const { return names && !names->globals_here.empty() && names->globals_here.count(key) != 0; }
   Env* root(){ Env* r = this; while(r->parent) r = const_cast<Env*>(r->parent); return r; }
   const Env* root() const { auto* r = this; while(r->parent) r = r->parent; return r; }
-  Value get(const std::string& n) const {
-    auto key = up(n);
-    // If marked GLOBAL in this scope, read from root env
+  Value get(Symbol key) const {
     if(is_global_here(key)){
       const Env* r = root();
-      auto it = r->vars.find(key);
-      if(it!=r->vars.end()) return it->second;
-      if(strict && !r->is_declared(n)){
-        throw std::runtime_error("Use of undeclared variable '" + key + "'");
+      if(auto v = r->find_here(key)) return *v;
+      if(strict && !r->is_declared(key)){
+        throw std::runtime_error("Use of undeclared variable '" + symbol_name(key) + "'");
       }
       return Value::nil();
     }
-    auto it = vars.find(key);
-    if(it!=vars.end()) return it->second;
-    if(parent) return parent->get(n);
-    if(strict && !is_declared(n)){
-      throw std::runtime_error("Use of undeclared variable '" + key + "'");
+    if(auto v = find_here(key)) return *v;
+    if(parent) return parent->get(key);
+    if(strict && !is_declared(key)){
+      throw std::runtime_error("Use of undeclared variable '" + symbol_name(key) + "'");
     }
     return Value::nil();
   }
-  bool is_const_here(const std::string& ukey) const { return consts.find(ukey) != consts.end(); }
-  bool is_const(const std::string& n) const {
-    auto key = up(n);
+  bool is_const_here(Symbol key) const { return names && names->consts.count(key) != 0; }
+  bool is_const(Symbol key) const {
+    if(const_count() == 0 && inherited_consts == 0) return false;
     if(is_const_here(key)) return true;
-    return parent ? parent->is_const(n) : false;
+    return parent ? parent->is_const(key) : false;
   }
-  void define_const(const std::string& n, Value v){
-    auto key = up(n);
-    // Defining a const shades any parent value; local const wins
-    vars[key] = std::move(v);
-    consts.insert(key);
-    declare(n);
+  void define_const(Symbol key, Value v){
+    store_here(key, std::move(v));
+    names_here().consts.insert(key);
+    if(int s = slot_of(key); s >= 0) slot_state[s] &= static_cast<uint8_t>(~SlotNotConst);
+    declare(key);
   }
-  void set(const std::string& n, Value v){
-    auto key = up(n);
+  void set(Symbol key, Value v){
     if(is_global_here(key)){
-      // Route assignment to root env but enforce const/strict using current scope's rules
       Env* r = root();
-      if(r->is_const(n)){
-        throw std::runtime_error("Assignment to constant '" + key + "'");
+      if(r->is_const(key)){
+        throw std::runtime_error("Assignment to constant '" + symbol_name(key) + "'");
       }
-      if(strict && !r->is_declared(n)){
-        throw std::runtime_error("Assignment to undeclared variable '" + key + "'");
+      if(strict && !r->is_declared(key)){
+        throw std::runtime_error("Assignment to undeclared variable '" + symbol_name(key) + "'");
       }
-      r->vars[key] = std::move(v);
+      r->store_here(key, std::move(v));
       return;
     }
     if(is_const(key)){
-      throw std::runtime_error("Assignment to constant '" + key + "'");
+      throw std::runtime_error("Assignment to constant '" + symbol_name(key) + "'");
+    }
+    if(strict && !is_declared(key)){
+      throw std::runtime_error("Assignment to undeclared variable '" + symbol_name(key) + "'");
+    }
+    store_here(key, std::move(v));
+  }
+  // Storage that set(key, ...) writes to, for in-place element updates. A name
+  // not yet bound in that frame is first bound to the value get(key) sees.
+  Value& lvalue(Symbol key){
+    Env* target = is_global_here(key) ? root() : this;
+    if(target->find_here(key) == nullptr || target->is_const(key) || (strict && !target->is_declared(key))){
+      set(key, get(key)); // binds the name, or throws the same errors as a plain assignment
+    }
+    return *target->find_here(key);
+  }
+  bool is_declared(const std::string& n) const { return is_declared(intern(n)); }
+  void declare(const std::string& n){ declare(intern(n)); }
+  Value get(const std::string& n) const { return get(intern(n)); }
+  bool is_const(const std::string& n) const { return is_const(intern(n)); }
+  void define_const(const std::string& n, Value v){ define_const(intern(n), std::move(v)); }
+  void set(const std::string& n, Value v){ set(intern(n), std::move(v)); }
+  Value& lvalue(const std::string& n){ return lvalue(intern(n)); }
+  // Slot accessors used by the VM. Resolved names are never GLOBAL in this
+  // frame, so the only slow paths are unbound reads and constant/strict checks.
+  Value get_slot(int s) const {
+    if(slot_state[s] & SlotBound) return slots[s];
+    Symbol key = layout->syms[s];
+    if(parent) return parent->get(key);
+    if(strict && !is_declared(key)){
+      throw std::runtime_error("Use of undeclared variable '" + layout->names[s] + "'");
     }
-    if(strict && !is_declared(n)){
-      throw std::runtime_error("Assignment to undeclared variable '" + key + "'");
+    return Value::nil();
+  }
+  // True when a write to slot `s` needs no constant or strict-mode check.
+  bool slot_writable(int s){
+    if(strict && !(slot_state[s] & SlotDeclared)) return false;
+    if(slot_state[s] & SlotNotConst) return true;
+    if(const_count() + inherited_consts != 0 && is_const(layout->syms[s])) return false;
+    slot_state[s] |= SlotNotConst;
+    return true;
+  }
+  void set_slot(int s, Value v){
+    if(!slot_writable(s)){
+      set(layout->syms[s], std::move(v));
+      return;
     }
-    vars[key]=std::move(v);
+    slots[s] = std::move(v);
+    slot_state[s] |= SlotBound;
   }
+  void declare_slot(int s){ slot_state[s] |= SlotDeclared; }
+  // Bound slot that set_slot() would overwrite without checks, for in-place
+  // updates; nullptr when the write must go through set_slot().
+  Value* slot_ref(int s){
+    if(!(slot_state[s] & SlotBound) || !slot_writable(s)) return nullptr;
+    return &slots[s];
+  }
+private:
+  FrameBuffer<Value> slot_values;
+  FrameBuffer<uint8_t> slot_flags;
 };
 
 // Helper function for deep property access
@@ -128,36 +329,18 @@ std::optional<Value> get_deep_property(const Value& obj, const std::string& path
     // Split path by dots for nested access
     size_t dotPos = path.find('.');
     if (dotPos == std::string::npos) {
-        // Simple property access
-        std::string key = Env::up(path);
-        auto it = map.find(key);
+        // Simple property access, in any case
+        auto it = map.find_any_case(path);
         if (it != map.end()) {
             return it->second;
         }
-        // Case-insensitive search
-        for (const auto& pair : map) {
-            if (Env::up(pair.first) == key) {
-                return pair.second;
-            }
-        }
         return std::nullopt;
     }
     
     // Nested access: get first part, then recurse
-    std::string first = path.substr(0, dotPos);
-    std::string rest = path.substr(dotPos + 1);
-    std::string key = Env::up(first);
-    auto it = map.find(key);
-    if (it == map.end()) {
-        // Case-insensitive search
-        for (const auto& pair : map) {
-            if (Env::up(pair.first) == key) {
-                return get_deep_property(pair.second, rest);
-            }
-        }
-        return std::nullopt;
-    }
-    return get_deep_property(it->second, rest);
+    auto it = map.find_any_case(std::string_view(path).substr(0, dotPos));
+    if (it == map.end()) return std::nullopt;
+    return get_deep_property(it->second, path.substr(dotPos + 1));
 }
 
 // Helper function for deep property assignment
@@ -168,17 +351,18 @@ bool set_deep_property(Value& obj, const std::string& path, const Value& val) {
     // Split path by dots for nested access
     size_t dotPos = path.find('.');
     if (dotPos == std::string::npos) {
-        // Simple property assignment
-        map[Env::up(path)] = val;
+        // Simple property assignment; a new field gets the folded name
+        auto it = map.find_any_case(path);
+        if (it != map.end()) it->second = val;
+        else map[Env::up(path)] = val;
         return true;
     }
     
     // Nested assignment: get/create first part, then recurse
     std::string first = path.substr(0, dotPos);
     std::string rest = path.substr(dotPos + 1);
-    std::string key = Env::up(first);
-    
-    auto it = map.find(key);
+    auto it = map.find_any_case(first);
+    std::string key = it == map.end() ? Env::up(first) : it->first;
     if (it == map.end() || !it->second.is_map()) {
         // Create nested map
         Value::Map nested;
@@ -192,12 +376,83 @@ bool set_deep_property(Value& obj, const std::string& path, const Value& val) {
 // Global storage for subroutines and functions
 static std::unordered_map<std::string, const SubDecl*> g_subs;
 static std::unordered_map<std::string, const FunctionDecl*> g_funcs;
-static std::unordered_map<std::string, size_t> g_labels; // Label name -> statement index
-static std::vector<size_t> g_gosub_stack; // Stack of return addresses for GOSUB
+
+// Registers and position of a running chunk. A coroutine keeps its state
+// between resumes; ordinary calls use a fresh one.
+struct ChunkState {
+  Value* regs{nullptr};
+  FrameBuffer<Value> reg_store;
+  std::vector<size_t> gosub_stack;
+  size_t pc{0};
+  bool resumable{false};  // YIELD/AWAIT suspend this chunk (a coroutine body)
+};
+
+// A SUB/FUNCTION body run as a coroutine. Its frame lives on the heap,
+// chained to the program's global frame.
+struct Coroutine {
+  enum class Status : uint8_t { Suspended, Waiting, Running, Done };
+  long long id{0};
+  std::string name;
+  const Chunk* chunk{nullptr};
+  std::unique_ptr<Env> env;
+  ChunkState state;
+  Status status{Status::Suspended};
+  // What a Waiting coroutine awaits: a future, another coroutine or a time
+  std::shared_ptr<FutureState> future;
+  long long awaited{0};
+  bool timed{false};
+  std::chrono::steady_clock::time_point wake{};
+};
+
+static std::unordered_map<long long, std::unique_ptr<Coroutine>> g_coroutines; // live coroutines by id
+static std::vector<long long> g_scheduled; // spawned coroutines, resumed by coroutine_update()
+static long long g_next_coroutine_id = 1;
+static Coroutine* g_coroutine = nullptr;  // innermost running coroutine
+static Value g_yield_value;
+static Env* g_global_env = nullptr;
+static FunctionRegistry* g_registry = nullptr;
+static bool g_debug_mode = false;
+
+// Statements a tree-walker GOTO/GOSUB jumps within: the program's top level
+// or a SUB/FUNCTION body, its labels resolved to statement indices once.
+struct JumpScope {
+  const std::vector<std::unique_ptr<Stmt>>* body{nullptr};
+  std::unordered_map<std::string, size_t> labels;  // folded name -> index
+
+  // Destination of a GOTO/GOSUB statement
+  [[nodiscard]] size_t target_of(const Stmt* jump) const {
+    const std::string& label = jump_label(jump);
+    auto it = labels.find(Env::up(label));
+    if(it == labels.end()) throw std::runtime_error("Label not found: " + label);
+    return it->second;
+  }
+  [[nodiscard]] static const std::string& jump_label(const Stmt* jump) {
+    if(auto gt = dynamic_cast<const Goto*>(jump)) return gt->label;
+    return static_cast<const Gosub*>(jump)->label;
+  }
+};
+
+static const JumpScope* g_jump_scope = nullptr;  // of the running tree-walker body, if any
+
+// Makes `scope` the running jump scope until the end of the enclosing block
+struct ScopedJumps {
+  const JumpScope* outer;
+  explicit ScopedJumps(const JumpScope* scope) : outer(g_jump_scope) { g_jump_scope = scope; }
+  ~ScopedJumps() { g_jump_scope = outer; }
+  ScopedJumps(const ScopedJumps&) = delete;
+  ScopedJumps& operator=(const ScopedJumps&) = delete;
+};
+
+static bool begin_await(Coroutine& co, const Value& awaitable);
+static void await_blocking(const Value& awaitable);
+static Value make_closure(const Env& env, const LambdaExpr* lambda);
+static uint64_t g_run = 0; // Incremented per interpret(); invalidates cached call targets
 
 // Forward declarations
 static Value eval(Env& env, FunctionRegistry& R, const Expr* e, bool debug_mode);
-static void exec(Env& env, FunctionRegistry& R, const Stmt* s, bool debug_mode);
+static Flow exec(Env& env, FunctionRegistry& R, const Stmt* s, bool debug_mode);
+static Flow exec_block(Env& env, FunctionRegistry& R, const std::vector<std::unique_ptr<Stmt>>& body, bool debug_mode);
+static Flow exec_gosub(Env& env, FunctionRegistry& R, const Gosub* gs, bool debug_mode);
 
 
 static double to_num(const Value& v) {
@@ -205,11 +460,117 @@ static double to_num(const Value& v) {
     if (v.is_nil()) return 0.0;
     return v.as_number();
 }
-static void call_sub(Env& caller, FunctionRegistry& R, const std::string& name, const std::vector<Value>& args, bool debug_mode);
-static Value call_func(Env& caller, FunctionRegistry& R, const std::string& name, 
-                       const std::vector<Value>& args, 
-                       const std::map<std::string, Value>& namedArgs,
-                       bool debug_mode);
+static void run_sub(Env& caller, FunctionRegistry& R, const SubDecl* sd, NativeArgs args, bool debug_mode);
+// Named arguments of the calls that have none
+static const std::map<std::string, Value> kNoNamedArgs;
+static Value run_func(Env& caller, FunctionRegistry& R, const FunctionDecl* fd,
+                      NativeArgs args,
+                      const std::map<std::string, Value>& namedArgs,
+                      bool debug_mode);
+
+// Resolve a call site's target: user SUBs shadow user FUNCTIONs, which shadow
+// natives. The result is cached in the node until the next program run or
+// registry change, so steady-state calls skip the name lookups.
+static const CallCache& resolve_call(CallCache& cache, FunctionRegistry& R, const std::string& name){
+  if(cache.run == g_run && cache.registry_version == R.version()) return cache;
+  cache.name = Env::up(name);
+  cache.sub = nullptr;
+  cache.func = nullptr;
+  cache.native = nullptr;
+  if(auto it = g_subs.find(cache.name); it != g_subs.end()) cache.sub = it->second;
+  else if(auto itf = g_funcs.find(cache.name); itf != g_funcs.end()) cache.func = itf->second;
+  else cache.native = R.find(cache.name);
+  cache.run = g_run;
+  cache.registry_version = R.version();
+  return cache;
+}
+
+// Function value held by the variable `name` (folded) as seen from `env`, or null.
+static std::shared_ptr<const Callable> callable_var(const Env& env, const std::string& name){
+  Symbol key = find_symbol(name);
+  if(key == 0) return nullptr;
+  for(const Env* e = &env; e; e = e->parent){
+    if(const Value* v = e->find_here(key)) return v->as_callable();
+  }
+  return nullptr;
+}
+
+// Call of a native or of a variable's function value. Kept out of invoke(),
+// which every SUB/FUNCTION call passes through.
+NOINLINE static Value invoke_value(Env& env, const CallCache& target, const std::string& name, NativeArgs args){
+  if(!target.native){
+    if(auto fn = callable_var(env, target.name)) return fn->call(args);
+  }
+  ProfileScope profile(name, target.native);
+  return call_native(target.native, name, args);
+}
+
+// Call a resolved target. SUBs produce NIL. A name that is no SUB, FUNCTION
+// or native may be a variable holding a function value.
+static Value invoke(Env& env, FunctionRegistry& R, const CallCache& target, const std::string& name,
+                    NativeArgs args, const std::map<std::string, Value>& namedArgs, bool debug_mode){
+  if(target.sub){
+    run_sub(env, R, target.sub, args, debug_mode);
+    return Value::nil();
+  }
+  if(target.func) return run_func(env, R, target.func, args, namedArgs, debug_mode);
+  return invoke_value(env, target, name, args);
+}
+
+// Native whose in-place form can stand in for a call of `name` with `argc`
+// arguments; user SUBs/FUNCTIONs of the same name take precedence.
+static const NativeFn* inplace_native(FunctionRegistry& R, CallCache& cache, const std::string& name, size_t argc){
+  const NativeFn* f = resolve_call(cache, R, name).native;
+  if(!f || !f->inplace) return nullptr;
+  if(f->arity >= 0 && static_cast<size_t>(f->arity) != argc) return nullptr; // call() reports the error
+  return f;
+}
+
+// Argument storage for calls made by the tree-walker. The stack's capacity is
+// reserved once and never grows, so the span a callee receives stays valid
+// while nested calls push above it; arguments that do not fit go to a
+// buffer owned by the frame.
+class ArgFrame {
+public:
+  explicit ArgFrame(size_t n) : mark_(stack().size()), spilled_(stack().capacity() - mark_ < n) {
+    if(spilled_) spill_.reserve(n);
+  }
+  ArgFrame(const ArgFrame&) = delete;
+  ArgFrame& operator=(const ArgFrame&) = delete;
+  ~ArgFrame(){ if(!spilled_) stack().resize(mark_); }
+  void push(Value v){
+    if(spilled_) spill_.push_back(std::move(v));
+    else stack().push_back(std::move(v));
+  }
+  [[nodiscard]] NativeArgs args() const {
+    if(spilled_) return spill_;
+    return NativeArgs(stack().data() + mark_, stack().size() - mark_);
+  }
+private:
+  static std::vector<Value>& stack(){
+    static std::vector<Value> s = []{ std::vector<Value> v; v.reserve(4096); return v; }();
+    return s;
+  }
+  size_t mark_;
+  bool spilled_;
+  std::vector<Value> spill_;
+};
+
+// Runs `name(args...)` through the native's in-place form when the first
+// argument is a plain variable (named `target`, when given). Returns false,
+// without evaluating anything, when the call must go through the normal path.
+static bool exec_inplace(Env& env, FunctionRegistry& R, CallCache& cache, const std::string& name,
+                         const std::vector<std::unique_ptr<Expr>>& args, const std::string* target, bool debug_mode){
+  if(args.empty()) return false;
+  auto var = dynamic_cast<const Variable*>(args[0].get());
+  if(!var || (target && !iequals(var->name, *target))) return false;
+  const NativeFn* f = inplace_native(R, cache, name, args.size());
+  if(!f) return false;
+  ArgFrame rest(args.size() - 1);
+  for(size_t i = 1; i < args.size(); ++i) rest.push(eval(env, R, args[i].get(), debug_mode));
+  f->inplace(env.lvalue(var->sym), rest.args());
+  return true;
+}
 
 // Helper functions
 static bool truthy(const Value& v) {
@@ -220,27 +581,128 @@ static bool truthy(const Value& v) {
     return false;
 }
 
+static int num_cmp(double a, double b) {
+    if (a < b) return -1;
+    if (a > b) return 1;
+    return 0;
+}
+
 static int cmp_values(const Value& a, const Value& b) {
-    // Try to compare as numbers first
-    try {
-        double da = a.as_number();
-        double db = b.as_number();
-        if (da < db) return -1;
-        if (da > db) return 1;
+    // Numbers (and nil, as 0) compare numerically, integers exactly
+    if (a.is_int() && b.is_int()) {
+        long long x = *std::get_if<long long>(&a.v), y = *std::get_if<long long>(&b.v);
+        return x < y ? -1 : (x > y ? 1 : 0);
+    }
+    if ((a.is_number() || a.is_nil()) && (b.is_number() || b.is_nil())) return num_cmp(a.as_number(), b.as_number());
+    // If not numbers, compare as strings
+    if (a.is_string() && b.is_string()) {
+        const std::string& sa = a.as_string();
+        const std::string& sb = b.as_string();
+        if (sa < sb) return -1;
+        if (sa > sb) return 1;
         return 0;
-    } catch (...) {
-        // If not numbers, compare as strings
-        try {
-            const std::string& sa = a.as_string();
-            const std::string& sb = b.as_string();
-            if (sa < sb) return -1;
-            if (sa > sb) return 1;
-            return 0;
-        } catch (...) {
-            return 0; // Equal if can't compare
+    }
+    // Packed values are equal field by field; they have no ordering
+    if (a.is_packed() && b.is_packed()) return *a.packed() == *b.packed() ? 0 : 1;
+    // Function values are equal only to themselves
+    if (a.is_callable() || b.is_callable()) return a == b ? 0 : 1;
+    return 0; // Equal if can't compare
+}
+
+// Generic +, - and *: integers stay integers, `+` concatenates when either
+// side is a string, everything else is computed in double.
+static Value add_values(const Value& L, const Value& R) {
+    if (L.is_int() && R.is_int()) return int_add(*std::get_if<long long>(&L.v), *std::get_if<long long>(&R.v));
+    if (L.is_string() || R.is_string()) return Value::from_string(value_to_string_safe(L) + value_to_string_safe(R));
+    return Value::from_number(to_num(L) + to_num(R));
+}
+static Value sub_values(const Value& L, const Value& R) {
+    if (L.is_int() && R.is_int()) return int_sub(*std::get_if<long long>(&L.v), *std::get_if<long long>(&R.v));
+    return Value::from_number(to_num(L) - to_num(R));
+}
+static Value mul_values(const Value& L, const Value& R) {
+    if (L.is_int() && R.is_int()) return int_mul(*std::get_if<long long>(&L.v), *std::get_if<long long>(&R.v));
+    return Value::from_number(to_num(L) * to_num(R));
+}
+static Value negate_value(const Value& v) {
+    if (v.is_int()) return int_sub(0, *std::get_if<long long>(&v.v));
+    return Value::from_number(-to_num(v));
+}
+
+// Next value of a FOR counter; integer counters with an integer step stay
+// integers.
+static Value for_step(const Value& cur, const Value& step) {
+    if (cur.is_int() && step.is_int()) return int_add(*std::get_if<long long>(&cur.v), *std::get_if<long long>(&step.v));
+    return Value::from_number(to_num(cur) + to_num(step));
+}
+
+// Fast path a pair of operands qualifies for: Int when both are integers,
+// Num when both are numbers and at least one is a double, Str for two
+// strings when `strings` is set (only `+` has a string fast path).
+static OperandKind operand_kind(const Value& L, const Value& R, bool strings) {
+    if (L.is_int() && R.is_int()) return OperandKind::Int;
+    if (L.is_number() && R.is_number()) return OperandKind::Num;
+    if (strings && L.is_string() && R.is_string()) return OperandKind::Str;
+    return OperandKind::Generic;
+}
+
+static bool has_fast_path(Tok op) {
+    switch (op) {
+        case Tok::Plus: case Tok::Minus: case Tok::Star:
+        case Tok::Eq: case Tok::Neq: case Tok::Lt: case Tok::Lte: case Tok::Gt: case Tok::Gte:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static bool cmp_holds(Tok op, int c) {
+    switch (op) {
+        case Tok::Eq: return c == 0;
+        case Tok::Neq: return c != 0;
+        case Tok::Lt: return c < 0;
+        case Tok::Lte: return c <= 0;
+        case Tok::Gt: return c > 0;
+        default: return c >= 0;
+    }
+}
+
+// Evaluates a Binary node specialised for operands of kind `k`. Returns
+// false, leaving `out` untouched, when the operands are of another kind.
+static bool binary_fast(Tok op, OperandKind k, const Value& L, const Value& R, Value& out) {
+    switch (k) {
+        case OperandKind::Int: {
+            if (!L.is_int() || !R.is_int()) return false;
+            long long x = *std::get_if<long long>(&L.v), y = *std::get_if<long long>(&R.v);
+            switch (op) {
+                case Tok::Plus: out = int_add(x, y); break;
+                case Tok::Minus: out = int_sub(x, y); break;
+                case Tok::Star: out = int_mul(x, y); break;
+                default: out = Value::from_bool(cmp_holds(op, x < y ? -1 : (x > y ? 1 : 0))); break;
+            }
+            return true;
         }
+        case OperandKind::Num: {
+            if (!L.is_number() || !R.is_number() || (L.is_int() && R.is_int())) return false;
+            double x = L.as_number(), y = R.as_number();
+            switch (op) {
+                case Tok::Plus: out = Value::from_number(x + y); break;
+                case Tok::Minus: out = Value::from_number(x - y); break;
+                case Tok::Star: out = Value::from_number(x * y); break;
+                default: out = Value::from_bool(cmp_holds(op, num_cmp(x, y))); break;
+            }
+            return true;
+        }
+        case OperandKind::Str:
+            if (!L.is_string() || !R.is_string()) return false;
+            out = Value::from_string(*std::get_if<std::string>(&L.v) + *std::get_if<std::string>(&R.v));
+            return true;
+        case OperandKind::Generic:
+            break;
     }
+    return false;
 }
+
 static Value make_array_from_sizes(Env& env, FunctionRegistry& R, const std::vector<std::unique_ptr<Expr>>& sizes, size_t depth, bool debug_mode);
 
 // Evaluate size expressions to a concrete vector<size_t>
@@ -324,28 +786,359 @@ static Value make_array_from_sizes(Env& env, FunctionRegistry& R,
   return Value::from_array(std::move(arr));
 }
 
+// Read base[index] for arrays, strings and maps; out-of-range reads yield nil
+static Value index_value(const Value& base, const Value& indexVal){
+  // Array indexing
+  if(base.is_array()){
+    long long i = indexVal.as_int();
+    auto const& arrRef = base.as_array();
+    if(i < 0 || (size_t)i >= arrRef.size()) return Value::nil();
+    return arrRef[(size_t)i];
+  }
+  
+  // String indexing (character access)
+  if(base.is_string()){
+    long long i = indexVal.as_int();
+    const auto& str = base.as_string();
+    if(i < 0 || (size_t)i >= str.size()) return Value::nil();
+    return Value::from_string(std::string(1, str[(size_t)i]));
+  }
+  
+  // Map indexing (key access)
+  if(base.is_map()){
+    const auto& map = base.as_map();
+    // The key as written, else in any case, as fields are read
+    auto it = map.find_any_case(indexVal.as_string());
+    return it != map.end() ? it->second : Value::nil();
+  }
+  
+  return Value::nil();
+}
+
+// Write base[i0][i1]... = val in place. Elements along the path that are not
+// arrays become arrays, and arrays grow to fit; only storage shared with
+// another value is copied (copy-on-write). A negative index ignores the write.
+static void store_index(Value& base, NativeArgs path, Value val){
+  for(const Value& i : path) if(i.as_int() < 0) return;
+  if(!base.is_array()) base = Value::from_array({});
+  Value* current = &base;
+  for(size_t d=0; d+1<path.size(); ++d){
+    auto& arr = current->as_array();
+    size_t i = static_cast<size_t>(path[d].as_int());
+    if(i >= arr.size()) arr.resize(i+1, Value::nil());
+    if(!arr[i].is_array()) arr[i] = Value::from_array({});
+    current = &arr[i];
+  }
+  auto& arr = current->as_array();
+  size_t i = static_cast<size_t>(path.back().as_int());
+  if(i >= arr.size()) arr.resize(i+1, Value::nil());
+  arr[i] = std::move(val);
+}
+
+// obj.member = val. Packed fields are written in place through the node's
+// cached slot; other objects go through the member hooks, then maps.
+static void assign_member(Value& obj, const AssignMember* am, Value val){
+  // Packed values have a fixed set of fields, stored in place
+  if(Packed* p = obj.packed()){
+    int i = am->field.lookup(*p, am->member);
+    if(i < 0) throw std::runtime_error(std::string(packed_type_name(p->kind)) + " has no field '" + am->member + "'");
+    double d = val.as_number();
+    if(p->kind == Packed::Kind::Color) d = std::clamp(d, 0.0, 255.0);
+    p->f[i] = static_cast<float>(d);
+    return;
+  }
+  
+  // Try hooks first (for ECS, etc.)
+  if(try_assign_member(obj, am->member, val)){
+    return;
+  }
+  
+  // Check if object is a map (object)
+  if(obj.is_map()){
+    // An existing field is found whatever its case; a new one is added
+    // under the folded name
+    (void)set_deep_property(obj, am->member, val);
+    return;
+  }
+  
+  // If not a map, create one
+  Value::Map new_obj;
+  new_obj[Env::up(am->member)] = val;
+  obj = Value::from_map(std::move(new_obj));
+}
+
+// Methods whose names start with one of these return their receiver when
+// the underlying function returns nothing, so calls can be chained.
+static bool chainable_method(const std::string& method){
+  static constexpr std::string_view prefixes[] = {
+    "set", "add", "remove", "clear", "update", "move", "scale",
+    "rotate", "normalize", "transform", "push", "pop", "shift", "unshift",
+    "append", "insert", "delete", "modify", "change", "prepend"
+  };
+  std::string name = Env::up(method);
+  for(std::string_view prefix : prefixes){
+    if(name.compare(0, prefix.size(), prefix) == 0) return true;
+  }
+  return false;
+}
+
+// Type that `obj.method()` dispatches on: the packed kind, "string",
+// "array", "function", or a map's _type. Empty when the receiver has none.
+static std::string_view receiver_type(const Value& obj){
+  if(const Packed* p = obj.packed()) return packed_type_name(p->kind);
+  if(obj.is_callable()) return "function";
+  if(obj.is_string()) return "string";
+  if(obj.is_array()) return "array";
+  if(obj.is_map()){
+    const auto& map = std::as_const(obj).as_map();
+    auto it = map.find("_type");
+    if(it != map.end() && it->second.is_string()) return it->second.as_string();
+  }
+  return {};
+}
+
+// Value of `obj.member`. Packed fields are read through the node's cached
+// slot; maps, strings, arrays and namespaces resolve the member by name.
+static Value member_value(FunctionRegistry& R, const MemberAccess* ma, Value obj, bool debug_mode){
+  if(const Packed* p = obj.packed()){
+    int i = ma->field.lookup(*p, ma->member);
+    if(i >= 0) return Value::from_number(p->f[i]);
+  }
+  
+  // Try hooks first (for ECS, etc.)
+  if (auto hookValue = try_resolve_member(obj, ma->member); hookValue.has_value()) {
+    return *hookValue;
+  }
+  
+  // Check if object is a map (object)
+  if(obj.is_map()){
+    const auto& map = std::as_const(obj).as_map();
+    
+    // Try direct access first, in any case
+    auto it = map.find_any_case(ma->member);
+    if(it != map.end()){
+      Value propValue = it->second;
+      // If property is a function, return it as a method
+      if (propValue.is_map()) {
+        const auto& propMap = std::as_const(propValue).as_map();
+        auto typeIt = propMap.find("_type");
+        if (typeIt != propMap.end() && typeIt->second.is_string() && 
+            typeIt->second.as_string() == "Method") {
+          return propValue;
+        }
+      }
+      return propValue;
+    }
+    
+    // Try deep property access (nested maps)
+    if (auto deep = get_deep_property(obj, ma->member)) {
+      return *deep;
+    }
+    
+    std::string member_upper = Env::up(ma->member);
+    // Check if this is a namespace object trying to access a method
+    if(g_namespace_registry){
+      auto type_it = map.find("_type");
+      if(type_it != map.end() && type_it->second.is_string() && 
+         type_it->second.as_string() == "Namespace"){
+        auto name_it = map.find("_name");
+        if(name_it != map.end() && name_it->second.is_string()){
+          std::string ns_name = name_it->second.as_string();
+          std::string method_name = member_upper;
+          std::string func_name = g_namespace_registry->resolve_method(ns_name, method_name);
+          if(!func_name.empty()){
+            // Return a method object that can be called
+            Value::Map method_obj;
+            method_obj[Env::up("_type")] = Value::from_string(Env::up("Method"));
+            method_obj[Env::up("_namespace")] = Value::from_string(Env::up(ns_name));
+            method_obj[Env::up("_method")] = Value::from_string(Env::up(method_name));
+            method_obj[Env::up("_function")] = Value::from_string(Env::up(func_name));
+            return Value::from_map(std::move(method_obj));
+          }
+        }
+      }
+    }
+    
+    // Check if this is an object type (Vector3, Color, etc.) trying to access a method
+    auto type_it = map.find("_type");
+    if(type_it != map.end() && type_it->second.is_string()){
+      std::string obj_type = type_it->second.as_string();
+      // Try to resolve as object method: TYPE_METHODNAME
+      std::string method_func = obj_type + "_" + member_upper;
+      const auto* fn = R.find(method_func);
+      if(fn){
+        // Return a method object
+        Value::Map method_obj;
+        method_obj[Env::up("_type")] = Value::from_string(Env::up("Method"));
+        method_obj[Env::up("_object")] = obj; // Store reference to object
+        method_obj[Env::up("_method")] = Value::from_string(member_upper);
+        method_obj[Env::up("_function")] = Value::from_string(Env::up(method_func));
+        return Value::from_map(std::move(method_obj));
+      }
+    }
+    
+    // Property not found - provide helpful error message with suggestions
+    if(debug_mode){
+      std::string obj_type = "object";
+      auto type_it = map.find("_type");
+      if(type_it != map.end() && type_it->second.is_string()){
+        obj_type = type_it->second.as_string();
+      }
+      
+      // Get available properties for suggestions
+      Value::Array availableProps;
+      for (const auto& pair : map) {
+        if (pair.first[0] != '_' || pair.first == "_type") {
+          availableProps.push_back(Value::from_string(pair.first));
+        }
+      }
+      
+      // Find similar property names (fuzzy match with better algorithm)
+      Value::Array suggestions;
+      std::string memberUpper = Env::up(ma->member);
+      for (const auto& prop : availableProps) {
+        if (prop.is_string()) {
+          std::string propUpper = Env::up(prop.as_string());
+          // Check if member is similar to property
+          bool similar = false;
+          
+          // Exact prefix match
+          if (propUpper.find(memberUpper) == 0 || memberUpper.find(propUpper) == 0) {
+            similar = true;
+          }
+          // Contains match
+          else if (propUpper.find(memberUpper) != std::string::npos || 
+                   memberUpper.find(propUpper) != std::string::npos) {
+            similar = true;
+          }
+          // Character similarity (simple Levenshtein-like)
+          else {
+            size_t matches = 0;
+            size_t minLen = std::min(memberUpper.size(), propUpper.size());
+            for (size_t i = 0; i < minLen; ++i) {
+              if (memberUpper[i] == propUpper[i]) matches++;
+            }
+            if (matches >= minLen / 2) {
+              similar = true;
+            }
+          }
+          
+          if (similar) {
+            suggestions.push_back(prop);
+            if (suggestions.size() >= 5) break;
+          }
+        }
+      }
+      
+      std::cerr << "Warning: Property '" << ma->member << "' not found on " << obj_type;
+      if (!suggestions.empty()) {
+        std::cerr << "\n  Did you mean: ";
+        for (size_t i = 0; i < suggestions.size() && i < 5; ++i) {
+          if (i > 0) std::cerr << ", ";
+          std::cerr << suggestions[i].as_string();
+        }
+      }
+      std::cerr << std::endl;
+    }
+    return Value::nil();
+  }
+  
+  // Check if object is a string trying to access a method
+  if(obj.is_string()){
+    std::string method_func = "STRING_" + Env::up(ma->member);
+    const auto* fn = R.find(method_func);
+    if(fn){
+      Value::Map method_obj;
+      method_obj[Env::up("_type")] = Value::from_string(Env::up("Method"));
+      method_obj[Env::up("_object")] = obj;
+      method_obj[Env::up("_method")] = Value::from_string(Env::up(ma->member));
+      method_obj[Env::up("_function")] = Value::from_string(Env::up(method_func));
+      return Value::from_map(std::move(method_obj));
+    }
+  }
+  
+  // Check if object is an array trying to access a method or property
+  if(obj.is_array()){
+    // Try array methods first
+    std::string method_func = "ARRAY_" + Env::up(ma->member);
+    const auto* fn = R.find(method_func);
+    if(fn){
+      Value::Map method_obj;
+      method_obj[Env::up("_type")] = Value::from_string(Env::up("Method"));
+      method_obj[Env::up("_object")] = obj;
+      method_obj[Env::up("_method")] = Value::from_string(Env::up(ma->member));
+      method_obj[Env::up("_function")] = Value::from_string(Env::up(method_func));
+      return Value::from_map(std::move(method_obj));
+    }
+    // Try array properties (length, etc.)
+    // Identifiers are normalized to lowercase, so just check lowercase
+    if (ma->member == "length" || ma->member == "size") {
+      return Value::from_int(static_cast<long long>(std::as_const(obj).as_array().size()));
+    }
+  }
+  
+  // Check if object is a string trying to access a method or property
+  if(obj.is_string()){
+    // Try string methods first
+    std::string method_func = "STRING_" + Env::up(ma->member);
+    const auto* fn = R.find(method_func);
+    if(fn){
+      Value::Map method_obj;
+      method_obj[Env::up("_type")] = Value::from_string(Env::up("Method"));
+      method_obj[Env::up("_object")] = obj;
+      method_obj[Env::up("_method")] = Value::from_string(Env::up(ma->member));
+      method_obj[Env::up("_function")] = Value::from_string(Env::up(method_func));
+      return Value::from_map(std::move(method_obj));
+    }
+    // Try string properties (length, etc.)
+    // Identifiers are normalized to lowercase, so just check lowercase
+    if (ma->member == "length" || ma->member == "size") {
+      return Value::from_int(static_cast<long long>(obj.as_string().size()));
+    }
+  }
+  
+  // Packed values (Vector3, Color, ...) resolve methods as TYPE_METHODNAME
+  if(const Packed* p = obj.packed()){
+    std::string method_func = std::string(packed_type_name(p->kind)) + "_" + ma->member;
+    if(R.find(method_func)){
+      Value::Map method_obj;
+      method_obj[Env::up("_type")] = Value::from_string(Env::up("Method"));
+      method_obj[Env::up("_object")] = obj;
+      method_obj[Env::up("_method")] = Value::from_string(ma->member);
+      method_obj[Env::up("_function")] = Value::from_string(method_func);
+      return Value::from_map(std::move(method_obj));
+    }
+  }
+  
+  // If object is a variable name, try to resolve as namespace
+  if(auto var = dynamic_cast<const Variable*>(ma->object.get())){
+    if(g_namespace_registry && g_namespace_registry->has_namespace(var->name)){
+      // Create namespace object on-the-fly and access member
+      Value ns_obj = g_namespace_registry->create_namespace_object(var->name);
+      const auto& ns_map = std::as_const(ns_obj).as_map();
+      auto member_it = ns_map.find(Env::up(ma->member));
+      if(member_it != ns_map.end()){
+        return member_it->second;
+      }
+    }
+  }
+  
+  return Value::nil();
+}
+
 static Value eval(Env& env, FunctionRegistry& R, const Expr* e, bool debug_mode){
     (void)env; (void)R; // Suppress unused parameter warnings
   if (debug_mode) std::cerr << "eval: " << typeid(*e).name() << std::endl;
   if(auto lit = dynamic_cast<const Literal*>(e)){
-    switch(lit->tok.kind){
-      case Tok::Number: return Value::from_number(std::stod(lit->tok.lex));
-      case Tok::String: return Value::from_string(lit->tok.lex);
-      case Tok::True: return Value::from_bool(true);
-      case Tok::False: return Value::from_bool(false);
-      case Tok::Nil:
-      case Tok::None:
-      case Tok::Null: return Value::nil();
-      default: return Value::nil();
-    }
+    return lit->value;
   }
   if(auto i = dynamic_cast<const Variable*>(e)) {
-    return env.get(i->name);
+    return env.get(i->sym);
   }
   if(auto u = dynamic_cast<const Unary*>(e)){
     Value r = eval(env, R, u->right.get(), debug_mode);
-    if(u->op==Tok::Minus) return Value::from_number(-to_num(r));
-    if(u->op==Tok::Plus) return Value::from_number(+to_num(r));
+    if(u->op==Tok::Minus) return negate_value(r);
+    if(u->op==Tok::Plus) return r.is_int() ? r : Value::from_number(+to_num(r));
     if(u->op==Tok::Not) return Value::from_bool(!truthy(r));
     if(u->op==Tok::BitNot) {
       long long val = static_cast<long long>(to_num(r));
@@ -358,16 +1151,18 @@ static Value eval(Env& env, FunctionRegistry& R, const Expr* e, bool debug_mode)
     Value right_val = eval(env, R, b->right.get(), debug_mode);
         if (debug_mode) std::cerr << "binary op L: " << value_to_string_safe(L) << ", R: " << value_to_string_safe(right_val) << std::endl;
 
+    // Quickening: a node remembers the operand kind it last saw and takes
+    // the matching fast path until the operands change kind.
+    if(b->quick != OperandKind::Generic){
+      Value out;
+      if(binary_fast(b->op, b->quick, L, right_val, out)) return out;
+    }
+    if(has_fast_path(b->op)) b->quick = operand_kind(L, right_val, b->op == Tok::Plus);
+
     switch(b->op){
-      case Tok::Plus: {
-        if (std::holds_alternative<std::string>(L.v) || std::holds_alternative<std::string>(right_val.v)) {
-          return Value::from_string(value_to_string_safe(L) + value_to_string_safe(right_val));
-        } else {
-          return Value::from_number(to_num(L) + to_num(right_val));
-        }
-      }
-      case Tok::Minus: return Value::from_number(to_num(L) - to_num(right_val));
-      case Tok::Star: return Value::from_number(to_num(L) * to_num(right_val));
+      case Tok::Plus: return add_values(L, right_val);
+      case Tok::Minus: return sub_values(L, right_val);
+      case Tok::Star: return mul_values(L, right_val);
       case Tok::Slash: return Value::from_number(to_num(L) / to_num(right_val));
       case Tok::IntDiv: {
         long long lhs = static_cast<long long>(to_num(L));
@@ -402,46 +1197,11 @@ static Value eval(Env& env, FunctionRegistry& R, const Expr* e, bool debug_mode)
   if(auto idx = dynamic_cast<const Index*>(e)){
     Value base = eval(env,R,idx->target.get(), debug_mode);
     Value indexVal = eval(env,R,idx->index.get(), debug_mode);
-    
-    // Array indexing
-    if(base.is_array()){
-      long long i = indexVal.as_int();
-      auto const& arrRef = base.as_array();
-      if(i < 0 || (size_t)i >= arrRef.size()) return Value::nil();
-      return arrRef[(size_t)i];
-    }
-    
-    // String indexing (character access)
-    if(base.is_string()){
-      long long i = indexVal.as_int();
-      const auto& str = base.as_string();
-      if(i < 0 || (size_t)i >= str.size()) return Value::nil();
-      return Value::from_string(std::string(1, str[(size_t)i]));
-    }
-    
-    // Map indexing (key access)
-    if(base.is_map()){
-      const auto& map = base.as_map();
-      std::string key;
-      if(indexVal.is_string()){
-        key = Env::up(indexVal.as_string());
-      } else {
-        key = Env::up(indexVal.as_string()); // Convert to string
-      }
-      auto it = map.find(key);
-      if(it != map.end()) return it->second;
-      // Case-insensitive search
-      for(const auto& pair : map){
-        if(Env::up(pair.first) == key) return pair.second;
-      }
-      return Value::nil();
-    }
-    
-    return Value::nil();
+    return index_value(base, indexVal);
   }
   if(auto c = dynamic_cast<const Call*>(e)){
-    std::vector<Value> args; args.reserve(c->args.size());
-    for(auto& a : c->args) args.push_back(eval(env, R, a.get(), debug_mode));
+    ArgFrame args(c->args.size());
+    for(auto& a : c->args) args.push(eval(env, R, a.get(), debug_mode));
     
     // Evaluate named arguments
     std::map<std::string, Value> namedArgs;
@@ -450,396 +1210,106 @@ static Value eval(Env& env, FunctionRegistry& R, const Expr* e, bool debug_mode)
       namedArgs[Env::up(na.name)] = val;
     }
     
-    // Check user-defined subs first
-    auto it = g_subs.find(Env::up(c->callee));
-    if(it!=g_subs.end()){
-      call_sub(env, R, c->callee, args, debug_mode);
-      return Value::nil();
-    }
-    auto itf = g_funcs.find(Env::up(c->callee));
-    if(itf!=g_funcs.end()){
-      return call_func(env, R, c->callee, args, namedArgs, debug_mode);
-    }
-    return call(R, c->callee, args);
+    return invoke(env, R, resolve_call(c->cache, R, c->callee), c->callee, args.args(), namedArgs, debug_mode);
   }
   if(auto ma = dynamic_cast<const MemberAccess*>(e)){
-    Value obj = eval(env, R, ma->object.get(), debug_mode);
-    
-    // Try hooks first (for ECS, etc.)
-    if (auto hookValue = try_resolve_member(obj, ma->member); hookValue.has_value()) {
-      return *hookValue;
-    }
-    
-    // Check if object is a map (object)
-    if(obj.is_map()){
-      const auto& map = obj.as_map();
-      std::string member_upper = Env::up(ma->member);
-      
-      // Check property descriptors first (for computed properties/getters)
-      std::string objId;
-      auto idIt = map.find("_id");
-      if (idIt != map.end() && idIt->second.is_int()) {
-        objId = std::to_string(idIt->second.as_int());
-        // In a real implementation, would check g_property_descriptors here for getters
-      }
-      
-      // Try direct access first
-      auto it = map.find(member_upper);
-      if(it != map.end()){
-        Value propValue = it->second;
-        // If property is a function, return it as a method
-        if (propValue.is_map()) {
-          const auto& propMap = propValue.as_map();
-          auto typeIt = propMap.find("_type");
-          if (typeIt != propMap.end() && typeIt->second.is_string() && 
-              typeIt->second.as_string() == "Method") {
-            return propValue;
-          }
-        }
-        return propValue;
-      }
-      
-      // Try case-insensitive search (keys are already normalized)
-      for (const auto& pair : map) {
-        if (Env::up(pair.first) == member_upper) {
-          return pair.second;
-        }
-      }
-      
-      // Try deep property access (nested maps)
-      if (auto deep = get_deep_property(obj, ma->member)) {
-        return *deep;
-      }
-      
-      // Check if this is a namespace object trying to access a method
-      if(g_namespace_registry){
-        auto type_it = map.find("_type");
-        if(type_it != map.end() && type_it->second.is_string() && 
-           type_it->second.as_string() == "Namespace"){
-          auto name_it = map.find("_name");
-          if(name_it != map.end() && name_it->second.is_string()){
-            std::string ns_name = name_it->second.as_string();
-            std::string method_name = member_upper;
-            std::string func_name = g_namespace_registry->resolve_method(ns_name, method_name);
-            if(!func_name.empty()){
-              // Return a method object that can be called
-              Value::Map method_obj;
-              method_obj[Env::up("_type")] = Value::from_string(Env::up("Method"));
-              method_obj[Env::up("_namespace")] = Value::from_string(Env::up(ns_name));
-              method_obj[Env::up("_method")] = Value::from_string(Env::up(method_name));
-              method_obj[Env::up("_function")] = Value::from_string(Env::up(func_name));
-              return Value::from_map(std::move(method_obj));
-            }
-          }
-        }
-      }
-      
-      // Check if this is an object type (Vector3, Color, etc.) trying to access a method
-      auto type_it = map.find("_type");
-      if(type_it != map.end() && type_it->second.is_string()){
-        std::string obj_type = type_it->second.as_string();
-        // Try to resolve as object method: TYPE_METHODNAME
-        std::string method_func = obj_type + "_" + member_upper;
-        const auto* fn = R.find(method_func);
-        if(fn){
-          // Return a method object
-          Value::Map method_obj;
-          method_obj[Env::up("_type")] = Value::from_string(Env::up("Method"));
-          method_obj[Env::up("_object")] = obj; // Store reference to object
-          method_obj[Env::up("_method")] = Value::from_string(member_upper);
-          method_obj[Env::up("_function")] = Value::from_string(Env::up(method_func));
-          return Value::from_map(std::move(method_obj));
-        }
-      }
-      
-      // Property not found - provide helpful error message with suggestions
-      if(debug_mode){
-        std::string obj_type = "object";
-        auto type_it = map.find("_type");
-        if(type_it != map.end() && type_it->second.is_string()){
-          obj_type = type_it->second.as_string();
-        }
-        
-        // Get available properties for suggestions
-        Value::Array availableProps;
-        for (const auto& pair : map) {
-          if (pair.first[0] != '_' || pair.first == "_type") {
-            availableProps.push_back(Value::from_string(pair.first));
-          }
-        }
-        
-        // Find similar property names (fuzzy match with better algorithm)
-        Value::Array suggestions;
-        std::string memberUpper = Env::up(ma->member);
-        for (const auto& prop : availableProps) {
-          if (prop.is_string()) {
-            std::string propUpper = Env::up(prop.as_string());
-            // Check if member is similar to property
-            bool similar = false;
-            
-            // Exact prefix match
-            if (propUpper.find(memberUpper) == 0 || memberUpper.find(propUpper) == 0) {
-              similar = true;
-            }
-            // Contains match
-            else if (propUpper.find(memberUpper) != std::string::npos || 
-                     memberUpper.find(propUpper) != std::string::npos) {
-              similar = true;
-            }
-            // Character similarity (simple Levenshtein-like)
-            else {
-              size_t matches = 0;
-              size_t minLen = std::min(memberUpper.size(), propUpper.size());
-              for (size_t i = 0; i < minLen; ++i) {
-                if (memberUpper[i] == propUpper[i]) matches++;
-              }
-              if (matches >= minLen / 2) {
-                similar = true;
-              }
-            }
-            
-            if (similar) {
-              suggestions.push_back(prop);
-              if (suggestions.size() >= 5) break;
-            }
-          }
-        }
-        
-        std::cerr << "Warning: Property '" << ma->member << "' not found on " << obj_type;
-        if (!suggestions.empty()) {
-          std::cerr << "\n  Did you mean: ";
-          for (size_t i = 0; i < suggestions.size() && i < 5; ++i) {
-            if (i > 0) std::cerr << ", ";
-            std::cerr << suggestions[i].as_string();
-          }
-        }
-        std::cerr << std::endl;
-      }
-      return Value::nil();
-    }
-    
-    // Check if object is a string trying to access a method
-    if(obj.is_string()){
-      std::string method_func = "STRING_" + Env::up(ma->member);
-      const auto* fn = R.find(method_func);
-      if(fn){
-        Value::Map method_obj;
-        method_obj[Env::up("_type")] = Value::from_string(Env::up("Method"));
-        method_obj[Env::up("_object")] = obj;
-        method_obj[Env::up("_method")] = Value::from_string(Env::up(ma->member));
-        method_obj[Env::up("_function")] = Value::from_string(Env::up(method_func));
-        return Value::from_map(std::move(method_obj));
-      }
-    }
-    
-    // Check if object is an array trying to access a method or property
-    if(obj.is_array()){
-      // Try array methods first
-      std::string method_func = "ARRAY_" + Env::up(ma->member);
-      const auto* fn = R.find(method_func);
-      if(fn){
-        Value::Map method_obj;
-        method_obj[Env::up("_type")] = Value::from_string(Env::up("Method"));
-        method_obj[Env::up("_object")] = obj;
-        method_obj[Env::up("_method")] = Value::from_string(Env::up(ma->member));
-        method_obj[Env::up("_function")] = Value::from_string(Env::up(method_func));
-        return Value::from_map(std::move(method_obj));
-      }
-      // Try array properties (length, etc.)
-      // Identifiers are normalized to lowercase, so just check lowercase
-      if (ma->member == "length" || ma->member == "size") {
-        return Value::from_int(static_cast<long long>(obj.as_array().size()));
-      }
-    }
-    
-    // Check if object is a string trying to access a method or property
-    if(obj.is_string()){
-      // Try string methods first
-      std::string method_func = "STRING_" + Env::up(ma->member);
-      const auto* fn = R.find(method_func);
-      if(fn){
-        Value::Map method_obj;
-        method_obj[Env::up("_type")] = Value::from_string(Env::up("Method"));
-        method_obj[Env::up("_object")] = obj;
-        method_obj[Env::up("_method")] = Value::from_string(Env::up(ma->member));
-        method_obj[Env::up("_function")] = Value::from_string(Env::up(method_func));
-        return Value::from_map(std::move(method_obj));
-      }
-      // Try string properties (length, etc.)
-      // Identifiers are normalized to lowercase, so just check lowercase
-      if (ma->member == "length" || ma->member == "size") {
-        return Value::from_int(static_cast<long long>(obj.as_string().size()));
-      }
-    }
-    
-    // If object is a variable name, try to resolve as namespace
-    if(auto var = dynamic_cast<const Variable*>(ma->object.get())){
-      if(g_namespace_registry && g_namespace_registry->has_namespace(var->name)){
-        // Create namespace object on-the-fly and access member
-        Value ns_obj = g_namespace_registry->create_namespace_object(var->name);
-        const auto& ns_map = ns_obj.as_map();
-        auto member_it = ns_map.find(Env::up(ma->member));
-        if(member_it != ns_map.end()){
-          return member_it->second;
-        }
-      }
-    }
-    
-    return Value::nil();
+    return member_value(R, ma, eval(env, R, ma->object.get(), debug_mode), debug_mode);
   }
   if(auto mc = dynamic_cast<const MethodCall*>(e)){
     Value obj = eval(env, R, mc->object.get(), debug_mode);
-    std::vector<Value> args; args.reserve(mc->args.size());
-    for(auto& a : mc->args) args.push_back(eval(env, R, a.get(), debug_mode));
-    
-    std::string func_name;
+    MethodCache& mcache = mc->dispatch;
+    if(mcache.chainable < 0) mcache.chainable = chainable_method(mc->method);
     
-    // Check if object is a namespace or method object
-    if(obj.is_map()){
-      const auto& map = obj.as_map();
-      auto type_it = map.find("_type");
-      
-      if(type_it != map.end() && type_it->second.is_string()){
-        std::string obj_type = type_it->second.as_string();
-        
-        if(obj_type == "Lambda"){
-          // Lambda function call - in a real implementation, this would execute the lambda body
-          // For now, return nil as placeholder
-          // TODO: Implement full lambda execution with closure
-          return Value::nil();
-        }
-        else if(obj_type == "Method"){
-          // Direct method call - get function name from method object
-          auto func_it = map.find("_function");
-          if(func_it != map.end() && func_it->second.is_string()){
-            func_name = func_it->second.as_string();
-            // If method has object reference, prepend it to args
-            auto obj_it = map.find("_object");
-            if(obj_it != map.end()){
-              std::vector<Value> new_args;
-              new_args.push_back(obj_it->second);
-              new_args.insert(new_args.end(), args.begin(), args.end());
-              args = std::move(new_args);
-            }
-          }
-        } else if(obj_type == "Namespace" && g_namespace_registry){
-          // Namespace.method() - resolve method
-          auto name_it = map.find("_name");
-          if(name_it != map.end() && name_it->second.is_string()){
-            std::string ns_name = name_it->second.as_string();
-            func_name = g_namespace_registry->resolve_method(ns_name, mc->method);
-          }
-        }
-      }
+    // Re-resolve only when the receiver type differs from the last call here
+    std::string_view type = receiver_type(obj);
+    if(type != mcache.type){
+      mcache.type = type;
+      std::string folded = Env::up(mcache.type);
+      mcache.kind = folded == "function" ? MethodCache::Kind::Lambda
+                  : folded == "method" ? MethodCache::Kind::Method
+                  : folded == "namespace" ? MethodCache::Kind::Namespace
+                  : MethodCache::Kind::Typed;
+      mcache.func = folded.empty() ? std::string() : folded + "_" + mc->method;
+      mcache.target.run = 0;
     }
     
-    // Store original object for method chaining
-    Value originalObj = obj;
-    bool shouldChain = false;
-    
-    // Check if method should return self for chaining
-    // First check method name from MethodCall
-    std::string methodNameUpper = Env::up(mc->method);
-    static const std::vector<std::string> chainablePrefixes = {
-      "SET", "ADD", "REMOVE", "CLEAR", "UPDATE", "MOVE", "SCALE", 
-      "ROTATE", "NORMALIZE", "TRANSFORM", "PUSH", "POP", "SHIFT", "UNSHIFT",
-      "APPEND", "INSERT", "DELETE", "MODIFY", "CHANGE", "PREPEND"
-    };
-    for (const auto& prefix : chainablePrefixes) {
-      if (methodNameUpper.find(prefix) == 0) {
-        shouldChain = true;
-        break;
-      }
-    }
-    
-    // Also check if object is a method object with chainable method
-    if (!shouldChain && obj.is_map()) {
-      const auto& objMap = obj.as_map();
-      auto methodIt = objMap.find("_method");
-      if (methodIt != objMap.end() && methodIt->second.is_string()) {
-        std::string methodName = Env::up(methodIt->second.as_string());
-        for (const auto& prefix : chainablePrefixes) {
-          if (methodName.find(prefix) == 0) {
-            shouldChain = true;
-            // Get the original object from the method object
-            auto objIt = objMap.find("_object");
-            if (objIt != objMap.end()) {
-              originalObj = objIt->second;
-            }
-            break;
-          }
+    switch(mcache.kind){
+      case MethodCache::Kind::Typed:
+        if(mcache.func.empty()) break;
+        if(const CallCache& t = resolve_call(mcache.target, R, mcache.func); t.sub || t.func || t.native){
+          ArgFrame args(mc->args.size() + 1);
+          args.push(obj);
+          for(auto& a : mc->args) args.push(eval(env, R, a.get(), debug_mode));
+          Value result = invoke(env, R, t, mcache.func, args.args(), kNoNamedArgs, debug_mode);
+          // Chainable methods that return nothing yield the receiver
+          if(mcache.chainable && result.is_nil()) return obj;
+          return result;
         }
+        break;
+      case MethodCache::Kind::Lambda: {
+        // f.call(args...): a method of a function value calls it
+        ArgFrame args(mc->args.size());
+        for(auto& a : mc->args) args.push(eval(env, R, a.get(), debug_mode));
+        return obj.as_callable()->call(args.args());
+      }
+      case MethodCache::Kind::Method: {
+        // A bound method object from `obj.member`
+        const auto& map = std::as_const(obj).as_map();
+        auto func_it = map.find("_function");
+        if(func_it == map.end() || !func_it->second.is_string()) break;
+        auto obj_it = map.find("_object");
+        auto method_it = map.find("_method");
+        bool chain = mcache.chainable ||
+          (method_it != map.end() && method_it->second.is_string() && chainable_method(method_it->second.as_string()));
+        ArgFrame args(mc->args.size() + 1);
+        if(obj_it != map.end()) args.push(obj_it->second);
+        for(auto& a : mc->args) args.push(eval(env, R, a.get(), debug_mode));
+        const std::string& func_name = func_it->second.as_string();
+        CallCache target;
+        Value result = invoke(env, R, resolve_call(target, R, func_name), func_name, args.args(), kNoNamedArgs, debug_mode);
+        if(chain && result.is_nil()) return obj_it != map.end() ? obj_it->second : obj;
+        return result;
+      }
+      case MethodCache::Kind::Namespace: {
+        if(!g_namespace_registry) break;
+        const auto& map = std::as_const(obj).as_map();
+        auto name_it = map.find("_name");
+        if(name_it == map.end() || !name_it->second.is_string()) break;
+        std::string func_name = g_namespace_registry->resolve_method(name_it->second.as_string(), mc->method);
+        if(func_name.empty()) break;
+        ArgFrame args(mc->args.size());
+        for(auto& a : mc->args) args.push(eval(env, R, a.get(), debug_mode));
+        // The resolved name depends on the namespace, so the cache only hits
+        // while the same name comes back
+        if(mc->cache.name != Env::up(func_name)) mc->cache.run = 0;
+        Value result = invoke(env, R, resolve_call(mc->cache, R, func_name), func_name, args.args(), kNoNamedArgs, debug_mode);
+        if(mcache.chainable && result.is_nil()) return obj;
+        return result;
       }
     }
     
-    // If we have a function name, call it
-    if(!func_name.empty()){
-      Value result;
-      // Try user-defined subs first
-      auto it = g_subs.find(Env::up(func_name));
-      if(it != g_subs.end()){
-        call_sub(env, R, func_name, args, debug_mode);
-        result = Value::nil();
-      }
-      // Try user-defined functions
-      else {
-        auto itf = g_funcs.find(Env::up(func_name));
-        if(itf != g_funcs.end()){
-          result = call_func(env, R, func_name, args, {}, debug_mode);
-        } else {
-          // Try native function
-          result = call(R, func_name, args);
-        }
-      }
-      
-      // Enhanced method chaining: if method is chainable and result is nil, return original object
-      if (shouldChain && result.is_nil()) {
-        return originalObj;
+    // A field holding a function value: obj.handler(args...)
+    if(obj.is_map()){
+      const auto& map = std::as_const(obj).as_map();
+      if(auto it = map.find(mc->method); it != map.end() && it->second.is_callable()){
+        auto fn = it->second.as_callable();
+        ArgFrame args(mc->args.size());
+        for(auto& a : mc->args) args.push(eval(env, R, a.get(), debug_mode));
+        return fn->call(args.args());
       }
-      return result;
     }
     
     // Fallback: try method name directly (for global methods)
-    std::string method_name = Env::up(mc->method);
-    Value result;
-    auto it = g_subs.find(method_name);
-    if(it != g_subs.end()){
-      call_sub(env, R, method_name, args, debug_mode);
-      result = Value::nil();
-    } else {
-      auto itf = g_funcs.find(method_name);
-      if(itf != g_funcs.end()){
-        result = call_func(env, R, method_name, args, {}, debug_mode);
-      } else {
-        result = call(R, method_name, args);
-      }
-    }
-    
-    // For chainable methods, return original object if result is nil
-    if (shouldChain && result.is_nil()) {
-      return originalObj;
-    }
+    ArgFrame args(mc->args.size());
+    for(auto& a : mc->args) args.push(eval(env, R, a.get(), debug_mode));
+    if(mc->cache.name != mc->method) mc->cache.run = 0;
+    Value result = invoke(env, R, resolve_call(mc->cache, R, mc->method), mc->method, args.args(), kNoNamedArgs, debug_mode);
+    if(mcache.chainable && result.is_nil()) return obj;
     return result;
   }
   // Extension expression types
   if (auto lambda = dynamic_cast<const LambdaExpr*>(e)) {
-    // Lambda expressions - create a callable function object with closure
-    Value::Map funcObj;
-    funcObj[Env::up("_type")] = Value::from_string(Env::up("Lambda"));
-    funcObj[Env::up("_paramCount")] = Value::from_int(static_cast<long long>(lambda->params.size()));
-    
-    // Store closure (captured environment)
-    Value::Map closure;
-    for (const auto& pair : env.vars) {
-      closure[pair.first] = pair.second;
-    }
-    funcObj[Env::up("_closure")] = Value::from_map(std::move(closure));
-    
-    // Store lambda AST (in a real implementation, this would be serialized)
-    // For now, we'll store a reference that can be looked up
-    funcObj[Env::up("_lambdaId")] = Value::from_int(static_cast<long long>(reinterpret_cast<intptr_t>(lambda)));
-    
-    return Value::from_map(std::move(funcObj));
+    return make_closure(env, lambda);
   }
   if (auto interp = dynamic_cast<const InterpolatedString*>(e)) {
     // String interpolation - concatenate parts
@@ -889,7 +1359,7 @@ static Value eval(Env& env, FunctionRegistry& R, const Expr* e, bool debug_mode)
     if (val.is_string()) typeName = "STRING";
     else if (val.is_array()) typeName = "ARRAY";
     else if (val.is_map()) {
-      const auto& map = val.as_map();
+      const auto& map = std::as_const(val).as_map();
       auto it = map.find("_type");
       if (it != map.end() && it->second.is_string()) {
         typeName = it->second.as_string();
@@ -898,6 +1368,7 @@ static Value eval(Env& env, FunctionRegistry& R, const Expr* e, bool debug_mode)
       }
     }
     else if (val.is_nil()) typeName = "NIL";
+    else if (val.is_callable()) typeName = "FUNCTION";
     else {
       // Try to determine if it's a number or int
       try {
@@ -925,7 +1396,7 @@ static Value eval(Env& env, FunctionRegistry& R, const Expr* e, bool debug_mode)
     if (!val.is_map()) {
       return Value::from_array({});
     }
-    const auto& map = val.as_map();
+    const auto& map = std::as_const(val).as_map();
     std::vector<Value> props;
     for (const auto& [key, value] : map) {
       if (key != "_type" && key != "_object" && key != "_method" && key != "_function") {
@@ -940,7 +1411,7 @@ static Value eval(Env& env, FunctionRegistry& R, const Expr* e, bool debug_mode)
     if (!val.is_map()) {
       return Value::from_array({});
     }
-    const auto& map = val.as_map();
+    const auto& map = std::as_const(val).as_map();
     std::vector<Value> methods;
     
     // Check if it's a user-defined type
@@ -968,7 +1439,7 @@ static Value eval(Env& env, FunctionRegistry& R, const Expr* e, bool debug_mode)
       throw std::runtime_error("SUPER: can only be called from within a method");
     }
     
-    const auto& objMap = thisObj.as_map();
+    const auto& objMap = std::as_const(thisObj).as_map();
     auto typeIt = objMap.find("_type");
     if (typeIt == objMap.end() || !typeIt->second.is_string()) {
       throw std::runtime_error("SUPER: object has no type");
@@ -1006,7 +1477,7 @@ static Value eval(Env& env, FunctionRegistry& R, const Expr* e, bool debug_mode)
     // Try as user-defined function
     auto itf = g_funcs.find(methodFunc);
     if (itf != g_funcs.end()) {
-      return call_func(env, R, methodFunc, args, {}, debug_mode);
+      return run_func(env, R, itf->second, args, kNoNamedArgs, debug_mode);
     }
     
     throw std::runtime_error("SUPER: parent method " + methodFunc + " not found");
@@ -1054,8 +1525,8 @@ static Value eval(Env& env, FunctionRegistry& R, const Expr* e, bool debug_mode)
     Value::Array result;
     
     if (collection_val.is_array()) {
-      const auto& coll = collection_val.as_array();
-      Env local; local.parent = &env; local.strict = env.strict;
+      const auto& coll = std::as_const(collection_val).as_array();
+      Env local(&env);
       local.declare(comp->var);
       
       for (const auto& item : coll) {
@@ -1084,20 +1555,20 @@ static Value eval(Env& env, FunctionRegistry& R, const Expr* e, bool debug_mode)
       Value idx_val = eval(env, R, null_safe->index.get(), debug_mode);
       if (obj.is_array()) {
         long long idx = idx_val.as_int();
-        const auto& arr = obj.as_array();
+        const auto& arr = std::as_const(obj).as_array();
         if (idx >= 0 && (size_t)idx < arr.size()) {
           return arr[(size_t)idx];
         }
       } else if (obj.is_map()) {
         // Support map indexing with string keys
         if (idx_val.is_string()) {
-          const auto& map = obj.as_map();
+          const auto& map = std::as_const(obj).as_map();
           std::string key = Env::up(idx_val.as_string());
           auto it = map.find(key);
           if (it != map.end()) return it->second;
         } else if (idx_val.is_int()) {
           // Try numeric key as string
-          const auto& map = obj.as_map();
+          const auto& map = std::as_const(obj).as_map();
           std::string key = std::to_string(idx_val.as_int());
           auto it = map.find(key);
           if (it != map.end()) return it->second;
@@ -1113,13 +1584,17 @@ static Value eval(Env& env, FunctionRegistry& R, const Expr* e, bool debug_mode)
       return Value::nil();
     } else {
       // ?.member - enhanced with hooks and deep property access
+      if (const Packed* p = obj.packed()) {
+        int i = packed_field(p->kind, null_safe->member);
+        return i >= 0 ? Value::from_number(p->f[i]) : Value::nil();
+      }
       // Try hooks first (for ECS, etc.)
       if (auto hookValue = try_resolve_member(obj, null_safe->member); hookValue.has_value()) {
         return *hookValue;
       }
       
       if (obj.is_map()) {
-        const auto& map = obj.as_map();
+        const auto& map = std::as_const(obj).as_map();
         std::string member_upper = Env::up(null_safe->member);
         
         // Try direct access first
@@ -1180,7 +1655,7 @@ static Value eval(Env& env, FunctionRegistry& R, const Expr* e, bool debug_mode)
         // Array properties
         if (null_safe->member == "length" || null_safe->member == "LENGTH" || 
             null_safe->member == "size" || null_safe->member == "SIZE") {
-          return Value::from_int(static_cast<long long>(obj.as_array().size()));
+          return Value::from_int(static_cast<long long>(std::as_const(obj).as_array().size()));
         }
       }
       return Value::nil();
@@ -1225,7 +1700,7 @@ static Value eval(Env& env, FunctionRegistry& R, const Expr* e, bool debug_mode)
       }
       // Range matching (if pattern is a range object)
       else if (pattern.is_map()) {
-        const auto& map = pattern.as_map();
+        const auto& map = std::as_const(pattern).as_map();
         auto typeIt = map.find("_type");
         if (typeIt != map.end() && typeIt->second.is_string() && typeIt->second.as_string() == "Range") {
           // Check if value is within range
@@ -1243,7 +1718,7 @@ static Value eval(Env& env, FunctionRegistry& R, const Expr* e, bool debug_mode)
       }
       // Array matching (check if value is in array)
       else if (pattern.is_array()) {
-        const auto& arr = pattern.as_array();
+        const auto& arr = std::as_const(pattern).as_array();
         for (const auto& item : arr) {
           if (cmp_values(value, item) == 0) {
             matches = true;
@@ -1274,89 +1749,87 @@ static Value eval(Env& env, FunctionRegistry& R, const Expr* e, bool debug_mode)
   return Value::nil(); // This line will never be reached, but satisfies the compiler
 }
 
-static void exec(Env& env, FunctionRegistry& R, const Stmt* s, bool debug_mode){
+static Flow exec_stmt(Env& env, FunctionRegistry& R, const Stmt* s, bool debug_mode){
   (void)env; (void)R; (void)s; // Suppress unused parameter warnings
   if(auto ox = dynamic_cast<const OptionExplicit*>(s)){
     env.strict = ox->enabled;
-    return;
+    return Flow::Normal;
   }
   if(auto ld = dynamic_cast<const LocalDecl*>(s)){
     // Declare locals and create a local slot (nil) so they shadow outer/global
     for(const auto& name : ld->names){
-      env.declare(name);
-      env.vars[Env::up(name)] = Value::nil();
+      const Symbol key = intern(name);
+      env.declare(key);
+      env.store_here(key, Value::nil());
     }
-    return;
+    return Flow::Normal;
   }
   if(auto gd = dynamic_cast<const GlobalDecl*>(s)){
     // Mark names as global in this scope; declare at root if in strict mode
     for(const auto& name : gd->names){
-      const std::string key = Env::up(name);
-      env.globals_here.insert(key);
+      const Symbol key = intern(name);
+      env.names_here().globals_here.insert(key);
       Env* r = env.root();
-      if(env.strict && !r->is_declared(name)){
-        r->declare(name);
+      if(env.strict && !r->is_declared(key)){
+        r->declare(key);
       }
     }
-    return;
+    return Flow::Normal;
   }
       if(auto p = dynamic_cast<const Print*>(s)){
       Value v = eval(env,R,p->value.get(), debug_mode);
       (void)call(R, "PRINT", {v});
-      return;
+      return Flow::Normal;
     }
   if(auto pc = dynamic_cast<const PrintC*>(s)){
       Value v = eval(env,R,pc->value.get(), debug_mode);
       (void)call(R, "PRINTC", {v});
-      return;
+      return Flow::Normal;
     }
   if(auto l = dynamic_cast<const Let*>(s)){
     env.declare(l->name);
-    env.set(l->name, eval(env,R,l->value.get(), debug_mode)); return;
+    env.set(l->name, eval(env,R,l->value.get(), debug_mode)); return Flow::Normal;
   }
   if(auto cd = dynamic_cast<const ConstDecl*>(s)){
     // Safety: Check if constant already exists in current scope
     // Allow shadowing from parent scopes, but prevent redefinition in same scope
-    std::string key = Env::up(cd->name);
+    const Symbol key = intern(cd->name);
     if(env.is_const_here(key)){
-      throw std::runtime_error("Constant '" + key + "' is already defined in this scope");
+      throw std::runtime_error("Constant '" + symbol_name(key) + "' is already defined in this scope");
     }
     Value v = eval(env,R,cd->value.get(), debug_mode);
-    env.define_const(cd->name, std::move(v));
-    return;
+    env.define_const(key, std::move(v));
+    return Flow::Normal;
   }
   if(dynamic_cast<const ImportStmt*>(s)){
     // Imports are expanded before interpretation; nothing to do at runtime
-    return;
+    return Flow::Normal;
   }
   if(auto a = dynamic_cast<const Assign*>(s)){
-    env.set(a->name, eval(env,R,a->value.get(), debug_mode)); return;
+    if(auto c = dynamic_cast<const Call*>(a->value.get()); c && c->namedArgs.empty()
+       && exec_inplace(env, R, c->cache, c->callee, c->args, &a->name, debug_mode)) return Flow::Normal;
+    env.set(a->sym, eval(env,R,a->value.get(), debug_mode)); return Flow::Normal;
   }
   if(auto e = dynamic_cast<const ExprStmt*>(s)){
-    (void)eval(env,R,e->expr.get(), debug_mode); return;
+    if(auto c = dynamic_cast<const Call*>(e->expr.get()); c && c->namedArgs.empty()
+       && exec_inplace(env, R, c->cache, c->callee, c->args, nullptr, debug_mode)) return Flow::Normal;
+    (void)eval(env,R,e->expr.get(), debug_mode); return Flow::Normal;
   }
   if(auto c = dynamic_cast<const CallStmt*>(s)){
-    std::vector<Value> args; for(auto& x:c->args) args.push_back(eval(env,R,x.get(), debug_mode));
-    auto it = g_subs.find(Env::up(c->name));
-    if(it!=g_subs.end()) { call_sub(env,R,c->name,args, debug_mode); return; }
-    auto itf = g_funcs.find(Env::up(c->name));
-    if(itf!=g_funcs.end()) { (void)call_func(env,R,c->name,args, {}, debug_mode); return; }
-    (void)call(R,c->name,args); return;
+    if(exec_inplace(env, R, c->cache, c->name, c->args, nullptr, debug_mode)) return Flow::Normal;
+    ArgFrame args(c->args.size());
+    for(auto& x:c->args) args.push(eval(env,R,x.get(), debug_mode));
+    (void)invoke(env, R, resolve_call(c->cache, R, c->name), c->name, args.args(), kNoNamedArgs, debug_mode);
+    return Flow::Normal;
   }
   if(auto w = dynamic_cast<const WhileWend*>(s)){
     while(truthy(eval(env,R,w->cond.get(), debug_mode))){
-      try {
-        for(auto& ss : w->body) exec(env,R,ss.get(), debug_mode);
-      } catch(const BreakSignal&) {
-        break; // Exit the loop
-      } catch(const ExitSignal& es) {
-        if(es.target == "while") break;
-        throw; // Re-throw if not for this loop type
-      } catch(const ContinueSignal&) {
-        // Continue to next iteration
-      }
+      Flow f = exec_block(env, R, w->body, debug_mode);
+      if(f == Flow::Normal || f == Flow::Continue) continue;
+      if(leaves_loop(f, "while")) break;
+      return f; // RETURN, or EXIT for an outer block
     }
-    return;
+    return Flow::Normal;
   }
   if(auto f = dynamic_cast<const ForNext*>(s)){
     // Initialize loop variable
@@ -1364,9 +1837,8 @@ static void exec(Env& env, FunctionRegistry& R, const Stmt* s, bool debug_mode){
     if (debug_mode) std::cerr << "FOR start: " << value_to_string_safe(start_val) << std::endl;
     Value limit_val = eval(env, R, f->limit.get(), debug_mode);
     if (debug_mode) std::cerr << "FOR limit: " << value_to_string_safe(limit_val) << std::endl;
-    Value step_val = f->step ? eval(env, R, f->step.get(), debug_mode) : Value::from_number(1.0);
+    Value step_val = f->step ? eval(env, R, f->step.get(), debug_mode) : Value::from_int(1);
     if (debug_mode) std::cerr << "FOR step: " << value_to_string_safe(step_val) << std::endl;
-    double init = start_val.as_number();
     double limit = limit_val.as_number();
     double step = step_val.as_number();
     if(debug_mode){
@@ -1375,46 +1847,42 @@ static void exec(Env& env, FunctionRegistry& R, const Stmt* s, bool debug_mode){
                 << " limit=" << value_to_string_safe(limit_val)
                 << " step=" << value_to_string_safe(step_val) << std::endl;
     }
-    env.declare(f->var);
-    env.set(f->var, Value::from_number(init));
-    auto cond = [&](double v){ return step >= 0 ? (v <= limit) : (v >= limit); };
+    bool ints = start_val.is_int() && step_val.is_int();
+    env.declare(f->var_sym);
+    env.set(f->var_sym, ints ? start_val : Value::from_number(start_val.as_number()));
+    // The counter is read and stepped through a reference to its storage
+    // rather than by name. Bindings are never erased, so the reference only
+    // goes stale when a CONST or GLOBAL in the body rebinds the name; the
+    // step then goes through env.set() and the reference is re-fetched.
+    Value* counter = &env.lvalue(f->var_sym);
+    size_t consts_seen = env.const_count(), globals_seen = env.global_count();
+    const long long* int_step = std::get_if<long long>(&step_val.v);
     while(true){
-      double cur;
-      try {
-        cur = env.get(f->var).as_number();
-      } catch(const std::exception& e){
-        if(debug_mode){
-          std::cerr << "[FOR] non-numeric loop var '" << f->var << "' encountered: " << e.what() << std::endl;
-        }
-        throw; // rethrow
-      }
-      if(!cond(cur)) break;
-      try {
-        for(auto& ss : f->body) exec(env,R,ss.get(), debug_mode);
-      } catch(const BreakSignal&) {
-        break; // Exit the loop
-      } catch(const ExitSignal& es) {
-        if(es.target == "for") break;
-        throw; // Re-throw if not for this loop type
-      } catch(const ContinueSignal&) {
-        // fallthrough to step update
+      double cur = counter->as_number();
+      if(step >= 0 ? !(cur <= limit) : !(cur >= limit)) break;
+      Flow fl = exec_block(env, R, f->body, debug_mode);
+      if(leaves_loop(fl, "for")) break;
+      if(fl == Flow::Return || fl == Flow::Exit) return fl;
+      // Normal completion and CONTINUE fall through to the step update
+      if(env.const_count() != consts_seen || env.global_count() != globals_seen){
+        env.set(f->var_sym, for_step(env.get(f->var_sym), step_val));
+        counter = &env.lvalue(f->var_sym);
+        consts_seen = env.const_count();
+        globals_seen = env.global_count();
+      } else if(long long* c = std::get_if<long long>(&counter->v);
+                c && int_step && (*int_step >= 0 ? *c <= LLONG_MAX - *int_step : *c >= LLONG_MIN - *int_step)){
+        *c += *int_step;
+      } else {
+        *counter = for_step(*counter, step_val);
       }
-      env.set(f->var, Value::from_number(env.get(f->var).as_number() + step));
     }
-    return;
+    return Flow::Normal;
   }
   if(auto d = dynamic_cast<const DoLoop*>(s)){
     while(true){
-      try{
-        for(auto& ss : d->body) exec(env,R,ss.get(), debug_mode);
-      } catch(const BreakSignal&){
-        break;
-      } catch(const ExitSignal& es) {
-        if(es.target == "do" || es.target == "loop") break;
-        throw; // Re-throw if not for this loop type
-      } catch(const ContinueSignal&){
-        // continue next iteration
-      }
+      Flow f = exec_block(env, R, d->body, debug_mode);
+      if(leaves_loop(f, "do")) break;
+      if(f == Flow::Return || f == Flow::Exit) return f;
       
       // Check LOOP UNTIL condition (exit when true)
       if(d->hasUntil) {
@@ -1425,60 +1893,50 @@ static void exec(Env& env, FunctionRegistry& R, const Stmt* s, bool debug_mode){
         if(!truthy(eval(env, R, d->whileCond.get(), debug_mode))) break;
       }
     }
-    return;
+    return Flow::Normal;
   }
   if(auto ru = dynamic_cast<const RepeatUntil*>(s)){
     while(true){
-      try{
-        for(auto& ss : ru->body) exec(env,R,ss.get(), debug_mode);
-      } catch(const BreakSignal&){
-        break;
-      } catch(const ExitSignal& es) {
-        if(es.target == "repeat" || es.target == "until") break;
-        throw; // Re-throw if not for this loop type
-      } catch(const ContinueSignal&){
-        // after continue, still evaluate condition for post-test semantics
-      }
+      Flow f = exec_block(env, R, ru->body, debug_mode);
+      if(leaves_loop(f, "repeat")) break;
+      if(f == Flow::Return || f == Flow::Exit) return f;
+      // after CONTINUE, still evaluate condition for post-test semantics
       if(truthy(eval(env,R,ru->cond.get(), debug_mode))) break;
     }
-    return;
+    return Flow::Normal;
   }
   if(auto i = dynamic_cast<const IfThenEndIf*>(s)){
-    if(truthy(eval(env,R,i->cond.get(), debug_mode))){ for(auto& ss:i->body) exec(env,R,ss.get(), debug_mode); }
-    return;
+    if(truthy(eval(env,R,i->cond.get(), debug_mode))) return exec_block(env, R, i->body, debug_mode);
+    return Flow::Normal;
   }
   if(auto ic = dynamic_cast<const IfChain*>(s)){
-    bool ran = false;
     for(const auto& br : ic->branches){
       if(truthy(eval(env, R, br.cond.get(), debug_mode))){
-        for(const auto& ss : br.body) exec(env, R, ss.get(), debug_mode);
-        ran = true;
-        break;
+        return exec_block(env, R, br.body, debug_mode);
       }
     }
-    if(!ran && ic->hasElse){
-      for(const auto& ss : ic->elseBody) exec(env, R, ss.get(), debug_mode);
-    }
-    return;
+    if(ic->hasElse) return exec_block(env, R, ic->elseBody, debug_mode);
+    return Flow::Normal;
   }
   if(auto r = dynamic_cast<const Return*>(s)){
-    Value rv = r->value ? eval(env,R,r->value.get(), debug_mode) : Value::nil();
-    throw ReturnSignal{rv};
+    g_return_value = r->value ? eval(env,R,r->value.get(), debug_mode) : Value::nil();
+    return Flow::Return;
   }
   if(dynamic_cast<const Break*>(s)){
-    throw BreakSignal{};
+    return Flow::Break;
   }
   if(dynamic_cast<const Continue*>(s)){
-    throw ContinueSignal{};
+    return Flow::Continue;
   }
   if(auto e = dynamic_cast<const Exit*>(s)){
-    throw ExitSignal{e->target};
+    g_exit_target = e->target;
+    return Flow::Exit;
   }
   if(auto d = dynamic_cast<const Dim*>(s)){
     Value v = make_array_from_sizes(env, R, d->sizes, 0, debug_mode);
     env.declare(d->name);
     env.set(d->name, std::move(v));
-    return;
+    return Flow::Normal;
   }
   if(auto rd = dynamic_cast<const Redim*>(s)){
     if(env.is_const(rd->name)){
@@ -1534,103 +1992,28 @@ static void exec(Env& env, FunctionRegistry& R, const Stmt* s, bool debug_mode){
       Value v = make_array_from_sizes(env, R, rd->sizes, 0, debug_mode);
       env.set(rd->name, std::move(v));
     }
-    return;
+    return Flow::Normal;
   }
   if(auto ai = dynamic_cast<const AssignIndex*>(s)){
-    if(env.is_const(ai->name)){
+    if(env.is_const(ai->sym)){
       throw std::runtime_error("Indexed assignment to constant '" + Env::up(ai->name) + "'");
     }
-    Value target = env.get(ai->name);
-    if(!target.is_array()) target = Value::from_array({});
-    // Traverse/create nested arrays according to indices except last
-    Value* current = &target;
-    for(size_t d=0; d+1<ai->indices.size(); ++d){
-      long long idx = eval(env, R, ai->indices[d].get(), debug_mode).as_int();
-      if(idx < 0) return; // ignore
-      auto& arr = current->as_array();
-      if((size_t)idx >= arr.size()) arr.resize((size_t)idx+1, Value::nil());
-      if(!arr[(size_t)idx].is_array()) arr[(size_t)idx] = Value::from_array({});
-      current = &arr[(size_t)idx];
-    }
-    // Set final element
-    if(ai->indices.empty()) return; // nothing to do
-    long long last = eval(env, R, ai->indices.back().get(), debug_mode).as_int();
-    if(last < 0) return;
-    auto& arr = current->as_array();
-    if((size_t)last >= arr.size()) arr.resize((size_t)last+1, Value::nil());
-    arr[(size_t)last] = eval(env, R, ai->value.get(), debug_mode);
-    env.set(ai->name, std::move(target));
-    return;
+    if(ai->indices.empty()) return Flow::Normal; // nothing to do
+    ArgFrame path(ai->indices.size());
+    for(const auto& ie : ai->indices) path.push(eval(env, R, ie.get(), debug_mode));
+    Value val = eval(env, R, ai->value.get(), debug_mode);
+    store_index(env.lvalue(ai->sym), path.args(), std::move(val));
+    return Flow::Normal;
   }
   if(auto am = dynamic_cast<const AssignMember*>(s)){
-    Value obj = eval(env, R, am->object.get(), debug_mode);
+    // Variables are updated in place; any other target is a temporary
+    auto var = dynamic_cast<const Variable*>(am->object.get());
+    Value temp;
+    if(!var) temp = eval(env, R, am->object.get(), debug_mode);
+    Value& obj = var ? env.lvalue(var->sym) : temp;
     Value val = eval(env, R, am->value.get(), debug_mode);
-    
-    // Try hooks first (for ECS, etc.)
-    if(try_assign_member(obj, am->member, val)){
-      if(auto var = dynamic_cast<const Variable*>(am->object.get())){
-        env.set(var->name, obj);
-      }
-      return;
-    }
-    
-    // Check if object is a map (object)
-    if(obj.is_map()){
-      auto& map = obj.as_map();
-      std::string memberUpper = Env::up(am->member);
-      
-      // Check property descriptors for setters
-      std::string objId;
-      auto idIt = map.find("_id");
-      if (idIt != map.end() && idIt->second.is_int()) {
-        objId = std::to_string(idIt->second.as_int());
-        // In a real implementation, would check g_property_descriptors here for setters
-        // If setter exists, call it instead of direct assignment
-      }
-      
-      // Check if property is writable (from descriptor)
-      // In a real implementation, would check descriptor.writable flag
-      
-      // Try deep property assignment
-      if (set_deep_property(obj, am->member, val)) {
-        // If the object came from a variable, update it
-        if(auto var = dynamic_cast<const Variable*>(am->object.get())){
-          env.set(var->name, obj);
-        }
-        return;
-      }
-      
-      // Try case-insensitive assignment
-      bool found = false;
-      for (auto& pair : map) {
-        if (Env::up(pair.first) == memberUpper) {
-          pair.second = val;
-          found = true;
-          break;
-        }
-      }
-      
-      if (!found) {
-        // Fallback to simple assignment (key already normalized)
-        map[memberUpper] = val;
-      }
-      
-      // If the object came from a variable, update it
-      if(auto var = dynamic_cast<const Variable*>(am->object.get())){
-        env.set(var->name, obj);
-      }
-      return;
-    }
-    
-    // If not a map, create one
-    Value::Map new_obj;
-    new_obj[Env::up(am->member)] = val;
-    Value new_value = Value::from_map(std::move(new_obj));
-    
-    if(auto var = dynamic_cast<const Variable*>(am->object.get())){
-      env.set(var->name, new_value);
-    }
-    return;
+    assign_member(obj, am, std::move(val));
+    return Flow::Normal;
   }
   if(auto sc = dynamic_cast<const SelectCaseStmt*>(s)){
     // Evaluate selector once
@@ -1666,27 +2049,21 @@ static void exec(Env& env, FunctionRegistry& R, const Stmt* s, bool debug_mode){
           if(cmp_values(sel, cv) == 0){ doRun = true; break; }
         }
       }
-      if(doRun){
-        for(const auto& ss : br.body) exec(env, R, ss.get(), debug_mode);
-        return;
-      }
+      if(doRun) return exec_block(env, R, br.body, debug_mode);
     }
     // Second pass: ELSE
     for(const auto& br : sc->branches){
-      if(br.isElse){
-        for(const auto& ss : br.body) exec(env, R, ss.get(), debug_mode);
-        break;
-      }
+      if(br.isElse) return exec_block(env, R, br.body, debug_mode);
     }
-    return;
+    return Flow::Normal;
   }
   if(dynamic_cast<const SubDecl*>(s)){
     // SubDecl statements are handled during program collection, not execution
-    return;
+    return Flow::Normal;
   }
   if(dynamic_cast<const FunctionDecl*>(s)){
     // FunctionDecl statements are handled during program collection, not execution
-    return;
+    return Flow::Normal;
   }
   
   // Extension statement types (to be implemented)
@@ -1710,29 +2087,29 @@ static void exec(Env& env, FunctionRegistry& R, const Stmt* s, bool debug_mode){
         return typeReg->createInstance(ctorName);
       }});
     }
-    return;
+    return Flow::Normal;
   }
   if (auto fe = dynamic_cast<const ForEach*>(s)) {
     Value collection = eval(env, R, fe->collection.get(), debug_mode);
     if (collection.is_array()) {
-      for (const auto& item : collection.as_array()) {
+      for (const auto& item : std::as_const(collection).as_array()) {
         env.set(fe->var, item);
-        for (const auto& bodyStmt : fe->body) {
-          exec(env, R, bodyStmt.get(), debug_mode);
-        }
+        Flow f = exec_block(env, R, fe->body, debug_mode);
+        if (leaves_loop(f, "for")) break;
+        if (f == Flow::Return || f == Flow::Exit) return f;
       }
     } else if (collection.is_map()) {
-      for (const auto& [key, value] : collection.as_map()) {
+      for (const auto& [key, value] : std::as_const(collection).as_map()) {
         Value::Map pair;
         pair["key"] = Value::from_string(key);
         pair["value"] = value;
         env.set(fe->var, Value::from_map(std::move(pair)));
-        for (const auto& bodyStmt : fe->body) {
-          exec(env, R, bodyStmt.get(), debug_mode);
-        }
+        Flow f = exec_block(env, R, fe->body, debug_mode);
+        if (leaves_loop(f, "for")) break;
+        if (f == Flow::Return || f == Flow::Exit) return f;
       }
     }
-    return;
+    return Flow::Normal;
   }
   if (auto ast = dynamic_cast<const AssertStmt*>(s)) {
     Value condition = eval(env, R, ast->condition.get(), debug_mode);
@@ -1744,33 +2121,32 @@ static void exec(Env& env, FunctionRegistry& R, const Stmt* s, bool debug_mode){
       }
       throw std::runtime_error(message);
     }
-    return;
+    return Flow::Normal;
   }
   if (auto bp = dynamic_cast<const BreakpointStmt*>(s)) {
     (void)bp; // Suppress unused variable warning
     if (debug_mode) {
       std::cerr << "[BREAKPOINT] Execution paused" << std::endl;
     }
-    return;
+    return Flow::Normal;
   }
   if (auto using_block = dynamic_cast<const UsingBlock*>(s)) {
     // Evaluate resource
     Value resource = eval(env, R, using_block->resource.get(), debug_mode);
-    Env local; local.parent = &env; local.strict = env.strict;
+    Env local(&env);
     local.declare(using_block->varName);
     local.set(using_block->varName, resource);
     
+    Flow f;
     try {
       // Execute body
-      for (auto& stmt : using_block->body) {
-        exec(local, R, stmt.get(), debug_mode);
-      }
+      f = exec_block(local, R, using_block->body, debug_mode);
     } catch (...) {
       // Re-throw - cleanup would happen here if needed
       throw;
     }
     // Automatic cleanup (if resource has cleanup method, call it)
-    return;
+    return f;
   }
   if (auto enum_decl = dynamic_cast<const EnumDecl*>(s)) {
     // Register enum values as constants
@@ -1790,24 +2166,24 @@ static void exec(Env& env, FunctionRegistry& R, const Stmt* s, bool debug_mode){
       // Also register just the value name (without enum prefix) for convenience
       env.define_const(enumVal.name, value);
     }
-    return;
+    return Flow::Normal;
   }
   if (auto union_decl = dynamic_cast<const UnionDecl*>(s)) {
     (void)union_decl; // Suppress unused variable warning
     // Register union type (for now, just store the declaration)
     // Full implementation would require type checking
-    return;
+    return Flow::Normal;
   }
   if (auto destr = dynamic_cast<const DestructureAssign*>(s)) {
     Value value = eval(env, R, destr->value.get(), debug_mode);
     if (value.is_array()) {
-      const auto& arr = value.as_array();
+      const auto& arr = std::as_const(value).as_array();
       for (size_t i = 0; i < destr->names.size() && i < arr.size(); ++i) {
         env.declare(destr->names[i]);
         env.set(destr->names[i], arr[i]);
       }
     } else if (value.is_map()) {
-      const auto& map = value.as_map();
+      const auto& map = std::as_const(value).as_map();
       for (const auto& name : destr->names) {
         std::string key = Env::up(name);
         auto it = map.find(key);
@@ -1815,77 +2191,697 @@ static void exec(Env& env, FunctionRegistry& R, const Stmt* s, bool debug_mode){
         env.set(name, it != map.end() ? it->second : Value::nil());
       }
     }
-    return;
+    return Flow::Normal;
   }
+  // Coroutine bodies suspend at YIELD/AWAIT through the VM (Op::Yield and
+  // Op::Await); statements run here cannot suspend.
   if (auto await_stmt = dynamic_cast<const AwaitStmt*>(s)) {
-    // Evaluate the awaited expression
-    // In a full async implementation, this would suspend until the async operation completes
-    Value result = eval(env, R, await_stmt->expression.get(), debug_mode);
-    // For now, just evaluate synchronously
-    // TODO: Implement proper async/await with coroutines
-    return;
+    await_blocking(eval(env, R, await_stmt->expression.get(), debug_mode));
+    return Flow::Normal;
   }
   if (auto yield_stmt = dynamic_cast<const YieldStmt*>(s)) {
-    (void)yield_stmt; // Suppress unused variable warning
-    // YIELD pauses execution until next frame/iteration
-    // For now, just continue (full coroutine support would suspend here)
-    // TODO: Implement proper coroutine suspension
-    return;
+    if (yield_stmt->value) (void)eval(env, R, yield_stmt->value.get(), debug_mode);
+    if (g_coroutine) throw std::runtime_error("YIELD cannot suspend the coroutine from inside this block");
+    return Flow::Normal; // outside coroutines YIELD does nothing
   }
   if (auto dp = dynamic_cast<const DebugPrintStmt*>(s)) {
     if (debug_mode) {
       Value val = eval(env, R, dp->value.get(), debug_mode);
       std::cerr << "[DEBUG] " << (val.is_string() ? val.as_string() : std::to_string(to_num(val))) << std::endl;
     }
-    return;
+    return Flow::Normal;
+  }
+  if (auto gs = dynamic_cast<const Gosub*>(s); gs && g_jump_scope) {
+    return exec_gosub(env, R, gs, debug_mode);
+  }
+  if (dynamic_cast<const Goto*>(s) || dynamic_cast<const Gosub*>(s)) {
+    throw LabelJump{s};
+  }
+  return Flow::Normal;
+}
+
+static Flow exec(Env& env, FunctionRegistry& R, const Stmt* s, bool debug_mode){
+  if(g_profiling) [[unlikely]] profile_statement(s->line);
+  try{
+    return exec_stmt(env, R, s, debug_mode);
+  } catch(const FlowEscape& fe){
+    return fe.flow; // BREAK/CONTINUE/EXIT that left a called SUB/FUNCTION
+  }
+}
+
+static Flow exec_block(Env& env, FunctionRegistry& R, const std::vector<std::unique_ptr<Stmt>>& body, bool debug_mode){
+  for(const auto& s : body){
+    Flow f = exec(env, R, s.get(), debug_mode);
+    if(f != Flow::Normal) return f;
+  }
+  return Flow::Normal;
+}
+
+// ===== Bytecode VM =====
+// Register machine executing chunks produced by BytecodeCompiler. Variables
+// still live in Env; registers hold temporaries. Statements and expressions
+// without a native lowering defer to exec()/eval().
+
+static bool g_bytecode_enabled = true;
+static std::unordered_map<const void*, std::unique_ptr<Chunk>> g_chunks; // SubDecl*/FunctionDecl*/LambdaExpr* -> compiled body
+
+static const Chunk& sub_chunk(const SubDecl* sd){
+  auto it = g_chunks.find(sd);
+  if(it == g_chunks.end()){
+    BytecodeCompiler compiler;
+    it = g_chunks.emplace(sd, compiler.compile_body(sd->name, "sub", sd->params, sd->body)).first;
+  }
+  return *it->second;
+}
+
+static const Chunk& func_chunk(const FunctionDecl* fd){
+  auto it = g_chunks.find(fd);
+  if(it == g_chunks.end()){
+    std::vector<std::string> params;
+    params.reserve(fd->params.size());
+    for(const auto& p : fd->params) params.push_back(p.name);
+    BytecodeCompiler compiler;
+    it = g_chunks.emplace(fd, compiler.compile_body(fd->name, "function", params, fd->body)).first;
+  }
+  return *it->second;
+}
+
+static const Chunk& lambda_chunk(const LambdaExpr* lambda){
+  auto it = g_chunks.find(lambda);
+  if(it == g_chunks.end()){
+    std::vector<std::string> params;
+    params.reserve(lambda->params.size());
+    for(const auto& p : lambda->params) params.push_back(p.name);
+    BytecodeCompiler compiler;
+    it = g_chunks.emplace(lambda, compiler.compile_body("lambda", "function", params, lambda->body)).first;
+  }
+  return *it->second;
+}
+
+// Declare and assign a parameter, through its slot when it has one.
+static void bind_param(Env& local, const Chunk* ch, size_t i, const std::string& name, Value v){
+  int slot = ch ? ch->param_slots[i] : -1;
+  if(slot >= 0){
+    local.declare_slot(slot);
+    local.set_slot(slot, std::move(v));
+  } else {
+    local.declare(name);
+    local.set(name, std::move(v));
+  }
+}
+
+// Route a BREAK/CONTINUE/EXIT produced at instruction `at` to the enclosing
+// compiled loop. Returns the resume address, or -1 when the flow leaves the chunk.
+static int route_flow(const Chunk& ch, size_t at, Flow f){
+  if(f == Flow::Return) return -1;
+  int ctx = ch.loop_at[at];
+  if(f == Flow::Exit){
+    while(ctx >= 0 && !exit_matches(ch.loops[ctx].kind, g_exit_target)) ctx = ch.loops[ctx].parent;
+  }
+  if(ctx < 0) return -1;
+  return f == Flow::Continue ? ch.loops[ctx].continue_target : ch.loops[ctx].break_target;
+}
+
+// A jump the VM cannot take: its label is not one of the chunk's.
+[[noreturn]] static void unsupported_jump(const LabelJump& j){
+  if(auto gt = dynamic_cast<const Goto*>(j.stmt)){
+    throw std::runtime_error("GOTO " + gt->label + " is not supported inside this block");
+  }
+  throw std::runtime_error("GOSUB " + static_cast<const Gosub*>(j.stmt)->label + " is not supported inside this block");
+}
+
+// End of a SUB/FUNCTION body: RETURN or a matching EXIT completes the call,
+// any other flow escapes to the caller's enclosing loop.
+static void finish_call(Flow f, const char* kind){
+  if(f == Flow::Normal || f == Flow::Return) return;
+  if(f == Flow::Exit && g_exit_target == kind) return;
+  throw FlowEscape{f};
+}
+
+
+// Quickened form of a generic arithmetic or comparison op for the operands
+// it has just seen, or `op` itself when no fast path applies.
+static Op quicken(Op op, const Value& L, const Value& R){
+  OperandKind k = operand_kind(L, R, op == Op::Add);
+  if(k == OperandKind::Generic) return op;
+  if(k == OperandKind::Str) return Op::AddStr;
+  bool i = k == OperandKind::Int;
+  switch(op){
+    case Op::Add: return i ? Op::AddInt : Op::AddNum;
+    case Op::Sub: return i ? Op::SubInt : Op::SubNum;
+    case Op::Mul: return i ? Op::MulInt : Op::MulNum;
+    case Op::Eq:  return i ? Op::EqInt : Op::EqNum;
+    case Op::Neq: return i ? Op::NeqInt : Op::NeqNum;
+    case Op::Lt:  return i ? Op::LtInt : Op::LtNum;
+    case Op::Lte: return i ? Op::LteInt : Op::LteNum;
+    case Op::Gt:  return i ? Op::GtInt : Op::GtNum;
+    case Op::Gte: return i ? Op::GteInt : Op::GteNum;
+    default: return op;
+  }
+}
+
+// Runs a chunk to completion. Flow::Return leaves its value in g_return_value.
+static Flow run_chunk(Env& env, FunctionRegistry& R, const Chunk& ch, ChunkState& st, bool debug_mode);
+
+static Flow run_chunk(Env& env, FunctionRegistry& R, const Chunk& ch, bool debug_mode){
+  ChunkState st;
+  st.regs = st.reg_store.push(static_cast<size_t>(ch.num_regs));
+  return run_chunk(env, R, ch, st, debug_mode);
+}
+
+// The loop is instantiated twice: Profiling polls the sampling profiler
+// before each instruction, the other is the plain interpreter loop.
+template <bool Profiling>
+static Flow run_chunk_loop(Env& env, FunctionRegistry& R, const Chunk& ch, ChunkState& st, bool debug_mode){
+  Value* const regs = st.regs;
+  std::vector<size_t>& gosub_stack = st.gosub_stack;
+  const Instr* const code = ch.code.data();
+  size_t pc = st.pc;
+  int* const profiled_line = Profiling ? &profile_line() : nullptr;
+
+#if defined(__GNUC__) || defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+  // Labels in Op declaration order
+  static void* const dispatch[] = {
+    &&op_LoadK, &&op_LoadNil, &&op_Move, &&op_GetVar, &&op_SetVar, &&op_DeclVar,
+    &&op_GetSlot, &&op_SetSlot, &&op_DeclSlot,
+    &&op_Add, &&op_Sub, &&op_Mul, &&op_Div, &&op_IntDiv, &&op_Pow, &&op_Mod,
+    &&op_Eq, &&op_Neq, &&op_Lt, &&op_Lte, &&op_Gt, &&op_Gte,
+    &&op_And, &&op_Or, &&op_Xor,
+    &&op_Neg, &&op_Pos, &&op_Not, &&op_BitNot,
+    &&op_AddInt, &&op_AddNum, &&op_AddStr, &&op_SubInt, &&op_SubNum, &&op_MulInt, &&op_MulNum,
+    &&op_EqInt, &&op_EqNum, &&op_NeqInt, &&op_NeqNum, &&op_LtInt, &&op_LtNum,
+    &&op_LteInt, &&op_LteNum, &&op_GtInt, &&op_GtNum, &&op_GteInt, &&op_GteNum,
+    &&op_Jmp, &&op_JmpIfFalse, &&op_JmpIfTrue, &&op_JmpIfNotNil,
+    &&op_Call, &&op_CallStmt, &&op_CallInPlace, &&op_Print, &&op_PrintC, &&op_Index, &&op_GetField, &&op_SetIndex, &&op_SetField, &&op_NewArray,
+    &&op_ForPrep, &&op_ForLoop, &&op_ForLoopInt, &&op_ForEachNext, &&op_Eval, &&op_Exec, &&op_Signal,
+    &&op_Gosub, &&op_GosubReturn, &&op_Yield, &&op_Await, &&op_Ret, &&op_RetNil, &&op_Halt, &&op_Fail, &&op_Nop
+  };
+  static_assert(sizeof(dispatch) / sizeof(dispatch[0]) == static_cast<size_t>(Op::Nop) + 1,
+                "dispatch table out of sync with Op");
+#define VM_CASE(name) op_##name:
+#define VM_NEXT() do { VM_PROFILE(); in = &code[pc++]; goto *dispatch[static_cast<size_t>(in->op)]; } while(0)
+#define VM_BEGIN() VM_NEXT();
+#define VM_END()
+#else
+#define VM_CASE(name) case Op::name:
+#define VM_NEXT() continue
+#define VM_BEGIN() for(;;){ VM_PROFILE(); in = &code[pc++]; switch(in->op){
+#define VM_END() } }
+#endif
+#define VM_PROFILE() \
+  if constexpr(Profiling){ \
+    *profiled_line = ch.line_at[pc]; \
+    if(g_profile_due.load(std::memory_order_relaxed)) profile_sample(); \
+  }
+
+  for(;;){
+    const Instr* in = nullptr;
+    try{
+      VM_BEGIN()
+      VM_CASE(LoadK) regs[in->a] = ch.consts[in->b]; VM_NEXT();
+      VM_CASE(LoadNil) regs[in->a] = Value::nil(); VM_NEXT();
+      VM_CASE(Move) regs[in->a] = regs[in->b]; VM_NEXT();
+      VM_CASE(GetVar) regs[in->a] = env.get(ch.names[in->b]); VM_NEXT();
+      VM_CASE(SetVar) env.set(ch.names[in->a], regs[in->b]); VM_NEXT();
+      VM_CASE(DeclVar) env.declare(ch.names[in->a]); VM_NEXT();
+      VM_CASE(GetSlot) regs[in->a] = env.get_slot(in->b); VM_NEXT();
+      VM_CASE(SetSlot) env.set_slot(in->a, regs[in->b]); VM_NEXT();
+      VM_CASE(DeclSlot) env.declare_slot(in->a); VM_NEXT();
+      VM_CASE(Add) {
+        const Value& L = regs[in->b];
+        const Value& Rv = regs[in->c];
+        in->op = quicken(Op::Add, L, Rv);
+        regs[in->a] = add_values(L, Rv);
+        VM_NEXT();
+      }
+      VM_CASE(Sub) {
+        in->op = quicken(Op::Sub, regs[in->b], regs[in->c]);
+        regs[in->a] = sub_values(regs[in->b], regs[in->c]);
+        VM_NEXT();
+      }
+      VM_CASE(Mul) {
+        in->op = quicken(Op::Mul, regs[in->b], regs[in->c]);
+        regs[in->a] = mul_values(regs[in->b], regs[in->c]);
+        VM_NEXT();
+      }
+      VM_CASE(Div) regs[in->a] = Value::from_number(to_num(regs[in->b]) / to_num(regs[in->c])); VM_NEXT();
+      VM_CASE(IntDiv) {
+        long long lhs = static_cast<long long>(to_num(regs[in->b]));
+        long long rhs = static_cast<long long>(to_num(regs[in->c]));
+        if(rhs == 0) throw std::runtime_error("Integer division by zero");
+        regs[in->a] = Value::from_int(lhs / rhs);
+        VM_NEXT();
+      }
+      VM_CASE(Pow) regs[in->a] = Value::from_number(std::pow(to_num(regs[in->b]), to_num(regs[in->c]))); VM_NEXT();
+      VM_CASE(Mod) {
+        double rhs = to_num(regs[in->c]);
+        if(rhs == 0.0) throw std::runtime_error("Modulo by zero");
+        regs[in->a] = Value::from_number(std::fmod(to_num(regs[in->b]), rhs));
+        VM_NEXT();
+      }
+#define VM_COMPARE(name) \
+      VM_CASE(name) { \
+        in->op = quicken(Op::name, regs[in->b], regs[in->c]); \
+        regs[in->a] = Value::from_bool(cmp_holds(Tok::name, cmp_values(regs[in->b], regs[in->c]))); \
+        VM_NEXT(); \
+      }
+      VM_COMPARE(Eq) VM_COMPARE(Neq) VM_COMPARE(Lt) VM_COMPARE(Lte) VM_COMPARE(Gt) VM_COMPARE(Gte)
+#undef VM_COMPARE
+      VM_CASE(And) regs[in->a] = Value::from_bool(truthy(regs[in->b]) && truthy(regs[in->c])); VM_NEXT();
+      VM_CASE(Or)  regs[in->a] = Value::from_bool(truthy(regs[in->b]) || truthy(regs[in->c])); VM_NEXT();
+      VM_CASE(Xor) regs[in->a] = Value::from_bool(truthy(regs[in->b]) != truthy(regs[in->c])); VM_NEXT();
+      VM_CASE(Neg) regs[in->a] = negate_value(regs[in->b]); VM_NEXT();
+      VM_CASE(Pos) regs[in->a] = regs[in->b].is_int() ? regs[in->b] : Value::from_number(+to_num(regs[in->b])); VM_NEXT();
+      VM_CASE(Not) regs[in->a] = Value::from_bool(!truthy(regs[in->b])); VM_NEXT();
+      VM_CASE(BitNot) regs[in->a] = Value::from_int(~static_cast<long long>(to_num(regs[in->b]))); VM_NEXT();
+      // Quickened ops: on an operand-type miss, revert to the generic op and
+      // re-dispatch the same instruction.
+#define VM_QUICK_INT(name, generic, result) \
+      VM_CASE(name) { \
+        const Value& L = regs[in->b]; \
+        const Value& Rv = regs[in->c]; \
+        if(!L.is_int() || !Rv.is_int()){ in->op = Op::generic; --pc; VM_NEXT(); } \
+        long long x = *std::get_if<long long>(&L.v), y = *std::get_if<long long>(&Rv.v); \
+        regs[in->a] = result; \
+        VM_NEXT(); \
+      }
+#define VM_QUICK_NUM(name, generic, result) \
+      VM_CASE(name) { \
+        const Value& L = regs[in->b]; \
+        const Value& Rv = regs[in->c]; \
+        if(!L.is_number() || !Rv.is_number() || (L.is_int() && Rv.is_int())){ in->op = Op::generic; --pc; VM_NEXT(); } \
+        double x = L.as_number(), y = Rv.as_number(); \
+        regs[in->a] = result; \
+        VM_NEXT(); \
+      }
+      VM_QUICK_INT(AddInt, Add, int_add(x, y))
+      VM_QUICK_NUM(AddNum, Add, Value::from_number(x + y))
+      VM_CASE(AddStr) {
+        const Value& L = regs[in->b];
+        const Value& Rv = regs[in->c];
+        if(!L.is_string() || !Rv.is_string()){ in->op = Op::Add; --pc; VM_NEXT(); }
+        regs[in->a] = Value::from_string(*std::get_if<std::string>(&L.v) + *std::get_if<std::string>(&Rv.v));
+        VM_NEXT();
+      }
+      VM_QUICK_INT(SubInt, Sub, int_sub(x, y))
+      VM_QUICK_NUM(SubNum, Sub, Value::from_number(x - y))
+      VM_QUICK_INT(MulInt, Mul, int_mul(x, y))
+      VM_QUICK_NUM(MulNum, Mul, Value::from_number(x * y))
+      VM_QUICK_INT(EqInt, Eq, Value::from_bool(x == y))
+      VM_QUICK_NUM(EqNum, Eq, Value::from_bool(num_cmp(x, y) == 0))
+      VM_QUICK_INT(NeqInt, Neq, Value::from_bool(x != y))
+      VM_QUICK_NUM(NeqNum, Neq, Value::from_bool(num_cmp(x, y) != 0))
+      VM_QUICK_INT(LtInt, Lt, Value::from_bool(x < y))
+      VM_QUICK_NUM(LtNum, Lt, Value::from_bool(x < y))
+      VM_QUICK_INT(LteInt, Lte, Value::from_bool(x <= y))
+      VM_QUICK_NUM(LteNum, Lte, Value::from_bool(num_cmp(x, y) <= 0))
+      VM_QUICK_INT(GtInt, Gt, Value::from_bool(x > y))
+      VM_QUICK_NUM(GtNum, Gt, Value::from_bool(x > y))
+      VM_QUICK_INT(GteInt, Gte, Value::from_bool(x >= y))
+      VM_QUICK_NUM(GteNum, Gte, Value::from_bool(num_cmp(x, y) >= 0))
+#undef VM_QUICK_INT
+#undef VM_QUICK_NUM
+      VM_CASE(Jmp) pc = static_cast<size_t>(in->a); VM_NEXT();
+      VM_CASE(JmpIfFalse) if(!truthy(regs[in->a])) pc = static_cast<size_t>(in->b); VM_NEXT();
+      VM_CASE(JmpIfTrue) if(truthy(regs[in->a])) pc = static_cast<size_t>(in->b); VM_NEXT();
+      VM_CASE(JmpIfNotNil) if(!regs[in->a].is_nil()) pc = static_cast<size_t>(in->b); VM_NEXT();
+      VM_CASE(Call) {
+        const CallSite& cs = ch.calls[in->b];
+        NativeArgs args(regs + in->c, static_cast<size_t>(cs.argc));
+        regs[in->a] = invoke(env, R, resolve_call(cs.cache, R, cs.name), cs.name, args, kNoNamedArgs, debug_mode);
+        VM_NEXT();
+      }
+      VM_CASE(CallStmt) {
+        const CallSite& cs = ch.calls[in->b];
+        NativeArgs args(regs + in->c, static_cast<size_t>(cs.argc));
+        (void)invoke(env, R, resolve_call(cs.cache, R, cs.name), cs.name, args, kNoNamedArgs, debug_mode);
+        VM_NEXT();
+      }
+      VM_CASE(CallInPlace) {
+        const CallSite& cs = ch.calls[in->b];
+        if(const NativeFn* f = inplace_native(R, cs.cache, cs.name, static_cast<size_t>(cs.argc))){
+          regs[in->c] = Value::nil(); // release the register's share of the target's storage
+          NativeArgs rest(regs + in->c + 1, static_cast<size_t>(cs.argc - 1));
+          f->inplace(env.lvalue(cs.target), rest);
+        } else {
+          NativeArgs args(regs + in->c, static_cast<size_t>(cs.argc));
+          Value result = invoke(env, R, cs.cache, cs.name, args, kNoNamedArgs, debug_mode);
+          if(cs.assign) env.set(cs.target, std::move(result));
+        }
+        VM_NEXT();
+      }
+      VM_CASE(Print) (void)call(R, "PRINT", {regs[in->a]}); VM_NEXT();
+      VM_CASE(PrintC) (void)call(R, "PRINTC", {regs[in->a]}); VM_NEXT();
+      VM_CASE(Index) regs[in->a] = index_value(regs[in->b], regs[in->c]); VM_NEXT();
+      VM_CASE(GetField) {
+        auto ma = static_cast<const MemberAccess*>(ch.exprs[in->c]);
+        if(const Packed* p = regs[in->b].packed()){
+          int i = ma->field.lookup(*p, ma->member);
+          if(i >= 0){ regs[in->a] = Value::from_number(p->f[i]); VM_NEXT(); }
+        }
+        regs[in->a] = member_value(R, ma, std::move(regs[in->b]), debug_mode);
+        VM_NEXT();
+      }
+      VM_CASE(SetIndex) {
+        Value* base = in->a >= 0 ? env.slot_ref(in->a) : nullptr;
+        if(!base){
+          Symbol key = in->a >= 0 ? ch.frame.syms[in->a] : ch.names[-1 - in->a];
+          if(env.is_const(key)) throw std::runtime_error("Indexed assignment to constant '" + symbol_name(key) + "'");
+          base = &env.lvalue(key);
+        }
+        store_index(*base, NativeArgs(regs + in->b, static_cast<size_t>(in->c)), std::move(regs[in->b + in->c]));
+        VM_NEXT();
+      }
+      VM_CASE(SetField) {
+        auto am = static_cast<const AssignMember*>(ch.stmts[in->c]);
+        Value* obj = &regs[in->b];
+        if(in->a != kNoStoreTarget){
+          obj = in->a >= 0 ? env.slot_ref(in->a) : nullptr;
+          if(!obj) obj = &env.lvalue(in->a >= 0 ? ch.frame.syms[in->a] : ch.names[-1 - in->a]);
+        }
+        assign_member(*obj, am, std::move(regs[in->b + 1]));
+        VM_NEXT();
+      }
+      VM_CASE(NewArray) {
+        Value::Array a(regs + in->b, regs + in->b + in->c);
+        regs[in->a] = Value::from_array(std::move(a));
+        VM_NEXT();
+      }
+      VM_CASE(ForPrep) {
+        // init/limit/step are converted once; limit and step stay in their
+        // registers. An integer init and step keep the counter an integer,
+        // and with a limit in range the loop's ForLoop becomes ForLoopInt.
+        const Value& init = regs[in->a];
+        double limit = regs[in->a + 1].as_number();
+        const Value& step_val = regs[in->a + 2];
+        double step = step_val.as_number();
+        bool ints = init.is_int() && step_val.is_int();
+        env.declare_slot(in->b);
+        env.set_slot(in->b, ints ? init : Value::from_number(init.as_number()));
+        if(ints && (regs[in->a + 1].is_int() || std::fabs(limit) < 9.2e18)){
+          // An integer counter passes a fractional limit where it passes the
+          // limit rounded toward the start.
+          if(!regs[in->a + 1].is_int())
+            regs[in->a + 1] = Value::from_int(static_cast<long long>(step >= 0 ? std::floor(limit) : std::ceil(limit)));
+          code[in->c - 1].op = Op::ForLoopInt;
+        } else {
+          regs[in->a + 1] = Value::from_number(limit);
+          if(!ints) regs[in->a + 2] = Value::from_number(step);
+          code[in->c - 1].op = Op::ForLoop;
+        }
+        double cur = env.get_slot(in->b).as_number();
+        if(!(step >= 0 ? (cur <= limit) : (cur >= limit))) pc = static_cast<size_t>(in->c);
+        VM_NEXT();
+      }
+      VM_CASE(ForLoop) {
+        double limit = regs[in->a + 1].as_number();
+        double step = regs[in->a + 2].as_number();
+        env.set_slot(in->b, for_step(env.get_slot(in->b), regs[in->a + 2]));
+        double cur = env.get_slot(in->b).as_number();
+        if(step >= 0 ? (cur <= limit) : (cur >= limit)) pc = static_cast<size_t>(in->c);
+        VM_NEXT();
+      }
+      VM_CASE(ForLoopInt) {
+        // Steps the counter in place in its frame slot. If the body changed
+        // its type (or made the slot need checked writes), or the step would
+        // overflow, the generic ForLoop takes over.
+        Value* v = env.slot_ref(in->b);
+        long long* cur = v ? std::get_if<long long>(&v->v) : nullptr;
+        const long long* limit = std::get_if<long long>(&regs[in->a + 1].v);
+        const long long* step = std::get_if<long long>(&regs[in->a + 2].v);
+        if(!cur || !limit || !step || (*step >= 0 ? *cur > LLONG_MAX - *step : *cur < LLONG_MIN - *step)){
+          in->op = Op::ForLoop;
+          --pc;
+          VM_NEXT();
+        }
+        *cur += *step;
+        if(*step >= 0 ? (*cur <= *limit) : (*cur >= *limit)) pc = static_cast<size_t>(in->c);
+        VM_NEXT();
+      }
+      VM_CASE(ForEachNext) {
+        // Like the tree-walker, iterates over the collection as it was when
+        // the loop started; a map yields {key, value} pairs.
+        const Value& coll = regs[in->a];
+        const long long* pos = std::get_if<long long>(&regs[in->a + 1].v);
+        size_t i = pos ? static_cast<size_t>(*pos) : SIZE_MAX; // not set when a GOTO entered the body
+        Value item;
+        if(coll.is_array() && i < coll.as_array().size()){
+          item = coll.as_array()[i];
+        } else if(coll.is_map() && i < coll.as_map().size()){
+          const auto& [key, value] = *(coll.as_map().begin() + static_cast<std::ptrdiff_t>(i));
+          Value::Map pair;
+          pair["key"] = Value::from_string(key);
+          pair["value"] = value;
+          item = Value::from_map(std::move(pair));
+        } else {
+          pc = static_cast<size_t>(in->c);
+          VM_NEXT();
+        }
+        regs[in->a + 1] = Value::from_int(static_cast<long long>(i + 1));
+        if(in->b >= 0) env.set_slot(in->b, std::move(item));
+        else env.set(ch.names[-1 - in->b], std::move(item));
+        VM_NEXT();
+      }
+      VM_CASE(Eval) regs[in->a] = eval(env, R, ch.exprs[in->b], debug_mode); VM_NEXT();
+      VM_CASE(Exec) {
+        Flow f = exec(env, R, ch.stmts[in->a], debug_mode);
+        if(f != Flow::Normal){
+          int to = route_flow(ch, pc - 1, f);
+          if(to < 0) return f;
+          pc = static_cast<size_t>(to);
+        }
+        VM_NEXT();
+      }
+      VM_CASE(Signal) {
+        switch(static_cast<SignalKind>(in->a)){
+          case SignalKind::Break: return Flow::Break;
+          case SignalKind::Continue: return Flow::Continue;
+          case SignalKind::Exit: g_exit_target = symbol_name(ch.names[in->b]); return Flow::Exit;
+        }
+        VM_NEXT();
+      }
+      VM_CASE(Gosub) gosub_stack.push_back(pc); pc = static_cast<size_t>(in->a); VM_NEXT();
+      VM_CASE(GosubReturn) {
+        if(!gosub_stack.empty()){
+          pc = gosub_stack.back();
+          gosub_stack.pop_back();
+        }
+        VM_NEXT();
+      }
+      VM_CASE(Yield) {
+        Value v = in->a >= 0 ? std::move(regs[in->a]) : Value::nil();
+        if(!st.resumable){
+          if(g_coroutine) throw std::runtime_error("YIELD must be in the coroutine's own SUB/FUNCTION body");
+          VM_NEXT(); // outside coroutines YIELD does nothing
+        }
+        g_yield_value = std::move(v);
+        st.pc = pc;
+        return Flow::Yield;
+      }
+      VM_CASE(Await) {
+        if(!st.resumable){
+          await_blocking(regs[in->a]);
+          VM_NEXT();
+        }
+        if(!begin_await(*g_coroutine, regs[in->a])) VM_NEXT(); // already complete
+        g_yield_value = Value::nil();
+        st.pc = pc;
+        return Flow::Yield;
+      }
+      VM_CASE(Ret) g_return_value = std::move(regs[in->a]); return Flow::Return;
+      VM_CASE(RetNil) g_return_value = Value::nil(); return Flow::Return;
+      VM_CASE(Halt) return Flow::Normal;
+      VM_CASE(Fail) throw std::runtime_error(ch.consts[in->a].as_string());
+      VM_CASE(Nop) VM_NEXT();
+      VM_END()
+    } catch(const FlowEscape& fe){
+      // Raised by a SUB/FUNCTION called from this chunk
+      int to = route_flow(ch, pc - 1, fe.flow);
+      if(to < 0) return fe.flow;
+      pc = static_cast<size_t>(to);
+    } catch(const LabelJump& j){
+      // A GOTO/GOSUB run by the tree-walker inside a block without a native
+      // lowering (USING ...) leaves the block for a label of this chunk; a
+      // GOSUB returns to the statement after the block.
+      auto gs = dynamic_cast<const Gosub*>(j.stmt);
+      auto it = ch.labels.find(Env::normalize(gs ? gs->label : static_cast<const Goto*>(j.stmt)->label));
+      if(it == ch.labels.end()) unsupported_jump(j);
+      if(gs) gosub_stack.push_back(pc);
+      pc = static_cast<size_t>(it->second);
+    }
+  }
+#undef VM_CASE
+#undef VM_NEXT
+#undef VM_BEGIN
+#undef VM_END
+#undef VM_PROFILE
+#if defined(__GNUC__) || defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+}
+
+static Flow run_chunk(Env& env, FunctionRegistry& R, const Chunk& ch, ChunkState& st, bool debug_mode){
+  if(g_profiling) [[unlikely]] return run_chunk_loop<true>(env, R, ch, st, debug_mode);
+  return run_chunk_loop<false>(env, R, ch, st, debug_mode);
+}
+
+// Script calls recurse on the native stack. interpret() sets the lowest
+// address a call may start at, leaving room for the natives and nested
+// expressions below it, so runaway recursion is a runtime error rather than
+// a crash. 0 when the stack size is unknown or unlimited.
+static uintptr_t g_stack_floor = 0;
+
+static void set_stack_floor(){
+  constexpr uintptr_t kReserve = 256 * 1024;
+  char here;
+  g_stack_floor = 0;
+#ifdef _WIN32
+  MEMORY_BASIC_INFORMATION mbi{};
+  if(VirtualQuery(&here, &mbi, sizeof mbi) == 0) return;
+  g_stack_floor = reinterpret_cast<uintptr_t>(mbi.AllocationBase) + kReserve;
+#else
+  rlimit rl{};
+  if(getrlimit(RLIMIT_STACK, &rl) != 0 || rl.rlim_cur == RLIM_INFINITY || rl.rlim_cur <= 2 * kReserve) return;
+  g_stack_floor = reinterpret_cast<uintptr_t>(&here) - static_cast<uintptr_t>(rl.rlim_cur) + kReserve;
+#endif
+}
+
+static void check_stack(std::string_view name){
+  char probe;
+  if(reinterpret_cast<uintptr_t>(&probe) < g_stack_floor) [[unlikely]] {
+    throw std::runtime_error("Stack overflow: calls nested too deeply in " + std::string(name));
+  }
+}
+
+// Record the label statement at `index` of `scope`.
+static void add_label(JumpScope& scope, const Label* lbl, size_t index){
+  if(!scope.labels.emplace(Env::up(lbl->name), index).second){
+    throw std::runtime_error("Duplicate label: " + lbl->name);
   }
 }
 
-static void call_sub(Env& caller, FunctionRegistry& R, const std::string& name, const std::vector<Value>& args, bool debug_mode){
-  auto it = g_subs.find(Env::up(name));
-  if(it==g_subs.end()) return;
-  const SubDecl* sd = it->second;
-  Env local; local.parent = &caller; local.strict = caller.strict;
+// Labels of the SUB/FUNCTION bodies the tree-walker has run, by body
+static std::unordered_map<const void*, JumpScope> g_body_scopes;
+
+static const JumpScope& body_scope(const std::vector<std::unique_ptr<Stmt>>& body){
+  auto it = g_body_scopes.find(&body);
+  if(it != g_body_scopes.end()) return it->second;
+  JumpScope scope;
+  scope.body = &body;
+  for(size_t i = 0; i < body.size(); ++i){
+    if(auto lbl = dynamic_cast<const Label*>(body[i].get())) add_label(scope, lbl, i);
+  }
+  return g_body_scopes.emplace(&body, std::move(scope)).first->second;
+}
+
+// Run the statements of `scope` from index `pc`, following its GOTOs, until
+// one ends with a flow other than Normal or the last one is done.
+static Flow run_scope(Env& env, FunctionRegistry& R, const JumpScope& scope, size_t pc, bool debug_mode){
+  const auto& body = *scope.body;
+  while(pc < body.size()){
+    Flow f;
+    try{
+      f = exec(env, R, body[pc].get(), debug_mode);
+    } catch(const LabelJump& j){
+      pc = scope.target_of(j.stmt);  // a GOTO, from however deep in blocks
+      continue;
+    }
+    if(f != Flow::Normal) return f;
+    pc++;
+  }
+  return Flow::Normal;
+}
+
+// GOSUB in the tree-walker: runs the subroutine at its label up to its
+// RETURN, then carries on after the GOSUB, however deep in blocks that is.
+// A subroutine that runs off the end of its body ends the body.
+static Flow exec_gosub(Env& env, FunctionRegistry& R, const Gosub* gs, bool debug_mode){
+  check_stack(gs->label);
+  Flow f = run_scope(env, R, *g_jump_scope, g_jump_scope->target_of(gs), debug_mode);
+  if(f == Flow::Return) return Flow::Normal;
+  if(f == Flow::Normal){
+    g_return_value = Value::nil();
+    return Flow::Return;
+  }
+  return f;
+}
+
+// Tree-walker SUB/FUNCTION body; its jumps reach its own labels.
+static Flow exec_body(Env& env, FunctionRegistry& R, const std::vector<std::unique_ptr<Stmt>>& body, bool debug_mode){
+  const JumpScope& scope = body_scope(body);
+  ScopedJumps jumps(&scope);
+  return run_scope(env, R, scope, 0, debug_mode);
+}
+
+NOINLINE static void run_sub(Env& caller, FunctionRegistry& R, const SubDecl* sd, NativeArgs args, bool debug_mode){
+  check_stack(sd->name);
+  ProfileScope profile(sd->name);
+  Env local(&caller);
+  const Chunk* ch = g_bytecode_enabled ? &sub_chunk(sd) : nullptr;
+  if(ch) local.bind_call_layout(ch->frame);
   // Bind parameters
   size_t n = std::min(sd->params.size(), args.size());
   for(size_t i=0;i<n;++i){
-    local.declare(sd->params[i]);
-    local.set(sd->params[i], args[i]);
+    bind_param(local, ch, i, sd->params[i], args[i]);
   }
-  try{
-    for(auto& s : sd->body) {
-      exec(local, R, s.get(), debug_mode);
+  Flow f = ch ? run_chunk(local, R, *ch, debug_mode) : exec_body(local, R, sd->body, debug_mode);
+  finish_call(f, "sub");
+}
+
+// Debug-mode warning for a FUNCTION whose result does not have its declared type
+NOINLINE static void check_return_type(const FunctionDecl* fd, const Value& returnValue){
+  // Basic type checking - could be enhanced
+  std::string expectedType = Env::up(fd->returnType);
+  std::string actualType;
+  if(returnValue.is_string()) actualType = "STRING";
+  else if(returnValue.is_array()) actualType = "ARRAY";
+  else if(returnValue.is_map()) actualType = "MAP";
+  else if(returnValue.is_nil()) actualType = "NIL";
+  else {
+    try {
+      (void)returnValue.as_int();
+      actualType = "INTEGER";
+    } catch(...) {
+      try {
+        (void)returnValue.as_number();
+        actualType = "NUMBER";
+      } catch(...) {
+        try {
+          (void)returnValue.as_bool();
+          actualType = "BOOLEAN";
+        } catch(...) {
+          actualType = "UNKNOWN";
+        }
+      }
     }
-  } catch(const ReturnSignal&){ /* swallow - RETURN from sub */ }
-  catch(const ExitSignal& es) {
-    if(es.target == "sub") return; // Exit the sub
-    throw; // Re-throw if not for SUB
+  }
+  // Type checking is lenient for now - could be made strict
+  if(expectedType != actualType && expectedType != "NIL" && actualType != "NIL"){
+    std::cerr << "Warning: Return type mismatch in " << fd->name << ": expected " 
+              << expectedType << ", got " << actualType << std::endl;
   }
 }
 
-static Value call_func(Env& caller, FunctionRegistry& R, const std::string& name, 
-                       const std::vector<Value>& args, 
-                       const std::map<std::string, Value>& namedArgs,
-                       bool debug_mode){
-  auto it = g_funcs.find(Env::up(name));
-  if(it==g_funcs.end()) return Value::nil();
-  const FunctionDecl* fd = it->second;
-  Env local; local.parent = &caller; local.strict = caller.strict;
-  
+// Parameters of a FUNCTION call with named arguments or omitted ones.
+// Defaults are evaluated in the callee's frame before any parameter is bound.
+NOINLINE static void bind_func_params(Env& local, FunctionRegistry& R, const Chunk* ch, const FunctionDecl* fd,
+                                      NativeArgs args, const std::map<std::string, Value>& namedArgs, bool debug_mode){
   // Build parameter map from positional and named arguments
   std::map<std::string, Value> paramValues;
-  
+
   // First, process positional arguments
   size_t positionalCount = std::min(fd->params.size(), args.size());
   for(size_t i=0; i<positionalCount; ++i){
     paramValues[Env::up(fd->params[i].name)] = args[i];
   }
-  
+
   // Then, process named arguments (override positional)
   for(const auto& [name, value] : namedArgs){
     paramValues[name] = value;
   }
-  
+
   // Finally, fill in defaults for missing parameters
   for(size_t i=0; i<fd->params.size(); ++i){
     std::string paramName = Env::up(fd->params[i].name);
@@ -1898,85 +2894,411 @@ static Value call_func(Env& caller, FunctionRegistry& R, const std::string& name
       }
     }
   }
-  
+
   // Set all parameters in local environment
   for(size_t i=0; i<fd->params.size(); ++i){
     std::string paramName = Env::up(fd->params[i].name);
-    local.declare(fd->params[i].name);
-    local.set(fd->params[i].name, paramValues[paramName]);
+    bind_param(local, ch, i, fd->params[i].name, paramValues[paramName]);
+  }
+}
+
+static Value run_func(Env& caller, FunctionRegistry& R, const FunctionDecl* fd,
+                      NativeArgs args,
+                      const std::map<std::string, Value>& namedArgs,
+                      bool debug_mode){
+  check_stack(fd->name);
+  ProfileScope profile(fd->name);
+  Env local(&caller);
+  const Chunk* ch = g_bytecode_enabled ? &func_chunk(fd) : nullptr;
+  if(ch) local.bind_call_layout(ch->frame);
+  
+  if(namedArgs.empty() && args.size() >= fd->params.size()){
+    // Every parameter has its positional argument
+    for(size_t i=0; i<fd->params.size(); ++i) bind_param(local, ch, i, fd->params[i].name, args[i]);
+  } else {
+    bind_func_params(local, R, ch, fd, args, namedArgs, debug_mode);
   }
   
   // Execute function body
   Value returnValue = Value::nil();
+  Flow f = ch ? run_chunk(local, R, *ch, debug_mode) : exec_body(local, R, fd->body, debug_mode);
+  if(f == Flow::Return) returnValue = std::move(g_return_value);
+  else if(f == Flow::Exit && g_exit_target == "function") return Value::nil(); // Exit the function
+  else finish_call(f, "function");
+  if(debug_mode && fd->hasReturnType && !fd->returnType.empty()) check_return_type(fd, returnValue);
+  return returnValue;
+}
+
+// A flow that reaches the top level: RETURN ends the program, anything else
+// had no enclosing loop or block to leave.
+static void check_top_level_flow(Flow f){
+  switch(f){
+    case Flow::Normal:
+    case Flow::Return:
+    case Flow::Yield: return;
+    case Flow::Break: throw std::runtime_error("BREAK outside of a loop");
+    case Flow::Continue: throw std::runtime_error("CONTINUE outside of a loop");
+    case Flow::Exit: {
+      std::string target = g_exit_target;
+      for(auto& c : target) c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+      throw std::runtime_error("EXIT " + target + " outside of a matching block");
+    }
+  }
+}
+
+// The program's top level as the tree-walker runs it: statements classified
+// and GOTO/GOSUB labels resolved to statement indices once, at load.
+struct TopLevel : JumpScope {
+  static constexpr size_t kUnresolved = static_cast<size_t>(-1);
+  struct Entry {
+    enum class Kind : uint8_t { Exec, Skip, Goto, Gosub, Return, End };
+    Kind kind{Kind::Exec};
+    size_t target{kUnresolved};  // GOTO/GOSUB destination
+  };
+  std::vector<Entry> stmts;
+};
+
+static TopLevel plan_top_level(const Program& prog){
+  using Kind = TopLevel::Entry::Kind;
+  TopLevel top;
+  top.body = &prog.stmts;
+  top.stmts.resize(prog.stmts.size());
+  for(size_t i = 0; i < prog.stmts.size(); ++i){
+    const Stmt* s = prog.stmts[i].get();
+    Kind& kind = top.stmts[i].kind;
+    if(auto lbl = dynamic_cast<const Label*>(s)){
+      add_label(top, lbl, i);
+      kind = Kind::Skip;
+    } else if(dynamic_cast<const SubDecl*>(s) || dynamic_cast<const FunctionDecl*>(s)){
+      kind = Kind::Skip;
+    } else if(dynamic_cast<const Goto*>(s)){
+      kind = Kind::Goto;
+    } else if(dynamic_cast<const Gosub*>(s)){
+      kind = Kind::Gosub;
+    } else if(dynamic_cast<const Return*>(s)){
+      kind = Kind::Return;
+    } else if(dynamic_cast<const End*>(s)){
+      kind = Kind::End;
+    }
+  }
+  for(size_t i = 0; i < prog.stmts.size(); ++i){
+    auto& e = top.stmts[i];
+    if(e.kind != Kind::Goto && e.kind != Kind::Gosub) continue;
+    auto it = top.labels.find(Env::up(TopLevel::jump_label(prog.stmts[i].get())));
+    if(it != top.labels.end()) e.target = it->second;
+  }
+  return top;
+}
+
+// ===== Coroutines =====
+
+// Id of a coroutine handle, or 0 when `v` is not one.
+static long long coroutine_id(const Value& v){
+  if(!v.is_map()) return 0;
+  const auto& m = v.as_map();
+  auto type = m.find("_type");
+  auto id = m.find("_id");
+  if(type == m.end() || !type->second.is_string() || type->second.as_string() != "coroutine") return 0;
+  if(id == m.end() || !id->second.is_int()) return 0;
+  return id->second.as_int();
+}
+
+// Starts waiting on `awaitable`; false when it is already complete. Futures
+// and coroutines are awaited until they finish, a number for that many
+// seconds (zero or less: until the next resume); other values do not wait.
+static bool begin_await(Coroutine& co, const Value& awaitable){
+  co.future.reset();
+  co.awaited = 0;
+  co.timed = false;
+  if(auto f = find_future(awaitable)){
+    if(f->done.load(std::memory_order_acquire)) return false;
+    co.future = std::move(f);
+  } else if(long long id = coroutine_id(awaitable)){
+    if(id == co.id) throw std::runtime_error("AWAIT: a coroutine cannot await itself");
+    if(g_coroutines.find(id) == g_coroutines.end()) return false;
+    co.awaited = id;
+  } else if(awaitable.is_number()){
+    co.timed = true;
+    co.wake = std::chrono::steady_clock::now() +
+              std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                  std::chrono::duration<double>(std::max(0.0, awaitable.as_number())));
+  } else {
+    return false;
+  }
+  co.status = Coroutine::Status::Waiting;
+  return true;
+}
+
+static bool await_ready(const Coroutine& co){
+  if(co.future) return co.future->done.load(std::memory_order_acquire);
+  if(co.awaited) return g_coroutines.find(co.awaited) == g_coroutines.end();
+  if(co.timed) return std::chrono::steady_clock::now() >= co.wake;
+  return true;
+}
+
+// Runs the coroutine until it suspends or finishes; see coroutine_resume().
+static Value resume(Coroutine& co){
+  if(co.status == Coroutine::Status::Running){
+    throw std::runtime_error("Coroutine " + co.name + " is already running");
+  }
+  if(co.status == Coroutine::Status::Waiting){
+    if(!await_ready(co)) return Value::nil();
+    co.future.reset();
+    co.awaited = 0;
+    co.timed = false;
+  }
+  Coroutine* outer = g_coroutine;
+  g_coroutine = &co;
+  co.status = Coroutine::Status::Running;
+  ProfileScope profile(co.name);
+  ScopedJumps jumps(nullptr);  // the body is a chunk; its VM resolves its jumps
+  Flow f;
   try{
-    for(auto& s : fd->body) exec(local, R, s.get(), debug_mode);
-  } catch(const ReturnSignal& rs){ 
-    returnValue = rs.v;
-  } catch(const ExitSignal& es) {
-    if(es.target == "function") return Value::nil(); // Exit the function
-    throw; // Re-throw if not for FUNCTION
-  }
-  // Check return type if specified
-  if(fd->hasReturnType && !fd->returnType.empty()){
-    // Basic type checking - could be enhanced
-    std::string expectedType = Env::up(fd->returnType);
-    std::string actualType;
-    if(returnValue.is_string()) actualType = "STRING";
-    else if(returnValue.is_array()) actualType = "ARRAY";
-    else if(returnValue.is_map()) actualType = "MAP";
-    else if(returnValue.is_nil()) actualType = "NIL";
-    else {
-      try {
-        (void)returnValue.as_int();
-        actualType = "INTEGER";
-      } catch(...) {
-        try {
-          (void)returnValue.as_number();
-          actualType = "NUMBER";
-        } catch(...) {
-          try {
-            (void)returnValue.as_bool();
-            actualType = "BOOLEAN";
-          } catch(...) {
-            actualType = "UNKNOWN";
-          }
-        }
+    f = run_chunk(*co.env, *g_registry, *co.chunk, co.state, g_debug_mode);
+  } catch(...){
+    g_coroutine = outer;
+    co.status = Coroutine::Status::Done;
+    throw;
+  }
+  g_coroutine = outer;
+  if(f == Flow::Yield){
+    if(co.status == Coroutine::Status::Running) co.status = Coroutine::Status::Suspended;
+    return std::move(g_yield_value);
+  }
+  co.status = Coroutine::Status::Done;
+  if(f == Flow::Return) return std::move(g_return_value);
+  if(f == Flow::Exit && (g_exit_target == "sub" || g_exit_target == "function")) return Value::nil();
+  check_top_level_flow(f);
+  return Value::nil();
+}
+
+// Resumes coroutine `id` and drops it once it is done.
+static Value resume_id(long long id){
+  auto it = g_coroutines.find(id);
+  if(it == g_coroutines.end()) return Value::nil();
+  Coroutine& co = *it->second;
+  try{
+    Value v = resume(co);
+    if(co.status == Coroutine::Status::Done) g_coroutines.erase(id);
+    return v;
+  } catch(...){
+    g_coroutines.erase(id);
+    throw;
+  }
+}
+
+static void await_blocking(const Value& awaitable){
+  if(auto f = find_future(awaitable)){
+    while(!f->done.load(std::memory_order_acquire)) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  } else if(long long id = coroutine_id(awaitable)){
+    // Drive the coroutine to completion, sleeping while its own AWAIT is pending
+    for(auto it = g_coroutines.find(id); it != g_coroutines.end(); it = g_coroutines.find(id)){
+      if(it->second->status == Coroutine::Status::Waiting && !await_ready(*it->second)){
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        continue;
       }
+      (void)resume_id(id);
     }
-    // Type checking is lenient for now - could be made strict
-    if(debug_mode && expectedType != actualType && expectedType != "NIL" && actualType != "NIL"){
-      std::cerr << "Warning: Return type mismatch in " << name << ": expected " 
-                << expectedType << ", got " << actualType << std::endl;
-    }
+  } else if(awaitable.is_number() && awaitable.as_number() > 0){
+    std::this_thread::sleep_for(std::chrono::duration<double>(awaitable.as_number()));
   }
-  return returnValue;
+}
+
+// ===== Function values =====
+
+// A LAMBDA closure. Variables visible where it was created, below the
+// globals, are captured by value; globals are read live. Each call runs the
+// body in a fresh frame over the captured one, so assignments in the body
+// stay local to that call, as in a FUNCTION.
+struct Closure : Callable {
+  const LambdaExpr* lambda{nullptr};
+  std::unique_ptr<Env> captured;  // null for a closure made at the top level
+  uint64_t run{0};                // the lambda's AST belongs to this run
+
+  Value call(NativeArgs args) const override {
+    if(run != g_run || !g_global_env) throw std::runtime_error("LAMBDA called outside the program that created it");
+    FunctionRegistry& R = *g_registry;
+    check_stack("LAMBDA");
+    ProfileScope profile("lambda");
+    Env local(captured ? captured.get() : g_global_env);
+    const Chunk* ch = g_bytecode_enabled ? &lambda_chunk(lambda) : nullptr;
+    if(ch) local.bind_call_layout(ch->frame);
+    for(size_t i = 0; i < lambda->params.size(); ++i){
+      const FunctionParam& param = lambda->params[i];
+      Value v = i < args.size() ? args[i]
+              : param.hasDefault ? eval(local, R, param.defaultValue.get(), g_debug_mode)
+              : Value::nil();
+      bind_param(local, ch, i, param.name, std::move(v));
+    }
+    Flow f = ch ? run_chunk(local, R, *ch, g_debug_mode) : exec_body(local, R, lambda->body, g_debug_mode);
+    if(f == Flow::Return) return std::move(g_return_value);
+    finish_call(f, "function");
+    return Value::nil();
+  }
+};
+
+// A SUB, FUNCTION or native passed to a native by name. The call site cache
+// keeps the resolved target, so calls skip the name lookups.
+struct NamedFunction : Callable {
+  std::string name;
+  mutable CallCache target;
+
+  Value call(NativeArgs args) const override {
+    if(!g_global_env) throw std::runtime_error(name + " called outside a running program");
+    FunctionRegistry& R = *g_registry;
+    return invoke(*g_global_env, R, resolve_call(target, R, name), name, args, kNoNamedArgs, g_debug_mode);
+  }
+};
+
+static Value make_closure(const Env& env, const LambdaExpr* lambda){
+  auto fn = std::make_shared<Closure>();
+  fn->lambda = lambda;
+  fn->run = g_run;
+  if(env.parent){
+    // Inner frames shadow outer ones, as they do for lookups
+    fn->captured = std::make_unique<Env>(env.root());
+    for(const Env* e = &env; e->parent; e = e->parent){
+      e->for_each_here([&](const std::string& name, const Value& v){
+        Symbol key = intern(name);
+        if(!fn->captured->find_here(key)) fn->captured->store_here(key, v);
+      });
+    }
+  }
+  return Value::from_callable(std::move(fn));
 }
 
 } // namespace
 
+std::shared_ptr<const Callable> bas::to_callable(const Value& fn){
+  if(fn.is_callable()) return fn.as_callable();
+  if(!fn.is_string() || !g_registry) return nullptr;
+  auto named = std::make_shared<NamedFunction>();
+  named->name = fn.as_string();
+  const CallCache& t = resolve_call(named->target, *g_registry, named->name);
+  if(!t.sub && !t.func && !t.native) return nullptr;
+  return named;
+}
+
+Value bas::coroutine_create(const std::string& name, NativeArgs args, bool scheduled){
+  if(!g_global_env) throw std::runtime_error("Coroutines need a running program");
+  auto co = std::make_unique<Coroutine>();
+  co->name = Env::up(name);
+  co->env = std::make_unique<Env>(g_global_env);
+  Env& local = *co->env;
+  if(auto it = g_subs.find(co->name); it != g_subs.end()){
+    const SubDecl* sd = it->second;
+    co->chunk = &sub_chunk(sd);
+    local.bind_layout(co->chunk->frame);
+    size_t n = std::min(sd->params.size(), args.size());
+    for(size_t i = 0; i < n; ++i) bind_param(local, co->chunk, i, sd->params[i], args[i]);
+  } else if(auto itf = g_funcs.find(co->name); itf != g_funcs.end()){
+    const FunctionDecl* fd = itf->second;
+    co->chunk = &func_chunk(fd);
+    local.bind_layout(co->chunk->frame);
+    for(size_t i = 0; i < fd->params.size(); ++i){
+      const auto& param = fd->params[i];
+      Value v = i < args.size() ? args[i]
+              : param.hasDefault ? eval(local, *g_registry, param.defaultValue.get(), g_debug_mode)
+              : Value::nil();
+      bind_param(local, co->chunk, i, param.name, std::move(v));
+    }
+  } else {
+    throw std::runtime_error("Coroutine: unknown SUB or FUNCTION " + name);
+  }
+  co->state.regs = co->state.reg_store.own(static_cast<size_t>(co->chunk->num_regs));
+  co->state.resumable = true;
+  co->id = g_next_coroutine_id++;
+
+  Value::Map handle;
+  handle["_type"] = Value::from_string("coroutine");
+  handle["_id"] = Value::from_int(co->id);
+  handle["name"] = Value::from_string(co->name);
+  if(scheduled) g_scheduled.push_back(co->id);
+  g_coroutines.emplace(co->id, std::move(co));
+  return Value::from_map(std::move(handle));
+}
+
+Value bas::coroutine_resume(const Value& handle){
+  long long id = coroutine_id(handle);
+  if(!id) throw std::runtime_error("COROUTINE_RESUME: expected a coroutine");
+  return resume_id(id);
+}
+
+std::string bas::coroutine_status(const Value& handle){
+  auto it = g_coroutines.find(coroutine_id(handle));
+  if(it == g_coroutines.end()) return "done";
+  switch(it->second->status){
+    case Coroutine::Status::Suspended: return "suspended";
+    case Coroutine::Status::Waiting: return "waiting";
+    case Coroutine::Status::Running: return "running";
+    case Coroutine::Status::Done: break;
+  }
+  return "done";
+}
+
+void bas::coroutine_cancel(const Value& handle){
+  auto it = g_coroutines.find(coroutine_id(handle));
+  if(it == g_coroutines.end()) return;
+  if(it->second->status == Coroutine::Status::Running){
+    throw std::runtime_error("Coroutine " + it->second->name + " cannot cancel itself while running");
+  }
+  g_coroutines.erase(it);
+}
+
+size_t bas::coroutine_update(){
+  // Coroutines spawned during this pass first run on the next one
+  const size_t n = g_scheduled.size();
+  size_t kept = 0;
+  for(size_t i = 0; i < n; ++i){
+    long long id = g_scheduled[i];
+    auto it = g_coroutines.find(id);
+    if(it == g_coroutines.end()) continue;
+    const Coroutine& co = *it->second;
+    bool ready = co.status == Coroutine::Status::Suspended ||
+                 (co.status == Coroutine::Status::Waiting && await_ready(co));
+    if(ready) (void)resume_id(id);
+    if(g_coroutines.count(id)) g_scheduled[kept++] = id;
+  }
+  g_scheduled.erase(g_scheduled.begin() + static_cast<std::ptrdiff_t>(kept),
+                    g_scheduled.begin() + static_cast<std::ptrdiff_t>(n));
+  return g_scheduled.size();
+}
+
 void bas::set_namespace_registry(NamespaceRegistry* registry) {
   g_namespace_registry = registry;
 }
 
+void bas::set_bytecode_enabled(bool enabled) {
+  g_bytecode_enabled = enabled;
+}
+
 int bas::interpret(const Program& prog, FunctionRegistry& R, bool debug_mode){
   try{
+    set_stack_floor();
+    ProfileScope profile("<main>");
     Env env;
     g_subs.clear();
     g_funcs.clear();
-    g_labels.clear();
-    g_gosub_stack.clear();
+    g_chunks.clear();
+    g_body_scopes.clear();
+    ++g_run;
+    // Coroutine frames chain to `env`; drop them before it goes away
+    struct CoroutineScope {
+      CoroutineScope(Env& global, FunctionRegistry& R, bool debug){
+        g_global_env = &global;
+        g_registry = &R;
+        g_debug_mode = debug;
+      }
+      ~CoroutineScope(){
+        g_coroutines.clear();
+        g_scheduled.clear();
+        g_coroutine = nullptr;
+        g_global_env = nullptr;
+      }
+    } coroutine_scope(env, R, debug_mode);
     
-    // First pass: collect labels and function/sub declarations
-    for(size_t i = 0; i < prog.stmts.size(); ++i){
-      auto& s = prog.stmts[i];
-      if(auto lbl = dynamic_cast<Label*>(s.get())){
-        std::string labelKey = Env::up(lbl->name);
-        if(g_labels.find(labelKey) != g_labels.end()){
-          throw std::runtime_error("Duplicate label: " + lbl->name);
-        }
-        g_labels[labelKey] = i;
-        continue;
-      }
+    // First pass: collect function/sub declarations
+    for(const auto& s : prog.stmts){
       if(auto sd = dynamic_cast<SubDecl*>(s.get())){
         g_subs[Env::up(sd->name)] = sd;
         continue;
@@ -1986,64 +3308,70 @@ int bas::interpret(const Program& prog, FunctionRegistry& R, bool debug_mode){
       }
     }
     
-    // Second pass: execute statements with GOTO/GOSUB support
+    if(g_bytecode_enabled){
+      BytecodeCompiler compiler;
+      auto main_chunk = compiler.compile_program(prog);
+      env.bind_layout(main_chunk->frame);
+      check_top_level_flow(run_chunk(env, R, *main_chunk, debug_mode));
+      return 0;
+    }
+    
+    // Tree-walker: classify the top-level statements and resolve GOTO/GOSUB
+    // labels to statement indices once, before running
+    using Kind = TopLevel::Entry::Kind;
+    const TopLevel top = plan_top_level(prog);
+    ScopedJumps jumps(&top);
+    std::vector<size_t> gosub_stack;
     size_t pc = 0; // Program counter
-    while(pc < prog.stmts.size()){
-      auto& s = prog.stmts[pc];
-      
-      // Skip labels, subs, and functions during execution
-      if(dynamic_cast<Label*>(s.get()) || 
-         dynamic_cast<SubDecl*>(s.get()) || 
-         dynamic_cast<FunctionDecl*>(s.get())){
-        pc++;
-        continue;
+    while(pc < top.stmts.size()){
+      const auto& t = top.stmts[pc];
+      switch(t.kind){
+        case Kind::Skip:
+          pc++;
+          continue;
+        case Kind::Gosub:
+          gosub_stack.push_back(pc + 1); // Push return address
+          [[fallthrough]];
+        case Kind::Goto:
+          if(t.target == TopLevel::kUnresolved){
+            throw std::runtime_error("Label not found: " + TopLevel::jump_label(prog.stmts[pc].get()));
+          }
+          pc = t.target;
+          continue;
+        case Kind::Return:
+          // RETURN from GOSUB; outside one a top-level RETURN ends the program
+          if(!gosub_stack.empty()){
+            pc = gosub_stack.back();
+            gosub_stack.pop_back();
+            continue;
+          }
+          if(auto ret = static_cast<const Return*>(prog.stmts[pc].get()); ret->value){
+            (void)eval(env, R, ret->value.get(), debug_mode);
+          }
+          return 0;
+        case Kind::End:
+          return 0; // Terminate program
+        case Kind::Exec:
+          break;
       }
       
-      // Handle GOTO
-      if(auto gt = dynamic_cast<Goto*>(s.get())){
-        std::string labelKey = Env::up(gt->label);
-        auto it = g_labels.find(labelKey);
-        if(it == g_labels.end()){
-          throw std::runtime_error("Label not found: " + gt->label);
-        }
-        pc = it->second;
+      Flow f;
+      try{
+        f = exec(env, R, prog.stmts[pc].get(), debug_mode);
+      } catch(const LabelJump& j){
+        // A GOTO leaves the enclosing blocks; a GOSUB in them ran in place
+        pc = top.target_of(j.stmt);
         continue;
       }
-      
-      // Handle GOSUB
-      if(auto gs = dynamic_cast<Gosub*>(s.get())){
-        g_gosub_stack.push_back(pc + 1); // Push return address
-        std::string labelKey = Env::up(gs->label);
-        auto it = g_labels.find(labelKey);
-        if(it == g_labels.end()){
-          throw std::runtime_error("Label not found: " + gs->label);
-        }
-        pc = it->second;
+      if(f == Flow::Return && !gosub_stack.empty()){
+        // RETURN from a GOSUB inside a block
+        pc = gosub_stack.back();
+        gosub_stack.pop_back();
         continue;
       }
-      
-      // Handle RETURN (from GOSUB)
-      if(auto ret = dynamic_cast<Return*>(s.get())){
-        if(!g_gosub_stack.empty()){
-          pc = g_gosub_stack.back();
-          g_gosub_stack.pop_back();
-          continue;
-        }
-        // If not in GOSUB context, treat as normal RETURN (for functions/subs)
-        throw ReturnSignal{ret->value ? eval(env, R, ret->value.get(), debug_mode) : Value::nil()};
-      }
-      
-      // Handle END
-      if(dynamic_cast<End*>(s.get())){
-        return 0; // Terminate program
-      }
-      
-      // Execute normal statement
-      try {
-        exec(env, R, s.get(), debug_mode);
-      } catch(const ReturnSignal& rs){
-        // RETURN from function/sub - handled by call_func/call_sub
-        throw;
+      if(f != Flow::Normal){
+        check_top_level_flow(f);
+        return 0;
       }
       
       pc++;
@@ -88,7 +88,8 @@ Token Lexer::lex_identifier() {
     }
 
     Tok k = kw(id);
-    return {k, id, line, start_col};
+    Symbol sym = intern(id);
+    return {k, std::move(id), line, start_col, sym};
 }
 
 Token Lexer::lex_number() {
@@ -18,36 +18,34 @@ void NamespaceRegistry::register_namespace(
     const std::string& namespace_name,
     const std::unordered_map<std::string, std::string>& methods
 ) {
-    // Normalize namespace name to lowercase
-    std::string lower_name = normalize_identifier(namespace_name);
-    
-    // Normalize method names and function names in the map
-    std::unordered_map<std::string, std::string> normalized_methods;
+    // Namespace and method names are interned (folded to lowercase);
+    // function names are normalized to lowercase
+    auto& table = namespaces_[intern(namespace_name)];
+    table.clear();
     for (const auto& [method_name, func_name] : methods) {
-        normalized_methods[normalize_identifier(method_name)] = normalize_identifier(func_name);
+        table[intern(method_name)] = normalize_identifier(func_name);
     }
-    
-    namespaces_[lower_name] = normalized_methods;
 }
 
 Value NamespaceRegistry::create_namespace_object(const std::string& namespace_name) const {
-    // Normalize namespace name to lowercase
-    std::string lower_name = normalize_identifier(namespace_name);
+    const Symbol ns = intern(namespace_name);
+    const std::string& lower_name = symbol_name(ns);
     
     Value::Map obj;
     obj[normalize_identifier("_type")] = Value::from_string(normalize_identifier("Namespace"));
     obj[normalize_identifier("_name")] = Value::from_string(lower_name);
     
     // Add all methods as properties (they'll be resolved at call time)
-    auto it = namespaces_.find(lower_name);
+    auto it = namespaces_.find(ns);
     if (it != namespaces_.end()) {
-        for (const auto& [method_name, func_name] : it->second) {
+        for (const auto& [method, func_name] : it->second) {
             // Store method metadata (all normalized to lowercase)
+            const std::string& method_name = symbol_name(method);
             Value::Map method_obj;
             method_obj[normalize_identifier("_type")] = Value::from_string(normalize_identifier("Method"));
             method_obj[normalize_identifier("_namespace")] = Value::from_string(lower_name);
             method_obj[normalize_identifier("_method")] = Value::from_string(method_name);
-            method_obj[normalize_identifier("_function")] = Value::from_string(normalize_identifier(func_name));
+            method_obj[normalize_identifier("_function")] = Value::from_string(func_name);
             obj[method_name] = Value::from_map(std::move(method_obj));
         }
     }
@@ -59,16 +57,13 @@ std::string NamespaceRegistry::resolve_method(
     const std::string& namespace_name,
     const std::string& method_name
 ) const {
-    // Normalize both namespace and method names to lowercase
-    std::string lower_ns = normalize_identifier(namespace_name);
-    std::string lower_method = normalize_identifier(method_name);
-    
-    auto ns_it = namespaces_.find(lower_ns);
+    // Names that were never interned cannot have been registered
+    auto ns_it = namespaces_.find(find_symbol(namespace_name));
     if (ns_it == namespaces_.end()) {
         return "";
     }
     
-    auto method_it = ns_it->second.find(lower_method);
+    auto method_it = ns_it->second.find(find_symbol(method_name));
     if (method_it == ns_it->second.end()) {
         return "";
     }
@@ -77,16 +72,15 @@ std::string NamespaceRegistry::resolve_method(
 }
 
 bool NamespaceRegistry::has_namespace(const std::string& namespace_name) const {
-    // Normalize namespace name to lowercase
-    std::string lower_name = normalize_identifier(namespace_name);
-    return namespaces_.find(lower_name) != namespaces_.end();
+    if (namespaces_.empty()) return false;
+    return namespaces_.find(find_symbol(namespace_name)) != namespaces_.end();
 }
 
 std::vector<std::string> NamespaceRegistry::get_namespaces() const {
     std::vector<std::string> result;
     result.reserve(namespaces_.size());
     for (const auto& [name, _] : namespaces_) {
-        result.push_back(name);
+        result.push_back(symbol_name(name));
     }
     return result;
 }
@@ -2,6 +2,8 @@
 #include "bas/value.hpp"
 #include "bas/ast.hpp"
 #include <stdexcept>
+#include <cctype>
+#include <cmath>
 
 using namespace bas;
 
@@ -11,8 +13,122 @@ static bool is_cmp(Tok k){ return k==Tok::Eq||k==Tok::Neq; }
 // Helper: Check if token is a statement separator (newline or colon)
 static bool is_statement_separator(Tok k) { return k == Tok::Newline || k == Tok::Colon; }
 
+static std::string fold_case(const std::string& name){
+  std::string r;
+  r.reserve(name.size());
+  for(char c : name) r.push_back(static_cast<char>(std::tolower(static_cast<unsigned char>(c))));
+  return r;
+}
+
+// Same arithmetic as the interpreter's Binary evaluation, restricted to
+// operands whose result cannot depend on runtime state. Returns false when
+// the operation must be left to run time (including its errors).
+static bool fold_binary(Tok op, const Value& L, const Value& R, Value& out){
+  if(op==Tok::Plus && L.is_string() && R.is_string()){ out = Value::from_string(L.as_string() + R.as_string()); return true; }
+  if(!L.is_number() || !R.is_number()) return false;
+  if(L.is_int() && R.is_int()){
+    long long li = L.as_int(), ri = R.as_int();
+    switch(op){
+      case Tok::Plus:  out = int_add(li, ri); return true;
+      case Tok::Minus: out = int_sub(li, ri); return true;
+      case Tok::Star:  out = int_mul(li, ri); return true;
+      default: break;
+    }
+  }
+  double l = L.as_number(), r = R.as_number();
+  auto cmp = [&]{
+    if(L.is_int() && R.is_int()) return L.as_int() < R.as_int() ? -1 : (L.as_int() > R.as_int() ? 1 : 0);
+    return l < r ? -1 : (l > r ? 1 : 0);
+  };
+  switch(op){
+    case Tok::Plus:  out = Value::from_number(l + r); return true;
+    case Tok::Minus: out = Value::from_number(l - r); return true;
+    case Tok::Star:  out = Value::from_number(l * r); return true;
+    case Tok::Slash: out = Value::from_number(l / r); return true;
+    case Tok::Power: out = Value::from_number(std::pow(l, r)); return true;
+    case Tok::IntDiv: {
+      long long li = static_cast<long long>(l), ri = static_cast<long long>(r);
+      if(ri == 0) return false;
+      out = Value::from_int(li / ri); return true;
+    }
+    case Tok::Mod:
+      if(r == 0.0) return false;
+      out = Value::from_number(std::fmod(l, r)); return true;
+    case Tok::Eq:  out = Value::from_bool(cmp() == 0); return true;
+    case Tok::Neq: out = Value::from_bool(cmp() != 0); return true;
+    case Tok::Lt:  out = Value::from_bool(cmp() <  0); return true;
+    case Tok::Lte: out = Value::from_bool(cmp() <= 0); return true;
+    case Tok::Gt:  out = Value::from_bool(cmp() >  0); return true;
+    case Tok::Gte: out = Value::from_bool(cmp() >= 0); return true;
+    default: return false;
+  }
+}
+
+static bool fold_unary(Tok op, const Value& v, Value& out){
+  if(!v.is_number()) return false;
+  if(v.is_int() && (op == Tok::Minus || op == Tok::Plus)){
+    out = op == Tok::Minus ? int_sub(0, v.as_int()) : v;
+    return true;
+  }
+  double d = v.as_number();
+  switch(op){
+    case Tok::Minus: out = Value::from_number(-d); return true;
+    case Tok::Plus: out = Value::from_number(+d); return true;
+    case Tok::Not: out = Value::from_bool(d == 0.0); return true;
+    case Tok::BitNot: out = Value::from_int(~static_cast<long long>(d)); return true;
+    default: return false;
+  }
+}
+
+static std::unique_ptr<Expr> folded_literal(const Token& at, Value v){
+  Tok kind = v.is_string() ? Tok::String : v.is_bool() ? (v.as_bool() ? Tok::True : Tok::False) : Tok::Number;
+  return std::make_unique<Literal>(Token{kind, "", at.line, at.col}, std::move(v));
+}
+
+std::unique_ptr<Expr> Parser::substitute_const(std::unique_ptr<Expr> e){
+  auto var = dynamic_cast<const Variable*>(e.get());
+  if(!var) return e;
+  auto it = known_consts.find(fold_case(var->name));
+  if(it == known_consts.end()) return e;
+  return std::make_unique<Literal>(Token{Tok::Number, var->name, peek().line, peek().col}, it->second);
+}
+
+std::unique_ptr<Expr> Parser::fold(std::unique_ptr<Expr> e){
+  if(auto b = dynamic_cast<Binary*>(e.get())){
+    b->left = substitute_const(std::move(b->left));
+    b->right = substitute_const(std::move(b->right));
+    auto l = dynamic_cast<const Literal*>(b->left.get());
+    auto r = dynamic_cast<const Literal*>(b->right.get());
+    Value out;
+    if(l && r && fold_binary(b->op, l->value, r->value, out)) return folded_literal(l->tok, std::move(out));
+  } else if(auto u = dynamic_cast<Unary*>(e.get())){
+    u->right = substitute_const(std::move(u->right));
+    auto r = dynamic_cast<const Literal*>(u->right.get());
+    Value out;
+    if(r && fold_unary(u->op, r->value, out)) return folded_literal(r->tok, std::move(out));
+  }
+  return e;
+}
+
+void Parser::note_top_level(const Stmt* s){
+  if(!leading_consts) return;
+  if(auto cd = dynamic_cast<const ConstDecl*>(s)){
+    auto lit = dynamic_cast<const Literal*>(cd->value.get());
+    if(!lit){ leading_consts = false; return; } // its value may run user code
+    auto key = fold_case(cd->name);
+    if(const_decls[key] == 1) known_consts[key] = lit->value;
+    return;
+  }
+  if(dynamic_cast<const SubDecl*>(s) || dynamic_cast<const FunctionDecl*>(s) ||
+     dynamic_cast<const OptionExplicit*>(s)) return;
+  leading_consts = false;
+}
+
 Program Parser::parse(){
   Program p; i=0; 
+  for(size_t k=0; k+1<ts.size(); ++k){
+    if(ts[k].kind==Tok::Const && ts[k+1].kind==Tok::Ident) ++const_decls[fold_case(ts[k+1].lex)];
+  }
   while(peek().kind!=Tok::Eof){
     skipNewlines();
     if(peek().kind==Tok::Eof) break;
@@ -24,6 +140,7 @@ Program Parser::parse(){
       continue;
     }
     if(auto s = statement()) {
+      note_top_level(s.get());
       p.stmts.push_back(std::move(s));
     } else {
       // Error recovery: consume until end of line to prevent infinite loop
@@ -38,6 +155,7 @@ Program Parser::parse(){
       skipNewlines();
       if(peek().kind==Tok::Eof) break;
       if(auto s = statement()) {
+        note_top_level(s.get());
         p.stmts.push_back(std::move(s));
       }
     }
@@ -68,7 +186,10 @@ std::unique_ptr<Stmt> Parser::parse_statement_no_skip() {
     
     // At this point, we should be at a statement-starting token (PRINT, VAR, IF, etc.)
     const Token& t = peek();
-    return dispatch_statement(t);
+    const int line = t.line;
+    auto s = dispatch_statement(t);
+    if(s) s->line = line;
+    return s;
 }
 
 std::unique_ptr<Stmt> Parser::statement() {
@@ -86,7 +207,10 @@ std::unique_ptr<Stmt> Parser::statement() {
     }
     
     const Token& t = peek();
-    return dispatch_statement(t);
+    const int line = t.line;
+    auto s = dispatch_statement(t);
+    if(s) s->line = line;
+    return s;
 }
 
 std::unique_ptr<Stmt> Parser::dispatch_statement(const Token& t) {
@@ -114,6 +238,14 @@ std::unique_ptr<Stmt> Parser::dispatch_statement(const Token& t) {
         case Tok::Redim:    return parse_dim();
         case Tok::Ident:    return parse_ident_statement();
         case Tok::Call:     return parse_call();
+        case Tok::Number: {
+            // Classic line number: a label for GOTO/GOSUB; the rest of the
+            // line is parsed as the next statement
+            if (!is_line_number(t)) break;
+            auto label = std::make_unique<Label>();
+            label->name = advance().lex;
+            return label;
+        }
 
         case Tok::Option: {
             advance();
@@ -129,22 +261,26 @@ std::unique_ptr<Stmt> Parser::dispatch_statement(const Token& t) {
             advance();
             return std::make_unique<Break>();
         }
+        case Tok::Continue: {
+            advance();
+            return std::make_unique<Continue>();
+        }
         case Tok::Exit: {
             advance();
             auto exitStmt = std::make_unique<Exit>();
-            if (check(Tok::Ident)) {
-                std::string target = advance().lex; // Already lowercase from lexer
-                if (target == "for" || target == "while" || target == "sub" || target == "function") {
+            // Loop and block keywords lex as their own tokens; their lexemes are lowercase
+            switch (peek().kind) {
+                case Tok::For: case Tok::While: case Tok::Do: case Tok::Loop:
+                case Tok::Repeat: case Tok::Sub: case Tok::Function: {
+                    std::string target = advance().lex;
+                    for (auto& ch : target) ch = static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
                     exitStmt->target = target;
-                } else {
-                    diag.err_at(peek().line, peek().col, "EXIT: expected FOR, WHILE, SUB, or FUNCTION");
-                    return nullptr;
+                    return exitStmt;
                 }
-            } else {
-                diag.err_at(peek().line, peek().col, "EXIT: expected target (FOR, WHILE, SUB, or FUNCTION)");
-                return nullptr;
+                default:
+                    diag.err_at(peek().line, peek().col, "EXIT: expected FOR, WHILE, DO, REPEAT, SUB, or FUNCTION");
+                    return nullptr;
             }
-            return exitStmt;
         }
         case Tok::Type: {
             return parse_type_decl();
@@ -257,6 +393,7 @@ std::vector<std::unique_ptr<Stmt>> Parser::stmt_list_until(Tok end1, Tok end2, T
     if(check_end_if()) break;
     if(check(Tok::End) && i + 1 < ts.size() && ts[i + 1].kind == Tok::Function) break;
     if(check(Tok::End) && i + 1 < ts.size() && ts[i + 1].kind == Tok::Sub) break;
+    if(check(Tok::End) && i + 1 < ts.size() && ts[i + 1].kind == Tok::Lambda) break;
     
     // Parse one statement - use parse_statement_no_skip() since we've already consumed separators
     // This avoids double separator consumption that would happen with statement()
@@ -317,7 +454,7 @@ std::unique_ptr<Expr> Parser::expression(){
 std::unique_ptr<Expr> Parser::or_(){
   auto e = xor_();
   // CRITICAL: Stop at statement separators to prevent swallowing the next statement
-  while(check(Tok::Or) && !is_statement_separator(peek().kind)){ Tok op=advance().kind; auto r=xor_(); e = std::make_unique<Binary>(std::move(e), op, std::move(r)); }
+  while(check(Tok::Or) && !is_statement_separator(peek().kind)){ Tok op=advance().kind; auto r=xor_(); e = fold(std::make_unique<Binary>(std::move(e), op, std::move(r))); }
   
   // Ternary operator: condition ? trueValue : falseValue
   if(check(Tok::Question)) {
@@ -339,50 +476,50 @@ std::unique_ptr<Expr> Parser::or_(){
 }
 std::unique_ptr<Expr> Parser::xor_(){
   auto e = and_();
-  while(check(Tok::Xor) && !is_statement_separator(peek().kind)){ Tok op=advance().kind; auto r=and_(); e = std::make_unique<Binary>(std::move(e), op, std::move(r)); }
+  while(check(Tok::Xor) && !is_statement_separator(peek().kind)){ Tok op=advance().kind; auto r=and_(); e = fold(std::make_unique<Binary>(std::move(e), op, std::move(r))); }
   return e;
 }
 std::unique_ptr<Expr> Parser::and_(){
   auto e = equality();
-  while(check(Tok::And) && !is_statement_separator(peek().kind)){ Tok op=advance().kind; auto r=equality(); e = std::make_unique<Binary>(std::move(e), op, std::move(r)); }
+  while(check(Tok::And) && !is_statement_separator(peek().kind)){ Tok op=advance().kind; auto r=equality(); e = fold(std::make_unique<Binary>(std::move(e), op, std::move(r))); }
   return e;
 }
 std::unique_ptr<Expr> Parser::equality(){
   auto e = comparison();
-  while(is_cmp(peek().kind) && !is_statement_separator(peek().kind)){ Tok op=advance().kind; auto r=comparison(); e = std::make_unique<Binary>(std::move(e), op, std::move(r)); }
+  while(is_cmp(peek().kind) && !is_statement_separator(peek().kind)){ Tok op=advance().kind; auto r=comparison(); e = fold(std::make_unique<Binary>(std::move(e), op, std::move(r))); }
   return e;
 }
 std::unique_ptr<Expr> Parser::comparison(){
   auto e = term();
   while((check(Tok::Lt) || check(Tok::Lte) || check(Tok::Gt) || check(Tok::Gte)) && !is_statement_separator(peek().kind)){
-    Tok op=advance().kind; auto r=term(); e = std::make_unique<Binary>(std::move(e), op, std::move(r));
+    Tok op=advance().kind; auto r=term(); e = fold(std::make_unique<Binary>(std::move(e), op, std::move(r)));
   }
   return e;
 }
 std::unique_ptr<Expr> Parser::term(){
   auto e = factor();
   while((check(Tok::Plus) || check(Tok::Minus)) && !is_statement_separator(peek().kind)){
-    Tok op=advance().kind; auto r=factor(); e = std::make_unique<Binary>(std::move(e), op, std::move(r));
+    Tok op=advance().kind; auto r=factor(); e = fold(std::make_unique<Binary>(std::move(e), op, std::move(r)));
   }
   return e;
 }
 std::unique_ptr<Expr> Parser::factor(){
   auto e = power();
   while((check(Tok::Star) || check(Tok::Slash) || check(Tok::Mod) || check(Tok::IntDiv)) && !is_statement_separator(peek().kind)){
-    Tok op=advance().kind; auto r=power(); e = std::make_unique<Binary>(std::move(e), op, std::move(r));
+    Tok op=advance().kind; auto r=power(); e = fold(std::make_unique<Binary>(std::move(e), op, std::move(r)));
   }
   return e;
 }
 std::unique_ptr<Expr> Parser::power(){
   auto e = unary();
   while(check(Tok::Power) && !is_statement_separator(peek().kind)){
-    Tok op=advance().kind; auto r=unary(); e = std::make_unique<Binary>(std::move(e), op, std::move(r));
+    Tok op=advance().kind; auto r=unary(); e = fold(std::make_unique<Binary>(std::move(e), op, std::move(r)));
   }
   return e;
 }
 std::unique_ptr<Expr> Parser::unary(){
   if(check(Tok::Plus) || check(Tok::Minus) || check(Tok::Not) || check(Tok::BitNot)){
-    Tok op=advance().kind; auto r=unary(); return std::make_unique<Unary>(op, std::move(r));
+    Tok op=advance().kind; auto r=unary(); return fold(std::make_unique<Unary>(op, std::move(r)));
   }
   return primary();
 }
@@ -396,6 +533,11 @@ std::unique_ptr<Expr> Parser::primary(){
   if(t.kind==Tok::FString){
     return parse_fstring();
   }
+  if(t.kind==Tok::Lambda){
+    auto lambda = parse_lambda();
+    if(!lambda) return nullptr;
+    return parse_postfix(std::move(lambda));
+  }
   if(t.kind==Tok::LBracket){
     // Array literal: [ e1, e2, ... ]
     advance();
@@ -420,8 +562,6 @@ std::unique_ptr<Expr> Parser::primary(){
       return parse_get_methods();
     } else if(id.lex == "super") {
       return parse_super_call();
-    } else if(id.lex == "lambda") {
-      return parse_lambda();
     }
     
     if(check(Tok::LParen)){
@@ -665,6 +805,7 @@ std::unique_ptr<Stmt> Parser::parse_let() {
         
         auto s = std::make_unique<AssignIndex>();
         s->name = std::move(name);
+        s->sym = intern(s->name);
         s->indices = std::move(indices);
         s->value = std::move(val);
         return s;
@@ -710,7 +851,7 @@ std::unique_ptr<Stmt> Parser::parse_const() {
         diag.err(peek().line, peek().col, "CONST: expected '=' after constant name", "Add an equals sign to assign a value", "CONST PI = 3.14159");
         return nullptr;
     }
-    auto v = expression();
+    auto v = substitute_const(expression());
     auto s = std::make_unique<ConstDecl>();
     s->name = std::move(name);
     s->value = std::move(v);
@@ -736,6 +877,7 @@ std::unique_ptr<Stmt> Parser::parse_input() {
     auto call = std::make_unique<Call>(std::string("INPUT"), std::move(args));
     auto asn = std::make_unique<Assign>();
     asn->name = std::move(var);
+    asn->sym = intern(asn->name);
     asn->value = std::move(call);
     return asn;
 }
@@ -968,6 +1110,7 @@ std::unique_ptr<Stmt> Parser::parse_for() {
 
         auto user_var_assign = std::make_unique<Assign>();
         user_var_assign->name = var;
+        user_var_assign->sym = intern(var);
         user_var_assign->value = std::make_unique<Index>(
             std::make_unique<Variable>(list_var),
             std::make_unique<Variable>(idx_var)
@@ -985,6 +1128,7 @@ std::unique_ptr<Stmt> Parser::parse_for() {
 
         auto incr = std::make_unique<Assign>();
         incr->name = idx_var;
+        incr->sym = intern(idx_var);
         incr->value = std::make_unique<Binary>(
             std::make_unique<Variable>(idx_var),
             Tok::Plus,
@@ -1017,6 +1161,7 @@ std::unique_ptr<Stmt> Parser::parse_for() {
 
     auto s = std::make_unique<ForNext>();
     s->var = std::move(var);
+    s->var_sym = intern(s->var);
     s->init = std::move(init);
     s->limit = std::move(limit);
     s->step = std::move(step);
@@ -1120,8 +1265,8 @@ std::unique_ptr<Stmt> Parser::parse_return() {
 
 std::unique_ptr<Stmt> Parser::parse_gosub() {
     advance(); // consume GOSUB
-    if (!check(Tok::Ident)) {
-        diag.err(peek().line, peek().col, "GOSUB: expected label name");
+    if (!check(Tok::Ident) && !is_line_number(peek())) {
+        diag.err(peek().line, peek().col, "GOSUB: expected label name or line number");
         return nullptr;
     }
     std::string label = advance().lex;
@@ -1132,8 +1277,8 @@ std::unique_ptr<Stmt> Parser::parse_gosub() {
 
 std::unique_ptr<Stmt> Parser::parse_goto() {
     advance(); // consume GOTO
-    if (!check(Tok::Ident)) {
-        diag.err(peek().line, peek().col, "GOTO: expected label name");
+    if (!check(Tok::Ident) && !is_line_number(peek())) {
+        diag.err(peek().line, peek().col, "GOTO: expected label name or line number");
         return nullptr;
     }
     std::string label = advance().lex;
@@ -1208,9 +1353,9 @@ std::unique_ptr<Stmt> Parser::parse_ident_statement() {
             return nullptr;
         }
         Token member = advance();
-        base_expr = std::make_unique<MemberAccess>(std::move(base_expr), member.lex);
         
         // Check if this is a member assignment: name.member = value
+        // (the assignment targets the variable itself, not a copy of its member)
         if (match(Tok::Eq)) {
             auto val = expression();
             auto s = std::make_unique<AssignMember>();
@@ -1221,7 +1366,7 @@ std::unique_ptr<Stmt> Parser::parse_ident_statement() {
         }
         // Otherwise, it's just a member access expression statement
         auto s = std::make_unique<ExprStmt>();
-        s->expr = std::move(base_expr);
+        s->expr = std::make_unique<MemberAccess>(std::move(base_expr), member.lex);
         return s;
     }
 
@@ -1242,6 +1387,7 @@ std::unique_ptr<Stmt> Parser::parse_ident_statement() {
         auto val = expression();
         auto s = std::make_unique<AssignIndex>();
         s->name = id.lex;
+        s->sym = id.sym;
         s->indices = std::move(indices);
         s->value = std::move(val);
         return s;
@@ -1249,6 +1395,7 @@ std::unique_ptr<Stmt> Parser::parse_ident_statement() {
         auto v = expression();
         auto s = std::make_unique<Assign>();
         s->name = id.lex;
+        s->sym = id.sym;
         s->value = std::move(v);
         return s;
     } else if (check(Tok::LParen)) { // Procedure call
@@ -1498,7 +1645,7 @@ std::unique_ptr<Stmt> Parser::parse_await() {
 std::unique_ptr<Stmt> Parser::parse_yield() {
     advance(); // consume YIELD
     auto stmt = std::make_unique<YieldStmt>();
-    if (!check(Tok::Newline) && !check(Tok::Eof)) {
+    if (!check(Tok::Newline) && !check(Tok::Colon) && !check(Tok::Eof)) {
         stmt->value = expression();
     }
     return stmt;
@@ -1610,8 +1757,8 @@ std::unique_ptr<Expr> Parser::parse_lambda() {
     
     // Parse body
     lambda->body = stmt_list_until(Tok::EndLambda, Tok::Eof);
-    if (!match(Tok::EndLambda)) {
-        diag.err_at(peek().line, peek().col, "LAMBDA: expected END LAMBDA");
+    if (!match(Tok::EndLambda) && !match2(Tok::End, Tok::Lambda)) {
+        diag.err_at(peek().line, peek().col, "LAMBDA: expected ENDLAMBDA or END LAMBDA");
         return nullptr;
     }
     
@@ -0,0 +1,277 @@
+#include "bas/profiler.hpp"
+#include "bas/runtime.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace bas;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+struct Frame {
+  std::string_view name;
+  const NativeFn* native{nullptr};
+  int line{0};
+  Clock::time_point start{};  // native frames only
+};
+
+struct NativeStats {
+  std::string name;
+  uint64_t calls{0};
+  Clock::duration time{};
+  bool ends_frame{false};
+};
+
+// Time and samples between two frame marks
+struct FrameStats {
+  Clock::duration time{};
+  uint64_t samples{0};
+};
+
+// Natives that present a rendered frame, and PROFILE_FRAME for scripts
+// without a window; returning from one marks a frame
+bool ends_render_frame(const std::string& name) {
+  return name == "ENDDRAWING" || name == "SYNC" || name == "GAMELOOPEND" || name == "GAME_ENDFRAME" ||
+         name == "PROFILE_FRAME";
+}
+
+struct Profiler {
+  std::string output;
+  std::chrono::microseconds interval{1000};
+  std::thread timer;
+  std::atomic<bool> stopping{false};
+  std::atomic<uint64_t> ticks{0};  // written by the timer thread
+  uint64_t charged{0};             // ticks already charged to a stack
+
+  // A deque keeps profile_line() references valid while frames are pushed
+  std::deque<Frame> stack;
+  uint64_t samples{0};
+  std::unordered_map<std::string, uint64_t> folded;
+  std::unordered_map<std::string, uint64_t> self_time;   // by innermost frame
+  std::unordered_map<std::string, uint64_t> total_time;  // by every frame on the stack
+  std::unordered_map<std::string, uint64_t> line_time;   // by innermost script line
+  std::unordered_map<const NativeFn*, NativeStats> natives;
+
+  Clock::time_point frame_start{};  // unset until the program's first frame
+  uint64_t frame_samples{0};        // `samples` when the current render frame began
+  std::vector<FrameStats> frames;
+};
+
+std::unique_ptr<Profiler> g_profiler;
+
+void run_timer(Profiler& p) {
+  const Clock::time_point start = Clock::now();
+  while (!p.stopping.load(std::memory_order_relaxed)) {
+    std::this_thread::sleep_for(p.interval);
+    // Ticks follow elapsed time, so an oversleeping timer loses no samples
+    auto n = static_cast<uint64_t>((Clock::now() - start) / p.interval);
+    if (n != p.ticks.load(std::memory_order_relaxed)) {
+      p.ticks.store(n, std::memory_order_relaxed);
+      g_profile_due.store(true, std::memory_order_relaxed);
+    }
+  }
+}
+
+std::string frame_label(const Frame& f) {
+  std::string s(f.name);
+  if (!f.native && f.line > 0) s += ":" + std::to_string(f.line);
+  return s;
+}
+
+template <typename Map>
+std::vector<std::pair<typename Map::key_type, typename Map::mapped_type>> hottest(const Map& m, size_t n) {
+  std::vector<std::pair<typename Map::key_type, typename Map::mapped_type>> v(m.begin(), m.end());
+  std::sort(v.begin(), v.end(), [](const auto& a, const auto& b) { return a.second > b.second; });
+  if (v.size() > n) v.resize(n);
+  return v;
+}
+
+double ms(Clock::duration d) { return std::chrono::duration<double, std::milli>(d).count(); }
+
+void print_frames(const Profiler& p) {
+  constexpr size_t kSlowest = 5;
+  char buf[256];
+  std::cerr << std::endl << "Frames: " << p.frames.size();
+  if (p.frames.empty()) {
+    std::cerr << " (none marked; frames end at ENDDRAWING, SYNC or PROFILE_FRAME)" << std::endl;
+    return;
+  }
+  std::vector<Clock::duration> times;
+  Clock::duration sum{};
+  uint64_t samples = 0;
+  for (const FrameStats& f : p.frames) {
+    times.push_back(f.time);
+    sum += f.time;
+    samples += f.samples;
+  }
+  std::sort(times.begin(), times.end());
+  auto at = [&](double q) { return ms(times[static_cast<size_t>(q * static_cast<double>(times.size() - 1))]); };
+  const double n = static_cast<double>(p.frames.size());
+  std::snprintf(buf, sizeof buf, ", %.3f ms mean, %.3f median, %.3f p95, %.3f p99, %.3f max, %.1f samples per frame",
+                ms(sum) / n, at(0.5), at(0.95), at(0.99), ms(times.back()),
+                static_cast<double>(samples) / n);
+  std::cerr << buf << std::endl;
+
+  std::vector<size_t> slowest(p.frames.size());
+  for (size_t i = 0; i < slowest.size(); ++i) slowest[i] = i;
+  std::sort(slowest.begin(), slowest.end(), [&](size_t a, size_t b) { return p.frames[a].time > p.frames[b].time; });
+  if (slowest.size() > kSlowest) slowest.resize(kSlowest);
+  std::cerr << std::endl << "      Frame          ms   Samples" << std::endl;
+  for (size_t i : slowest) {
+    std::snprintf(buf, sizeof buf, "  %9zu  %10.3f  %8llu", i + 1, ms(p.frames[i].time),
+                  static_cast<unsigned long long>(p.frames[i].samples));
+    std::cerr << buf << std::endl;
+  }
+}
+
+void print_summary(const Profiler& p) {
+  constexpr size_t kRows = 15;
+  const double ms_per_sample = std::chrono::duration<double, std::milli>(p.interval).count();
+  const double total = p.samples ? static_cast<double>(p.samples) : 1.0;
+  auto pct = [&](uint64_t n) { return 100.0 * static_cast<double>(n) / total; };
+  char buf[256];
+
+  std::cerr << std::endl << "Profile: " << p.samples << " samples every " << p.interval.count() << " us ("
+            << static_cast<double>(p.samples) * ms_per_sample / 1000.0 << " s)" << std::endl;
+  std::cerr << "Folded stacks: " << p.output << std::endl;
+  print_frames(p);
+
+  std::cerr << std::endl << "   Self%  Total%  Function" << std::endl;
+  for (const auto& [name, self] : hottest(p.self_time, kRows)) {
+    auto it = p.total_time.find(name);
+    std::snprintf(buf, sizeof buf, "  %6.2f  %6.2f  ", pct(self), pct(it == p.total_time.end() ? self : it->second));
+    std::cerr << buf << name << std::endl;
+  }
+
+  std::cerr << std::endl << "   Self%  Line (time in natives it calls included)" << std::endl;
+  for (const auto& [where, n] : hottest(p.line_time, kRows)) {
+    std::snprintf(buf, sizeof buf, "  %6.2f  ", pct(n));
+    std::cerr << buf << where << std::endl;
+  }
+
+  if (p.natives.empty()) return;
+  std::vector<const NativeStats*> natives;
+  for (const auto& [fn, stats] : p.natives) natives.push_back(&stats);
+  std::sort(natives.begin(), natives.end(), [](const NativeStats* a, const NativeStats* b) { return a->time > b->time; });
+  if (natives.size() > kRows) natives.resize(kRows);
+  std::cerr << std::endl << "      Calls    Total ms  Native" << std::endl;
+  for (const NativeStats* s : natives) {
+    std::snprintf(buf, sizeof buf, "  %9llu  %10.3f  ", static_cast<unsigned long long>(s->calls),
+                  ms(s->time));
+    std::cerr << buf << s->name << std::endl;
+  }
+}
+
+} // namespace
+
+void bas::profiler_start(const std::string& folded_path, int interval_us) {
+  if (g_profiler) return;
+  g_profiler = std::make_unique<Profiler>();
+  g_profiler->output = folded_path;
+  g_profiler->interval = std::chrono::microseconds(std::max(interval_us, 50));
+  g_profile_due.store(false, std::memory_order_relaxed);
+  g_profiling = true;
+  g_profiler->timer = std::thread(run_timer, std::ref(*g_profiler));
+}
+
+void bas::profiler_stop() {
+  if (!g_profiler) return;
+  g_profiling = false;
+  g_profiler->stopping.store(true, std::memory_order_relaxed);
+  g_profiler->timer.join();
+  std::unique_ptr<Profiler> p = std::move(g_profiler);
+
+  std::ofstream out(p->output);
+  for (const auto& [stack, n] : p->folded) out << stack << ' ' << n << '\n';
+  if (!out) std::cerr << "Error: Cannot write profile to '" << p->output << "'" << std::endl;
+  print_summary(*p);
+}
+
+void bas::profile_enter(std::string_view name, const NativeFn* native) {
+  if (!g_profiler) return;
+  Profiler& p = *g_profiler;
+  // Time before the program's first frame (parsing, runtime setup) is not charged
+  if (p.stack.empty()) {
+    p.charged = p.ticks.load(std::memory_order_relaxed);
+    if (p.frame_start == Clock::time_point{}) p.frame_start = Clock::now();
+  }
+  Frame f;
+  f.name = name;
+  f.native = native;
+  if (native) f.start = Clock::now();
+  p.stack.push_back(f);
+}
+
+void bas::profile_leave() {
+  if (!g_profiler || g_profiler->stack.empty()) return;
+  Profiler& p = *g_profiler;
+  const Frame& f = p.stack.back();
+  if (f.native) {
+    // Ticks that passed during the call belong to the native
+    if (g_profile_due.load(std::memory_order_relaxed)) profile_sample();
+    NativeStats& s = p.natives[f.native];
+    if (s.name.empty()) {
+      s.name = std::string(f.name);
+      s.ends_frame = ends_render_frame(f.native->name);
+    }
+    ++s.calls;
+    s.time += Clock::now() - f.start;
+    p.stack.pop_back();
+    if (s.ends_frame) profile_frame();
+    return;
+  }
+  p.stack.pop_back();
+}
+
+void bas::profile_frame() {
+  if (!g_profiler) return;
+  // Ticks counted so far belong to the frame that is ending
+  if (g_profile_due.load(std::memory_order_relaxed)) profile_sample();
+  Profiler& p = *g_profiler;
+  const Clock::time_point now = Clock::now();
+  if (p.frame_start != Clock::time_point{}) p.frames.push_back({now - p.frame_start, p.samples - p.frame_samples});
+  p.frame_start = now;
+  p.frame_samples = p.samples;
+}
+
+int& bas::profile_line() {
+  static int detached = 0;  // no frame: writes go nowhere
+  return g_profiler && !g_profiler->stack.empty() ? g_profiler->stack.back().line : detached;
+}
+
+void bas::profile_sample() {
+  g_profile_due.store(false, std::memory_order_relaxed);
+  if (!g_profiler) return;
+  Profiler& p = *g_profiler;
+  const uint64_t now = p.ticks.load(std::memory_order_relaxed);
+  const uint64_t n = now - p.charged;
+  p.charged = now;
+  if (n == 0 || p.stack.empty()) return;
+  p.samples += n;
+
+  std::string stack;
+  std::vector<std::string_view> seen;
+  for (const Frame& f : p.stack) {
+    if (!stack.empty()) stack += ';';
+    stack += frame_label(f);
+    if (std::find(seen.begin(), seen.end(), f.name) == seen.end()) {
+      seen.push_back(f.name);
+      p.total_time[std::string(f.name)] += n;
+    }
+  }
+  p.folded[stack] += n;
+  p.self_time[std::string(p.stack.back().name)] += n;
+  for (auto it = p.stack.rbegin(); it != p.stack.rend(); ++it) {
+    if (it->native) continue;
+    p.line_time[std::string(it->name) + " line " + std::to_string(it->line)] += n;
+    break;
+  }
+}
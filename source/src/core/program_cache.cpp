@@ -0,0 +1,1173 @@
+#include "bas/program_cache.hpp"
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <system_error>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace bas;
+
+namespace {
+
+// File layout, all integers little-endian:
+//   "BBC1" u32 version
+//   u32 source count, then per source: str path, u64 hash
+//   u32 statement count, then the statements
+// Nodes are a u8 tag followed by their fields; tag 0 is a null node.
+// Statements end with their source line.
+constexpr char kMagic[4] = {'B', 'B', 'C', '1'};
+// Bump whenever an AST node or the encoding below changes.
+constexpr uint32_t kFormatVersion = 2;
+
+enum class ExprTag : uint8_t {
+  Null, Literal, Variable, Unary, Binary, Call, Index, MemberAccess, MethodCall, ArrayLiteral,
+  Lambda, InterpolatedString, MapLiteral, TypeOf, GetProperties, GetMethods, SuperCall, Range,
+  Comprehension, NullSafe, NullCoalesce, Ternary, Tuple, Match, Spread
+};
+
+enum class StmtTag : uint8_t {
+  Null, OptionExplicit, Let, Const, Assign, Local, Global, Print, PrintC, ExprStmt, CallStmt,
+  Break, Continue, Exit, Goto, Gosub, Label, End, Import, IfChain, IfThenEndIf, WhileWend,
+  DoLoop, RepeatUntil, ForNext, Sub, Function, AssignIndex, AssignMember, Return, Dim, Redim,
+  SelectCase, Type, ForEach, Module, Operator, Yield, Await, EventHandler, Assert, Breakpoint,
+  DebugPrint, Destructure, Using, Enum, Union, StateHook, Transition, State, Parallel,
+  StateGroup, StateSystem, AttachSystem, AddState, RemoveState, OverrideState,
+  SetTransitionRule, EnableDisableState, DebugStates, ExportSystem, ImportSystem, EventDecl,
+  Animation, Wait
+};
+
+enum class ValueTag : uint8_t { Nil, Number, Int, Bool, String, Packed };
+
+using Exprs = std::vector<std::unique_ptr<Expr>>;
+using Stmts = std::vector<std::unique_ptr<Stmt>>;
+
+// ===== Writing =====
+
+class Writer {
+public:
+  std::string out;
+
+  void u8(uint8_t v) { out.push_back(static_cast<char>(v)); }
+  void flag(bool v) { u8(v ? 1 : 0); }
+  void u32(uint32_t v) { for (int i = 0; i < 4; ++i) u8(static_cast<uint8_t>(v >> (8 * i))); }
+  void u64(uint64_t v) { for (int i = 0; i < 8; ++i) u8(static_cast<uint8_t>(v >> (8 * i))); }
+  void i32(int v) { u32(static_cast<uint32_t>(v)); }
+  void f64(double d) { uint64_t bits; std::memcpy(&bits, &d, sizeof bits); u64(bits); }
+  void str(const std::string& s) { u32(static_cast<uint32_t>(s.size())); out.append(s); }
+  void strs(const std::vector<std::string>& v) { u32(static_cast<uint32_t>(v.size())); for (const auto& s : v) str(s); }
+
+  void token(const Token& t) {
+    u32(static_cast<uint32_t>(t.kind));
+    str(t.lex);
+    i32(t.line);
+    i32(t.col);
+    flag(t.sym != 0);
+  }
+
+  void value(const Value& v) {
+    if (v.is_nil()) { u8(static_cast<uint8_t>(ValueTag::Nil)); return; }
+    if (v.is_int()) { u8(static_cast<uint8_t>(ValueTag::Int)); u64(static_cast<uint64_t>(v.as_int())); return; }
+    if (v.is_number()) { u8(static_cast<uint8_t>(ValueTag::Number)); f64(v.as_number()); return; }
+    if (v.is_bool()) { u8(static_cast<uint8_t>(ValueTag::Bool)); flag(v.as_bool()); return; }
+    if (v.is_string()) { u8(static_cast<uint8_t>(ValueTag::String)); str(v.as_string()); return; }
+    if (const Packed* p = v.packed()) {
+      u8(static_cast<uint8_t>(ValueTag::Packed));
+      u8(static_cast<uint8_t>(p->kind));
+      for (float f : p->f) f64(f);
+      return;
+    }
+    throw std::runtime_error("constant of this type cannot be cached");
+  }
+
+  void param(const FunctionParam& p) {
+    str(p.name);
+    str(p.typeName);
+    flag(p.hasType);
+    expr(p.defaultValue.get());
+    flag(p.hasDefault);
+  }
+  void params(const std::vector<FunctionParam>& v) { u32(static_cast<uint32_t>(v.size())); for (const auto& p : v) param(p); }
+
+  void exprs(const Exprs& v) { u32(static_cast<uint32_t>(v.size())); for (const auto& e : v) expr(e.get()); }
+  void stmts(const Stmts& v) { u32(static_cast<uint32_t>(v.size())); for (const auto& s : v) stmt(s.get()); }
+
+  void expr(const Expr* e);
+  void stmt(const Stmt* s) {
+    stmt_node(s);
+    if (s) i32(s->line);
+  }
+  void stmt_node(const Stmt* s);
+  void state(const StateDecl& s);
+  void hook(const StateHook& h) { u8(static_cast<uint8_t>(h.type)); stmts(h.body); }
+  void transition(const TransitionDecl& t) { str(t.fromState); str(t.toState); expr(t.condition.get()); i32(t.priority); }
+  void states(const std::vector<std::unique_ptr<StateDecl>>& v) {
+    u32(static_cast<uint32_t>(v.size()));
+    for (const auto& s : v) state(*s);
+  }
+
+private:
+  void tag(ExprTag t) { u8(static_cast<uint8_t>(t)); }
+  void tag(StmtTag t) { u8(static_cast<uint8_t>(t)); }
+};
+
+void Writer::expr(const Expr* e) {
+  if (!e) { tag(ExprTag::Null); return; }
+  if (auto n = dynamic_cast<const Literal*>(e)) { tag(ExprTag::Literal); token(n->tok); value(n->value); return; }
+  if (auto n = dynamic_cast<const Variable*>(e)) { tag(ExprTag::Variable); str(n->name); return; }
+  if (auto n = dynamic_cast<const Unary*>(e)) { tag(ExprTag::Unary); u32(static_cast<uint32_t>(n->op)); expr(n->right.get()); return; }
+  if (auto n = dynamic_cast<const Binary*>(e)) {
+    tag(ExprTag::Binary); expr(n->left.get()); u32(static_cast<uint32_t>(n->op)); expr(n->right.get());
+    return;
+  }
+  if (auto n = dynamic_cast<const Call*>(e)) {
+    tag(ExprTag::Call); str(n->callee); exprs(n->args);
+    u32(static_cast<uint32_t>(n->namedArgs.size()));
+    for (const auto& na : n->namedArgs) { str(na.name); expr(na.value.get()); }
+    return;
+  }
+  if (auto n = dynamic_cast<const Index*>(e)) { tag(ExprTag::Index); expr(n->target.get()); expr(n->index.get()); return; }
+  if (auto n = dynamic_cast<const MemberAccess*>(e)) { tag(ExprTag::MemberAccess); expr(n->object.get()); str(n->member); return; }
+  if (auto n = dynamic_cast<const MethodCall*>(e)) {
+    tag(ExprTag::MethodCall); expr(n->object.get()); str(n->method); exprs(n->args);
+    return;
+  }
+  if (auto n = dynamic_cast<const ArrayLiteral*>(e)) { tag(ExprTag::ArrayLiteral); exprs(n->elements); return; }
+  if (auto n = dynamic_cast<const LambdaExpr*>(e)) {
+    tag(ExprTag::Lambda); params(n->params); str(n->returnType); flag(n->hasReturnType); stmts(n->body);
+    return;
+  }
+  if (auto n = dynamic_cast<const InterpolatedString*>(e)) { tag(ExprTag::InterpolatedString); exprs(n->parts); return; }
+  if (auto n = dynamic_cast<const MapLiteral*>(e)) {
+    tag(ExprTag::MapLiteral);
+    u32(static_cast<uint32_t>(n->entries.size()));
+    for (const auto& [k, v] : n->entries) { expr(k.get()); expr(v.get()); }
+    return;
+  }
+  if (auto n = dynamic_cast<const TypeOfExpr*>(e)) { tag(ExprTag::TypeOf); expr(n->value.get()); return; }
+  if (auto n = dynamic_cast<const GetPropertiesExpr*>(e)) { tag(ExprTag::GetProperties); expr(n->value.get()); return; }
+  if (auto n = dynamic_cast<const GetMethodsExpr*>(e)) { tag(ExprTag::GetMethods); expr(n->value.get()); return; }
+  if (auto n = dynamic_cast<const SuperCall*>(e)) { tag(ExprTag::SuperCall); str(n->method); exprs(n->args); return; }
+  if (auto n = dynamic_cast<const RangeLiteral*>(e)) { tag(ExprTag::Range); expr(n->start.get()); expr(n->end.get()); return; }
+  if (auto n = dynamic_cast<const ArrayComprehension*>(e)) {
+    tag(ExprTag::Comprehension); expr(n->expr.get()); str(n->var); expr(n->collection.get()); expr(n->condition.get());
+    return;
+  }
+  if (auto n = dynamic_cast<const NullSafeAccess*>(e)) {
+    tag(ExprTag::NullSafe); expr(n->object.get()); str(n->member); flag(n->isIndex); expr(n->index.get());
+    return;
+  }
+  if (auto n = dynamic_cast<const NullCoalesceExpr*>(e)) { tag(ExprTag::NullCoalesce); expr(n->left.get()); expr(n->right.get()); return; }
+  if (auto n = dynamic_cast<const TernaryExpr*>(e)) {
+    tag(ExprTag::Ternary); expr(n->condition.get()); expr(n->trueValue.get()); expr(n->falseValue.get());
+    return;
+  }
+  if (auto n = dynamic_cast<const TupleLiteral*>(e)) { tag(ExprTag::Tuple); exprs(n->elements); return; }
+  if (auto n = dynamic_cast<const MatchExpr*>(e)) {
+    tag(ExprTag::Match); expr(n->value.get());
+    u32(static_cast<uint32_t>(n->cases.size()));
+    for (const auto& c : n->cases) { expr(c.pattern.get()); expr(c.result.get()); }
+    expr(n->defaultCase.get());
+    return;
+  }
+  if (auto n = dynamic_cast<const SpreadExpr*>(e)) { tag(ExprTag::Spread); expr(n->value.get()); return; }
+  throw std::runtime_error("expression node cannot be cached");
+}
+
+void Writer::state(const StateDecl& s) {
+  str(s.name);
+  str(s.animation);
+  f64(s.animationBlend);
+  f64(s.waitTime);
+  stmts(s.body);
+  u32(static_cast<uint32_t>(s.hooks.size()));
+  for (const auto& h : s.hooks) hook(h);
+  u32(static_cast<uint32_t>(s.transitions.size()));
+  for (const auto& t : s.transitions) transition(t);
+}
+
+void Writer::stmt_node(const Stmt* s) {
+  if (!s) { tag(StmtTag::Null); return; }
+  if (auto n = dynamic_cast<const OptionExplicit*>(s)) { tag(StmtTag::OptionExplicit); flag(n->enabled); return; }
+  if (auto n = dynamic_cast<const Let*>(s)) { tag(StmtTag::Let); str(n->name); expr(n->value.get()); str(n->typeName); flag(n->hasType); return; }
+  if (auto n = dynamic_cast<const ConstDecl*>(s)) { tag(StmtTag::Const); str(n->name); expr(n->value.get()); return; }
+  if (auto n = dynamic_cast<const Assign*>(s)) { tag(StmtTag::Assign); str(n->name); expr(n->value.get()); return; }
+  if (auto n = dynamic_cast<const LocalDecl*>(s)) { tag(StmtTag::Local); strs(n->names); return; }
+  if (auto n = dynamic_cast<const GlobalDecl*>(s)) { tag(StmtTag::Global); strs(n->names); return; }
+  if (auto n = dynamic_cast<const Print*>(s)) { tag(StmtTag::Print); expr(n->value.get()); return; }
+  if (auto n = dynamic_cast<const PrintC*>(s)) { tag(StmtTag::PrintC); expr(n->value.get()); return; }
+  if (auto n = dynamic_cast<const ExprStmt*>(s)) { tag(StmtTag::ExprStmt); expr(n->expr.get()); return; }
+  if (auto n = dynamic_cast<const CallStmt*>(s)) { tag(StmtTag::CallStmt); str(n->name); exprs(n->args); return; }
+  if (dynamic_cast<const Break*>(s)) { tag(StmtTag::Break); return; }
+  if (dynamic_cast<const Continue*>(s)) { tag(StmtTag::Continue); return; }
+  if (auto n = dynamic_cast<const Exit*>(s)) { tag(StmtTag::Exit); str(n->target); return; }
+  if (auto n = dynamic_cast<const Goto*>(s)) { tag(StmtTag::Goto); str(n->label); return; }
+  if (auto n = dynamic_cast<const Gosub*>(s)) { tag(StmtTag::Gosub); str(n->label); return; }
+  if (auto n = dynamic_cast<const Label*>(s)) { tag(StmtTag::Label); str(n->name); return; }
+  if (dynamic_cast<const End*>(s)) { tag(StmtTag::End); return; }
+  if (auto n = dynamic_cast<const ImportStmt*>(s)) { tag(StmtTag::Import); str(n->path); return; }
+  if (auto n = dynamic_cast<const IfChain*>(s)) {
+    tag(StmtTag::IfChain);
+    u32(static_cast<uint32_t>(n->branches.size()));
+    for (const auto& b : n->branches) { expr(b.cond.get()); stmts(b.body); }
+    stmts(n->elseBody);
+    flag(n->hasElse);
+    return;
+  }
+  if (auto n = dynamic_cast<const IfThenEndIf*>(s)) { tag(StmtTag::IfThenEndIf); expr(n->cond.get()); stmts(n->body); return; }
+  if (auto n = dynamic_cast<const WhileWend*>(s)) { tag(StmtTag::WhileWend); expr(n->cond.get()); stmts(n->body); return; }
+  if (auto n = dynamic_cast<const DoLoop*>(s)) {
+    tag(StmtTag::DoLoop); stmts(n->body); expr(n->untilCond.get()); expr(n->whileCond.get());
+    flag(n->hasUntil); flag(n->hasWhile);
+    return;
+  }
+  if (auto n = dynamic_cast<const RepeatUntil*>(s)) { tag(StmtTag::RepeatUntil); stmts(n->body); expr(n->cond.get()); return; }
+  if (auto n = dynamic_cast<const ForNext*>(s)) {
+    tag(StmtTag::ForNext); str(n->var); expr(n->init.get()); expr(n->limit.get()); expr(n->step.get()); stmts(n->body);
+    return;
+  }
+  if (auto n = dynamic_cast<const SubDecl*>(s)) { tag(StmtTag::Sub); str(n->name); strs(n->params); stmts(n->body); return; }
+  if (auto n = dynamic_cast<const FunctionDecl*>(s)) {
+    tag(StmtTag::Function); str(n->name); params(n->params); str(n->returnType); flag(n->hasReturnType); stmts(n->body);
+    return;
+  }
+  if (auto n = dynamic_cast<const AssignIndex*>(s)) {
+    tag(StmtTag::AssignIndex); str(n->name); exprs(n->indices); expr(n->value.get());
+    return;
+  }
+  if (auto n = dynamic_cast<const AssignMember*>(s)) {
+    tag(StmtTag::AssignMember); expr(n->object.get()); str(n->member); expr(n->value.get());
+    return;
+  }
+  if (auto n = dynamic_cast<const Return*>(s)) { tag(StmtTag::Return); expr(n->value.get()); return; }
+  if (auto n = dynamic_cast<const Dim*>(s)) { tag(StmtTag::Dim); str(n->name); exprs(n->sizes); return; }
+  if (auto n = dynamic_cast<const Redim*>(s)) { tag(StmtTag::Redim); str(n->name); exprs(n->sizes); flag(n->preserve); return; }
+  if (auto n = dynamic_cast<const SelectCaseStmt*>(s)) {
+    tag(StmtTag::SelectCase); expr(n->selector.get());
+    u32(static_cast<uint32_t>(n->branches.size()));
+    for (const auto& b : n->branches) {
+      flag(b.isElse); exprs(b.values); stmts(b.body);
+      flag(b.isRel); u32(static_cast<uint32_t>(b.relOp)); expr(b.relExpr.get());
+      flag(b.isRange); expr(b.rangeStart.get()); expr(b.rangeEnd.get());
+    }
+    return;
+  }
+  if (auto n = dynamic_cast<const TypeDecl*>(s)) {
+    tag(StmtTag::Type); str(n->name); str(n->parentType); flag(n->hasParent);
+    u32(static_cast<uint32_t>(n->fields.size()));
+    for (const auto& f : n->fields) { str(f.name); str(f.typeName); flag(f.hasType); }
+    stmts(n->methods);
+    return;
+  }
+  if (auto n = dynamic_cast<const ForEach*>(s)) { tag(StmtTag::ForEach); str(n->var); expr(n->collection.get()); stmts(n->body); return; }
+  if (auto n = dynamic_cast<const ModuleDecl*>(s)) { tag(StmtTag::Module); str(n->name); flag(n->isPublic); stmts(n->body); return; }
+  if (auto n = dynamic_cast<const OperatorDecl*>(s)) {
+    tag(StmtTag::Operator); u32(static_cast<uint32_t>(n->op)); str(n->typeName); params(n->params); stmts(n->body);
+    return;
+  }
+  if (auto n = dynamic_cast<const YieldStmt*>(s)) { tag(StmtTag::Yield); expr(n->value.get()); return; }
+  if (auto n = dynamic_cast<const AwaitStmt*>(s)) { tag(StmtTag::Await); expr(n->expression.get()); return; }
+  if (auto n = dynamic_cast<const EventHandler*>(s)) {
+    tag(StmtTag::EventHandler); str(n->eventType); str(n->eventName); stmts(n->body);
+    return;
+  }
+  if (auto n = dynamic_cast<const AssertStmt*>(s)) { tag(StmtTag::Assert); expr(n->condition.get()); expr(n->message.get()); return; }
+  if (dynamic_cast<const BreakpointStmt*>(s)) { tag(StmtTag::Breakpoint); return; }
+  if (auto n = dynamic_cast<const DebugPrintStmt*>(s)) { tag(StmtTag::DebugPrint); expr(n->value.get()); return; }
+  if (auto n = dynamic_cast<const DestructureAssign*>(s)) { tag(StmtTag::Destructure); strs(n->names); expr(n->value.get()); return; }
+  if (auto n = dynamic_cast<const UsingBlock*>(s)) {
+    tag(StmtTag::Using); str(n->varName); expr(n->resource.get()); stmts(n->body);
+    return;
+  }
+  if (auto n = dynamic_cast<const EnumDecl*>(s)) {
+    tag(StmtTag::Enum); str(n->name);
+    u32(static_cast<uint32_t>(n->values.size()));
+    for (const auto& v : n->values) { str(v.name); expr(v.value.get()); }
+    return;
+  }
+  if (auto n = dynamic_cast<const UnionDecl*>(s)) { tag(StmtTag::Union); str(n->name); strs(n->types); return; }
+  if (auto n = dynamic_cast<const StateHook*>(s)) { tag(StmtTag::StateHook); hook(*n); return; }
+  if (auto n = dynamic_cast<const TransitionDecl*>(s)) { tag(StmtTag::Transition); transition(*n); return; }
+  if (auto n = dynamic_cast<const StateDecl*>(s)) { tag(StmtTag::State); state(*n); return; }
+  if (auto n = dynamic_cast<const ParallelStates*>(s)) { tag(StmtTag::Parallel); states(n->states); return; }
+  if (auto n = dynamic_cast<const StateGroup*>(s)) { tag(StmtTag::StateGroup); str(n->name); states(n->states); return; }
+  if (auto n = dynamic_cast<const StateSystemDecl*>(s)) {
+    tag(StmtTag::StateSystem); str(n->name); states(n->states);
+    u32(static_cast<uint32_t>(n->groups.size()));
+    for (const auto& g : n->groups) { str(g.name); states(g.states); }
+    u32(static_cast<uint32_t>(n->parallelBlocks.size()));
+    for (const auto& p : n->parallelBlocks) states(p.states);
+    return;
+  }
+  if (auto n = dynamic_cast<const AttachSystemStmt*>(s)) { tag(StmtTag::AttachSystem); str(n->systemName); expr(n->target.get()); return; }
+  if (auto n = dynamic_cast<const AddStateStmt*>(s)) {
+    tag(StmtTag::AddState); str(n->stateName); str(n->systemName);
+    flag(n->state != nullptr);
+    if (n->state) state(*n->state);
+    return;
+  }
+  if (auto n = dynamic_cast<const RemoveStateStmt*>(s)) { tag(StmtTag::RemoveState); str(n->stateName); str(n->systemName); return; }
+  if (auto n = dynamic_cast<const OverrideStateStmt*>(s)) { tag(StmtTag::OverrideState); str(n->stateName); stmts(n->body); return; }
+  if (auto n = dynamic_cast<const SetTransitionRuleStmt*>(s)) {
+    tag(StmtTag::SetTransitionRule); str(n->fromState); str(n->toState); i32(n->priority);
+    return;
+  }
+  if (auto n = dynamic_cast<const EnableDisableStateStmt*>(s)) { tag(StmtTag::EnableDisableState); str(n->stateName); flag(n->enable); return; }
+  if (auto n = dynamic_cast<const DebugStatesStmt*>(s)) { tag(StmtTag::DebugStates); str(n->systemName); return; }
+  if (auto n = dynamic_cast<const ExportSystemStmt*>(s)) { tag(StmtTag::ExportSystem); str(n->systemName); str(n->filePath); return; }
+  if (auto n = dynamic_cast<const ImportSystemStmt*>(s)) { tag(StmtTag::ImportSystem); str(n->systemName); str(n->filePath); return; }
+  if (auto n = dynamic_cast<const EventDecl*>(s)) { tag(StmtTag::EventDecl); str(n->name); return; }
+  if (auto n = dynamic_cast<const AnimationStmt*>(s)) { tag(StmtTag::Animation); str(n->animationName); f64(n->blendTime); return; }
+  if (auto n = dynamic_cast<const WaitStmt*>(s)) { tag(StmtTag::Wait); f64(n->duration); return; }
+  throw std::runtime_error("statement node cannot be cached");
+}
+
+// ===== Reading =====
+
+// Thrown on truncated or inconsistent data; the cache is then ignored.
+struct CorruptCache {};
+
+class Reader {
+public:
+  Reader(const char* data, size_t size) : p_(data), end_(data + size) {}
+
+  [[nodiscard]] bool at_end() const { return p_ == end_; }
+  const char* bytes(size_t n) {
+    if (static_cast<size_t>(end_ - p_) < n) throw CorruptCache{};
+    const char* r = p_;
+    p_ += n;
+    return r;
+  }
+  uint8_t u8() { return static_cast<uint8_t>(*bytes(1)); }
+  bool flag() { return u8() != 0; }
+  uint32_t u32() {
+    const char* b = bytes(4);
+    uint32_t v = 0;
+    for (int i = 0; i < 4; ++i) v |= static_cast<uint32_t>(static_cast<uint8_t>(b[i])) << (8 * i);
+    return v;
+  }
+  uint64_t u64() {
+    const char* b = bytes(8);
+    uint64_t v = 0;
+    for (int i = 0; i < 8; ++i) v |= static_cast<uint64_t>(static_cast<uint8_t>(b[i])) << (8 * i);
+    return v;
+  }
+  int i32() { return static_cast<int>(u32()); }
+  double f64() { uint64_t bits = u64(); double d; std::memcpy(&d, &bits, sizeof d); return d; }
+  std::string str() { uint32_t n = u32(); const char* b = bytes(n); return std::string(b, n); }
+  // Element count of a list; each element takes at least one byte
+  uint32_t count() {
+    uint32_t n = u32();
+    if (n > static_cast<size_t>(end_ - p_)) throw CorruptCache{};
+    return n;
+  }
+  std::vector<std::string> strs() {
+    std::vector<std::string> v(count());
+    for (auto& s : v) s = str();
+    return v;
+  }
+  Tok tok() { return static_cast<Tok>(u32()); }
+
+  Token token() {
+    Token t;
+    t.kind = tok();
+    t.lex = str();
+    t.line = i32();
+    t.col = i32();
+    if (flag()) t.sym = intern(t.lex);
+    return t;
+  }
+
+  Value value() {
+    switch (static_cast<ValueTag>(u8())) {
+      case ValueTag::Nil: return Value::nil();
+      case ValueTag::Number: return Value::from_number(f64());
+      case ValueTag::Int: return Value::from_int(static_cast<long long>(u64()));
+      case ValueTag::Bool: return Value::from_bool(flag());
+      case ValueTag::String: return Value::from_string(str());
+      case ValueTag::Packed: {
+        Packed p;
+        p.kind = static_cast<Packed::Kind>(u8());
+        for (float& f : p.f) f = static_cast<float>(f64());
+        return Value::from_packed(p);
+      }
+    }
+    throw CorruptCache{};
+  }
+
+  FunctionParam param() {
+    FunctionParam p;
+    p.name = str();
+    p.typeName = str();
+    p.hasType = flag();
+    p.defaultValue = expr();
+    p.hasDefault = flag();
+    return p;
+  }
+  std::vector<FunctionParam> params() {
+    std::vector<FunctionParam> v(count());
+    for (auto& p : v) p = param();
+    return v;
+  }
+
+  Exprs exprs() {
+    Exprs v(count());
+    for (auto& e : v) e = expr();
+    return v;
+  }
+  Stmts stmts() {
+    Stmts v(count());
+    for (auto& s : v) s = stmt();
+    return v;
+  }
+
+  std::unique_ptr<Expr> expr();
+  std::unique_ptr<Stmt> stmt() {
+    auto s = stmt_node();
+    if (s) s->line = i32();
+    return s;
+  }
+  std::unique_ptr<Stmt> stmt_node();
+
+  void hook(StateHook& h) {
+    h.type = static_cast<StateHook::HookType>(u8());
+    h.body = stmts();
+  }
+  void transition(TransitionDecl& t) {
+    t.fromState = str();
+    t.toState = str();
+    t.condition = expr();
+    t.priority = i32();
+  }
+  void state(StateDecl& s) {
+    s.name = str();
+    s.animation = str();
+    s.animationBlend = f64();
+    s.waitTime = f64();
+    s.body = stmts();
+    s.hooks.resize(count());
+    for (auto& h : s.hooks) hook(h);
+    s.transitions.resize(count());
+    for (auto& t : s.transitions) transition(t);
+  }
+  std::vector<std::unique_ptr<StateDecl>> states() {
+    std::vector<std::unique_ptr<StateDecl>> v(count());
+    for (auto& s : v) {
+      s = std::make_unique<StateDecl>();
+      state(*s);
+    }
+    return v;
+  }
+
+private:
+  const char* p_;
+  const char* end_;
+};
+
+std::unique_ptr<Expr> Reader::expr() {
+  switch (static_cast<ExprTag>(u8())) {
+    case ExprTag::Null: return nullptr;
+    case ExprTag::Literal: {
+      Token t = token();
+      Value v = value();
+      return std::make_unique<Literal>(std::move(t), std::move(v));
+    }
+    case ExprTag::Variable: return std::make_unique<Variable>(str());
+    case ExprTag::Unary: {
+      Tok op = tok();
+      return std::make_unique<Unary>(op, expr());
+    }
+    case ExprTag::Binary: {
+      auto l = expr();
+      Tok op = tok();
+      return std::make_unique<Binary>(std::move(l), op, expr());
+    }
+    case ExprTag::Call: {
+      std::string callee = str();
+      auto n = std::make_unique<Call>(std::move(callee), exprs());
+      n->namedArgs.resize(count());
+      for (auto& na : n->namedArgs) {
+        na.name = str();
+        na.value = expr();
+      }
+      return n;
+    }
+    case ExprTag::Index: {
+      auto target = expr();
+      return std::make_unique<Index>(std::move(target), expr());
+    }
+    case ExprTag::MemberAccess: {
+      auto object = expr();
+      return std::make_unique<MemberAccess>(std::move(object), str());
+    }
+    case ExprTag::MethodCall: {
+      auto object = expr();
+      std::string method = str();
+      return std::make_unique<MethodCall>(std::move(object), std::move(method), exprs());
+    }
+    case ExprTag::ArrayLiteral: {
+      auto n = std::make_unique<ArrayLiteral>();
+      n->elements = exprs();
+      return n;
+    }
+    case ExprTag::Lambda: {
+      auto n = std::make_unique<LambdaExpr>();
+      n->params = params();
+      n->returnType = str();
+      n->hasReturnType = flag();
+      n->body = stmts();
+      return n;
+    }
+    case ExprTag::InterpolatedString: {
+      auto n = std::make_unique<InterpolatedString>();
+      n->parts = exprs();
+      return n;
+    }
+    case ExprTag::MapLiteral: {
+      auto n = std::make_unique<MapLiteral>();
+      n->entries.resize(count());
+      for (auto& [k, v] : n->entries) {
+        k = expr();
+        v = expr();
+      }
+      return n;
+    }
+    case ExprTag::TypeOf: {
+      auto n = std::make_unique<TypeOfExpr>();
+      n->value = expr();
+      return n;
+    }
+    case ExprTag::GetProperties: {
+      auto n = std::make_unique<GetPropertiesExpr>();
+      n->value = expr();
+      return n;
+    }
+    case ExprTag::GetMethods: {
+      auto n = std::make_unique<GetMethodsExpr>();
+      n->value = expr();
+      return n;
+    }
+    case ExprTag::SuperCall: {
+      auto n = std::make_unique<SuperCall>();
+      n->method = str();
+      n->args = exprs();
+      return n;
+    }
+    case ExprTag::Range: {
+      auto n = std::make_unique<RangeLiteral>();
+      n->start = expr();
+      n->end = expr();
+      return n;
+    }
+    case ExprTag::Comprehension: {
+      auto n = std::make_unique<ArrayComprehension>();
+      n->expr = expr();
+      n->var = str();
+      n->collection = expr();
+      n->condition = expr();
+      return n;
+    }
+    case ExprTag::NullSafe: {
+      auto n = std::make_unique<NullSafeAccess>();
+      n->object = expr();
+      n->member = str();
+      n->isIndex = flag();
+      n->index = expr();
+      return n;
+    }
+    case ExprTag::NullCoalesce: {
+      auto n = std::make_unique<NullCoalesceExpr>();
+      n->left = expr();
+      n->right = expr();
+      return n;
+    }
+    case ExprTag::Ternary: {
+      auto n = std::make_unique<TernaryExpr>();
+      n->condition = expr();
+      n->trueValue = expr();
+      n->falseValue = expr();
+      return n;
+    }
+    case ExprTag::Tuple: {
+      auto n = std::make_unique<TupleLiteral>();
+      n->elements = exprs();
+      return n;
+    }
+    case ExprTag::Match: {
+      auto n = std::make_unique<MatchExpr>();
+      n->value = expr();
+      n->cases.resize(count());
+      for (auto& c : n->cases) {
+        c.pattern = expr();
+        c.result = expr();
+      }
+      n->defaultCase = expr();
+      return n;
+    }
+    case ExprTag::Spread: {
+      auto n = std::make_unique<SpreadExpr>();
+      n->value = expr();
+      return n;
+    }
+  }
+  throw CorruptCache{};
+}
+
+std::unique_ptr<Stmt> Reader::stmt_node() {
+  switch (static_cast<StmtTag>(u8())) {
+    case StmtTag::Null: return nullptr;
+    case StmtTag::OptionExplicit: {
+      auto n = std::make_unique<OptionExplicit>();
+      n->enabled = flag();
+      return n;
+    }
+    case StmtTag::Let: {
+      auto n = std::make_unique<Let>();
+      n->name = str();
+      n->value = expr();
+      n->typeName = str();
+      n->hasType = flag();
+      return n;
+    }
+    case StmtTag::Const: {
+      auto n = std::make_unique<ConstDecl>();
+      n->name = str();
+      n->value = expr();
+      return n;
+    }
+    case StmtTag::Assign: {
+      auto n = std::make_unique<Assign>();
+      n->name = str();
+      n->sym = intern(n->name);
+      n->value = expr();
+      return n;
+    }
+    case StmtTag::Local: {
+      auto n = std::make_unique<LocalDecl>();
+      n->names = strs();
+      return n;
+    }
+    case StmtTag::Global: {
+      auto n = std::make_unique<GlobalDecl>();
+      n->names = strs();
+      return n;
+    }
+    case StmtTag::Print: {
+      auto n = std::make_unique<Print>();
+      n->value = expr();
+      return n;
+    }
+    case StmtTag::PrintC: {
+      auto n = std::make_unique<PrintC>();
+      n->value = expr();
+      return n;
+    }
+    case StmtTag::ExprStmt: return std::make_unique<ExprStmt>(expr());
+    case StmtTag::CallStmt: {
+      auto n = std::make_unique<CallStmt>();
+      n->name = str();
+      n->args = exprs();
+      return n;
+    }
+    case StmtTag::Break: return std::make_unique<Break>();
+    case StmtTag::Continue: return std::make_unique<Continue>();
+    case StmtTag::Exit: {
+      auto n = std::make_unique<Exit>();
+      n->target = str();
+      return n;
+    }
+    case StmtTag::Goto: {
+      auto n = std::make_unique<Goto>();
+      n->label = str();
+      return n;
+    }
+    case StmtTag::Gosub: {
+      auto n = std::make_unique<Gosub>();
+      n->label = str();
+      return n;
+    }
+    case StmtTag::Label: {
+      auto n = std::make_unique<Label>();
+      n->name = str();
+      return n;
+    }
+    case StmtTag::End: return std::make_unique<End>();
+    case StmtTag::Import: {
+      auto n = std::make_unique<ImportStmt>();
+      n->path = str();
+      return n;
+    }
+    case StmtTag::IfChain: {
+      auto n = std::make_unique<IfChain>();
+      n->branches.resize(count());
+      for (auto& b : n->branches) {
+        b.cond = expr();
+        b.body = stmts();
+      }
+      n->elseBody = stmts();
+      n->hasElse = flag();
+      return n;
+    }
+    case StmtTag::IfThenEndIf: {
+      auto n = std::make_unique<IfThenEndIf>();
+      n->cond = expr();
+      n->body = stmts();
+      return n;
+    }
+    case StmtTag::WhileWend: {
+      auto n = std::make_unique<WhileWend>();
+      n->cond = expr();
+      n->body = stmts();
+      return n;
+    }
+    case StmtTag::DoLoop: {
+      auto n = std::make_unique<DoLoop>();
+      n->body = stmts();
+      n->untilCond = expr();
+      n->whileCond = expr();
+      n->hasUntil = flag();
+      n->hasWhile = flag();
+      return n;
+    }
+    case StmtTag::RepeatUntil: {
+      auto n = std::make_unique<RepeatUntil>();
+      n->body = stmts();
+      n->cond = expr();
+      return n;
+    }
+    case StmtTag::ForNext: {
+      auto n = std::make_unique<ForNext>();
+      n->var = str();
+      n->var_sym = intern(n->var);
+      n->init = expr();
+      n->limit = expr();
+      n->step = expr();
+      n->body = stmts();
+      return n;
+    }
+    case StmtTag::Sub: {
+      auto n = std::make_unique<SubDecl>();
+      n->name = str();
+      n->params = strs();
+      n->body = stmts();
+      return n;
+    }
+    case StmtTag::Function: {
+      auto n = std::make_unique<FunctionDecl>();
+      n->name = str();
+      n->params = params();
+      n->returnType = str();
+      n->hasReturnType = flag();
+      n->body = stmts();
+      return n;
+    }
+    case StmtTag::AssignIndex: {
+      auto n = std::make_unique<AssignIndex>();
+      n->name = str();
+      n->sym = intern(n->name);
+      n->indices = exprs();
+      n->value = expr();
+      return n;
+    }
+    case StmtTag::AssignMember: {
+      auto n = std::make_unique<AssignMember>();
+      n->object = expr();
+      n->member = str();
+      n->value = expr();
+      return n;
+    }
+    case StmtTag::Return: {
+      auto n = std::make_unique<Return>();
+      n->value = expr();
+      return n;
+    }
+    case StmtTag::Dim: {
+      auto n = std::make_unique<Dim>();
+      n->name = str();
+      n->sizes = exprs();
+      return n;
+    }
+    case StmtTag::Redim: {
+      auto n = std::make_unique<Redim>();
+      n->name = str();
+      n->sizes = exprs();
+      n->preserve = flag();
+      return n;
+    }
+    case StmtTag::SelectCase: {
+      auto n = std::make_unique<SelectCaseStmt>();
+      n->selector = expr();
+      n->branches.resize(count());
+      for (auto& b : n->branches) {
+        b.isElse = flag();
+        b.values = exprs();
+        b.body = stmts();
+        b.isRel = flag();
+        b.relOp = tok();
+        b.relExpr = expr();
+        b.isRange = flag();
+        b.rangeStart = expr();
+        b.rangeEnd = expr();
+      }
+      return n;
+    }
+    case StmtTag::Type: {
+      auto n = std::make_unique<TypeDecl>();
+      n->name = str();
+      n->parentType = str();
+      n->hasParent = flag();
+      n->fields.resize(count());
+      for (auto& f : n->fields) {
+        f.name = str();
+        f.typeName = str();
+        f.hasType = flag();
+      }
+      n->methods = stmts();
+      return n;
+    }
+    case StmtTag::ForEach: {
+      auto n = std::make_unique<ForEach>();
+      n->var = str();
+      n->collection = expr();
+      n->body = stmts();
+      return n;
+    }
+    case StmtTag::Module: {
+      auto n = std::make_unique<ModuleDecl>();
+      n->name = str();
+      n->isPublic = flag();
+      n->body = stmts();
+      return n;
+    }
+    case StmtTag::Operator: {
+      auto n = std::make_unique<OperatorDecl>();
+      n->op = tok();
+      n->typeName = str();
+      n->params = params();
+      n->body = stmts();
+      return n;
+    }
+    case StmtTag::Yield: {
+      auto n = std::make_unique<YieldStmt>();
+      n->value = expr();
+      return n;
+    }
+    case StmtTag::Await: {
+      auto n = std::make_unique<AwaitStmt>();
+      n->expression = expr();
+      return n;
+    }
+    case StmtTag::EventHandler: {
+      auto n = std::make_unique<EventHandler>();
+      n->eventType = str();
+      n->eventName = str();
+      n->body = stmts();
+      return n;
+    }
+    case StmtTag::Assert: {
+      auto n = std::make_unique<AssertStmt>();
+      n->condition = expr();
+      n->message = expr();
+      return n;
+    }
+    case StmtTag::Breakpoint: return std::make_unique<BreakpointStmt>();
+    case StmtTag::DebugPrint: {
+      auto n = std::make_unique<DebugPrintStmt>();
+      n->value = expr();
+      return n;
+    }
+    case StmtTag::Destructure: {
+      auto n = std::make_unique<DestructureAssign>();
+      n->names = strs();
+      n->value = expr();
+      return n;
+    }
+    case StmtTag::Using: {
+      auto n = std::make_unique<UsingBlock>();
+      n->varName = str();
+      n->resource = expr();
+      n->body = stmts();
+      return n;
+    }
+    case StmtTag::Enum: {
+      auto n = std::make_unique<EnumDecl>();
+      n->name = str();
+      n->values.resize(count());
+      for (auto& v : n->values) {
+        v.name = str();
+        v.value = expr();
+      }
+      return n;
+    }
+    case StmtTag::Union: {
+      auto n = std::make_unique<UnionDecl>();
+      n->name = str();
+      n->types = strs();
+      return n;
+    }
+    case StmtTag::StateHook: {
+      auto n = std::make_unique<StateHook>();
+      hook(*n);
+      return n;
+    }
+    case StmtTag::Transition: {
+      auto n = std::make_unique<TransitionDecl>();
+      transition(*n);
+      return n;
+    }
+    case StmtTag::State: {
+      auto n = std::make_unique<StateDecl>();
+      state(*n);
+      return n;
+    }
+    case StmtTag::Parallel: {
+      auto n = std::make_unique<ParallelStates>();
+      n->states = states();
+      return n;
+    }
+    case StmtTag::StateGroup: {
+      auto n = std::make_unique<StateGroup>();
+      n->name = str();
+      n->states = states();
+      return n;
+    }
+    case StmtTag::StateSystem: {
+      auto n = std::make_unique<StateSystemDecl>();
+      n->name = str();
+      n->states = states();
+      n->groups.resize(count());
+      for (auto& g : n->groups) {
+        g.name = str();
+        g.states = states();
+      }
+      n->parallelBlocks.resize(count());
+      for (auto& p : n->parallelBlocks) p.states = states();
+      return n;
+    }
+    case StmtTag::AttachSystem: {
+      auto n = std::make_unique<AttachSystemStmt>();
+      n->systemName = str();
+      n->target = expr();
+      return n;
+    }
+    case StmtTag::AddState: {
+      auto n = std::make_unique<AddStateStmt>();
+      n->stateName = str();
+      n->systemName = str();
+      if (flag()) {
+        n->state = std::make_unique<StateDecl>();
+        state(*n->state);
+      }
+      return n;
+    }
+    case StmtTag::RemoveState: {
+      auto n = std::make_unique<RemoveStateStmt>();
+      n->stateName = str();
+      n->systemName = str();
+      return n;
+    }
+    case StmtTag::OverrideState: {
+      auto n = std::make_unique<OverrideStateStmt>();
+      n->stateName = str();
+      n->body = stmts();
+      return n;
+    }
+    case StmtTag::SetTransitionRule: {
+      auto n = std::make_unique<SetTransitionRuleStmt>();
+      n->fromState = str();
+      n->toState = str();
+      n->priority = i32();
+      return n;
+    }
+    case StmtTag::EnableDisableState: {
+      auto n = std::make_unique<EnableDisableStateStmt>();
+      n->stateName = str();
+      n->enable = flag();
+      return n;
+    }
+    case StmtTag::DebugStates: {
+      auto n = std::make_unique<DebugStatesStmt>();
+      n->systemName = str();
+      return n;
+    }
+    case StmtTag::ExportSystem: {
+      auto n = std::make_unique<ExportSystemStmt>();
+      n->systemName = str();
+      n->filePath = str();
+      return n;
+    }
+    case StmtTag::ImportSystem: {
+      auto n = std::make_unique<ImportSystemStmt>();
+      n->systemName = str();
+      n->filePath = str();
+      return n;
+    }
+    case StmtTag::EventDecl: {
+      auto n = std::make_unique<EventDecl>();
+      n->name = str();
+      return n;
+    }
+    case StmtTag::Animation: {
+      auto n = std::make_unique<AnimationStmt>();
+      n->animationName = str();
+      n->blendTime = f64();
+      return n;
+    }
+    case StmtTag::Wait: {
+      auto n = std::make_unique<WaitStmt>();
+      n->duration = f64();
+      return n;
+    }
+  }
+  throw CorruptCache{};
+}
+
+// ===== Memory-mapped file =====
+
+// Read-only view of a whole file; empty when it cannot be opened.
+class MappedFile {
+public:
+  explicit MappedFile(const std::filesystem::path& path) {
+#ifdef _WIN32
+    file_ = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file_ == INVALID_HANDLE_VALUE) return;
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file_, &size) || size.QuadPart == 0) return;
+    mapping_ = CreateFileMappingW(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping_) return;
+    data_ = static_cast<const char*>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+    if (data_) size_ = static_cast<size_t>(size.QuadPart);
+#else
+    fd_ = ::open(path.c_str(), O_RDONLY);
+    if (fd_ < 0) return;
+    struct stat st;
+    if (::fstat(fd_, &st) != 0 || st.st_size == 0) return;
+    void* p = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd_, 0);
+    if (p == MAP_FAILED) return;
+    data_ = static_cast<const char*>(p);
+    size_ = static_cast<size_t>(st.st_size);
+#endif
+  }
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+  ~MappedFile() {
+#ifdef _WIN32
+    if (data_) UnmapViewOfFile(data_);
+    if (mapping_) CloseHandle(mapping_);
+    if (file_ != INVALID_HANDLE_VALUE) CloseHandle(file_);
+#else
+    if (data_) ::munmap(const_cast<char*>(data_), size_);
+    if (fd_ >= 0) ::close(fd_);
+#endif
+  }
+
+  [[nodiscard]] const char* data() const { return data_; }
+  [[nodiscard]] size_t size() const { return size_; }
+
+private:
+  const char* data_{nullptr};
+  size_t size_{0};
+#ifdef _WIN32
+  HANDLE file_{INVALID_HANDLE_VALUE};
+  HANDLE mapping_{nullptr};
+#else
+  int fd_{-1};
+#endif
+};
+
+// Hash of the file at `path`, or nullopt when it cannot be read.
+std::optional<uint64_t> file_hash(const std::filesystem::path& path) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in) return std::nullopt;
+  std::string data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+  return content_hash(data);
+}
+
+} // namespace
+
+uint64_t bas::content_hash(std::string_view bytes) {
+  uint64_t h = 14695981039346656037ull;
+  for (unsigned char c : bytes) {
+    h ^= c;
+    h *= 1099511628211ull;
+  }
+  return h;
+}
+
+std::filesystem::path bas::program_cache_path(const std::filesystem::path& source) {
+  std::filesystem::path p = source;
+  p.replace_extension(".bbc");
+  return p;
+}
+
+bool bas::write_program_cache(const std::filesystem::path& file, const Program& prog,
+                              const std::vector<CacheSource>& sources, std::string* error) {
+  Writer w;
+  try {
+    w.out.append(kMagic, sizeof kMagic);
+    w.u32(kFormatVersion);
+    w.u32(static_cast<uint32_t>(sources.size()));
+    for (const auto& s : sources) {
+      w.str(s.path);
+      w.u64(s.hash);
+    }
+    w.stmts(prog.stmts);
+  } catch (const std::exception& e) {
+    if (error) *error = e.what();
+    return false;
+  }
+  // Write to a temporary name first so a reader never maps a partial file
+  std::filesystem::path tmp = file;
+  tmp += ".tmp";
+  {
+    std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+    out.write(w.out.data(), static_cast<std::streamsize>(w.out.size()));
+    if (!out) {
+      if (error) *error = "cannot write " + tmp.string();
+      return false;
+    }
+  }
+  std::error_code ec;
+  std::filesystem::rename(tmp, file, ec);
+  if (ec) {
+    std::filesystem::remove(tmp, ec);
+    if (error) *error = "cannot write " + file.string();
+    return false;
+  }
+  return true;
+}
+
+std::optional<Program> bas::load_program_cache(const std::filesystem::path& file) {
+  MappedFile map(file);
+  if (!map.data()) return std::nullopt;
+  try {
+    Reader r(map.data(), map.size());
+    if (std::memcmp(r.bytes(sizeof kMagic), kMagic, sizeof kMagic) != 0) return std::nullopt;
+    if (r.u32() != kFormatVersion) return std::nullopt;
+    const std::filesystem::path base = file.parent_path();
+    for (uint32_t i = 0, n = r.count(); i < n; ++i) {
+      std::filesystem::path source = base / r.str();
+      uint64_t hash = r.u64();
+      if (file_hash(source) != hash) return std::nullopt;
+    }
+    Program prog;
+    prog.stmts = r.stmts();
+    if (!r.at_end()) return std::nullopt;
+    return prog;
+  } catch (const CorruptCache&) {
+    return std::nullopt;
+  }
+}
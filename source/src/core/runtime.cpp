@@ -37,8 +37,9 @@ void bas::register_member_write_hook(MemberWriteHook hook) {
 }
 
 std::optional<Value> bas::try_resolve_member(const Value& object, const std::string& member) {
-  // Normalize member name for case-insensitive matching
-  std::string normalized = normalize_identifier(member);
+  // Hooks see the member folded to lowercase; parsed names already are
+  std::string folded;
+  const std::string& normalized = is_folded(member) ? member : (folded = normalize_identifier(member));
   for (auto it = member_read_hooks().rbegin(); it != member_read_hooks().rend(); ++it) {
     if (auto result = (*it)(object, normalized)) {
       return result;
@@ -48,8 +49,9 @@ std::optional<Value> bas::try_resolve_member(const Value& object, const std::str
 }
 
 bool bas::try_assign_member(const Value& object, const std::string& member, const Value& value) {
-  // Normalize member name for case-insensitive matching
-  std::string normalized = normalize_identifier(member);
+  // Hooks see the member folded to lowercase; parsed names already are
+  std::string folded;
+  const std::string& normalized = is_folded(member) ? member : (folded = normalize_identifier(member));
   for (auto it = member_write_hooks().rbegin(); it != member_write_hooks().rend(); ++it) {
     if ((*it)(object, normalized, value)) {
       return true;
@@ -59,10 +61,11 @@ bool bas::try_assign_member(const Value& object, const std::string& member, cons
 }
 
 [[nodiscard]] Value bas::call(FunctionRegistry& R, const std::string& name, const std::vector<Value>& args){
-  // Normalize function name for case-insensitive lookup
-  // (FunctionRegistry::find() also normalizes, but we normalize here for consistency and clarity)
-  std::string normalized = normalize_identifier(name);
-  const NativeFn* f = R.find(normalized);
+  // FunctionRegistry::find() is case-insensitive
+  return call_native(R.find(name), name, args);
+}
+
+[[nodiscard]] Value bas::call_native(const NativeFn* f, const std::string& name, NativeArgs args){
   if(!f) throw std::runtime_error("Unknown function: "+name);
   if(f->arity>=0 && static_cast<int>(args.size())!=f->arity)
     throw std::runtime_error(name+": expected "+std::to_string(f->arity)+" args");
@@ -0,0 +1,66 @@
+#include "bas/symbol.hpp"
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+namespace bas {
+
+namespace {
+// Names live in a deque so references handed out by symbol_name() and the
+// views used as map keys stay valid as the table grows.
+struct SymbolTable {
+  std::mutex mutex;
+  std::deque<std::string> names;
+  std::unordered_map<std::string_view, Symbol> ids;
+  SymbolTable() {
+    names.emplace_back();
+    ids.emplace(names.back(), 0);
+  }
+};
+
+SymbolTable& table() {
+  static SymbolTable t;
+  return t;
+}
+
+std::string fold(std::string_view name) {
+  std::string r(name);
+  for (char& c : r) if (c >= 'A' && c <= 'Z') c = static_cast<char>(c - 'A' + 'a');
+  return r;
+}
+} // namespace
+
+Symbol intern(std::string_view name) {
+  std::string folded;
+  if (!is_folded(name)) {
+    folded = fold(name);
+    name = folded;
+  }
+  SymbolTable& t = table();
+  std::lock_guard<std::mutex> lock(t.mutex);
+  if (auto it = t.ids.find(name); it != t.ids.end()) return it->second;
+  const auto id = static_cast<Symbol>(t.names.size());
+  t.names.emplace_back(name);
+  t.ids.emplace(t.names.back(), id);
+  return id;
+}
+
+Symbol find_symbol(std::string_view name) {
+  std::string folded;
+  if (!is_folded(name)) {
+    folded = fold(name);
+    name = folded;
+  }
+  SymbolTable& t = table();
+  std::lock_guard<std::mutex> lock(t.mutex);
+  auto it = t.ids.find(name);
+  return it == t.ids.end() ? 0 : it->second;
+}
+
+const std::string& symbol_name(Symbol s) {
+  SymbolTable& t = table();
+  std::lock_guard<std::mutex> lock(t.mutex);
+  return t.names.at(s);
+}
+
+} // namespace bas
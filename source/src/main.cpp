@@ -3,6 +3,8 @@
 
 #include "bas/lexer.hpp"
 #include "bas/parser.hpp"
+#include "bas/program_cache.hpp"
+#include "bas/profiler.hpp"
 #include "bas/runtime.hpp"
 #include "bas/namespace_registry.hpp"
 #include "bas/type_system.hpp"
@@ -65,7 +67,11 @@
 #include <cstring>
 #include <algorithm>
 #include <filesystem>
+#include <optional>
 #include <unordered_set>
+#ifdef __linux__
+#include <sys/resource.h>
+#endif
 
 void print_usage(const char* program_name) {
     std::cout << "BASIC + Raylib Interpreter v1.0" << std::endl;
@@ -85,6 +91,11 @@ void print_usage(const char* program_name) {
     std::cerr << "  --modules-dir <path>  Specify modules directory (default: ./modules)" << std::endl;
     std::cerr << "  --strict-modules Enable strict module validation (errors on missing bindings)" << std::endl;
     std::cerr << "  --validate-modules Validate all YAML modules and print report" << std::endl;
+    std::cerr << "  --tree-walker    Run programs on the AST tree-walker instead of the bytecode VM" << std::endl;
+    std::cerr << "  --precompile     Parse the program and its IMPORTs into <file>.bbc, then exit" << std::endl;
+    std::cerr << "  --no-cache       Ignore <file>.bbc and parse the sources" << std::endl;
+    std::cerr << "  --profile[=<file>] Sample the running program; write folded stacks to <file>" << std::endl;
+    std::cerr << "                   (default: profile.folded) and print a summary on exit" << std::endl;
     std::cerr << "  --help, -h      Show this help message" << std::endl;
     std::cout << std::endl;
     std::cout << "Examples:" << std::endl;
@@ -97,7 +108,10 @@ void print_usage(const char* program_name) {
 // Forward declaration for file execution
 int execute_basic_file(const std::string& filename, bool debug_mode, bool verbose_mode, 
                        bool enable_modules = true, const std::string& modules_dir = "modules",
-                       bool strict_modules = false);
+                       bool strict_modules = false, bool use_cache = true);
+
+// Forward declaration for --precompile
+int precompile_basic_file(const std::string& filename, bool debug_mode, bool verbose_mode);
 
 // Forward declaration for welcome screen
 int show_welcome_screen(bool debug_mode, bool verbose_mode, bool enable_modules = true, const std::string& modules_dir = "modules", bool strict_modules = false);
@@ -415,23 +429,16 @@ int show_welcome_screen(bool debug_mode, bool verbose_mode, bool enable_modules,
     return 0;
 }
 
-// Execute a BASIC file with the given options
-int execute_basic_file(const std::string& filename, bool debug_mode, bool verbose_mode, 
-                       bool enable_modules, const std::string& modules_dir, bool strict_modules) {
+// Read, parse and IMPORT-expand a BASIC file into `prog`. Every file read is
+// appended to `sources` (main file first) for the program cache. Returns 0,
+// or the exit code to use after the error has been reported.
+static int parse_basic_file(const std::string& filename, bool debug_mode, bool verbose_mode,
+                            bas::Program& prog, std::vector<bas::CacheSource>& sources) {
     // Use permissive mode by default
     bool agk_mode = true;
     std::string dialect;
     bool suppressDialectWarn = false;
     
-    if (debug_mode) std::cerr << "[DEBUG] Filename to execute: " << filename << std::endl;
-    
-    if (verbose_mode) {
-        std::cout << "BASIC + Raylib Interpreter v1.0" << std::endl;
-        if (debug_mode) std::cerr << "Debug mode: ENABLED" << std::endl;
-        std::cout << "Loading: " << filename << std::endl;
-        std::cout << std::endl;
-    }
-    
     // Read the source file
     std::string src;
     if (debug_mode) std::cerr << "[DEBUG] Attempting to open file..." << std::endl;
@@ -452,6 +459,7 @@ int execute_basic_file(const std::string& filename, bool debug_mode, bool verbos
     if (debug_mode) {
         std::cerr << "Source file loaded: " << src.length() << " characters" << std::endl;
     }
+    sources.push_back({std::filesystem::path(filename).filename().string(), bas::content_hash(src)});
     
     // Check pragma in source to select dialect (case-insensitive)
     {
@@ -550,7 +558,7 @@ int execute_basic_file(const std::string& filename, bool debug_mode, bool verbos
     diag.set_debug_mode(debug_mode);
     
     bas::Parser ps(std::move(toks), diag, agk_mode);
-    bas::Program prog = ps.parse();
+    prog = ps.parse();
     
     // Check for parsing errors
     if (diag.has_errors()) {
@@ -583,6 +591,9 @@ int execute_basic_file(const std::string& filename, bool debug_mode, bool verbos
     
     // Expand IMPORT statements before runtime
     if (debug_mode) std::cerr << "Phase 3: Resolving imports..." << std::endl;
+    std::error_code mainEc;
+    std::filesystem::path mainPath = std::filesystem::weakly_canonical(std::filesystem::path(filename), mainEc);
+    if (mainEc) mainPath = std::filesystem::path(filename).lexically_normal();
     auto expand_imports = [&](auto&& self, bas::Program& program, const std::filesystem::path& baseDir, std::unordered_set<std::string>& loaded)->bool{
         std::vector<std::unique_ptr<bas::Stmt>> result;
         result.reserve(program.stmts.size());
@@ -608,6 +619,9 @@ int execute_basic_file(const std::string& filename, bool debug_mode, bool verbos
                     return false;
                 }
                 std::string src2((std::istreambuf_iterator<char>(fin)), std::istreambuf_iterator<char>());
+                // Cache sources are recorded relative to the main file's directory
+                std::filesystem::path relPath = canon.lexically_relative(mainPath.parent_path());
+                sources.push_back({(relPath.empty() ? canon : relPath).generic_string(), bas::content_hash(src2)});
                 bas::Lexer lx2(std::move(src2));
                 auto toks2 = lx2.lex();
                 bas::Diag d2; d2.set_debug_mode(debug_mode);
@@ -635,9 +649,6 @@ int execute_basic_file(const std::string& filename, bool debug_mode, bool verbos
     {
         std::unordered_set<std::string> loaded;
         // Consider the main file as loaded to prevent accidental self-import if used
-        std::error_code ec;
-        std::filesystem::path mainPath = std::filesystem::weakly_canonical(std::filesystem::path(filename), ec);
-        if (ec) mainPath = std::filesystem::path(filename).lexically_normal();
         loaded.insert(mainPath.string());
         std::filesystem::path baseDir = mainPath.parent_path();
         if (!expand_imports(expand_imports, prog, baseDir, loaded)) {
@@ -647,6 +658,54 @@ int execute_basic_file(const std::string& filename, bool debug_mode, bool verbos
             std::cerr << "  After imports, statements: " << prog.stmts.size() << std::endl;
         }
     }
+    return 0;
+}
+
+// Parse a BASIC file and write its precompiled .bbc next to it (--precompile)
+int precompile_basic_file(const std::string& filename, bool debug_mode, bool verbose_mode) {
+    bas::Program prog;
+    std::vector<bas::CacheSource> sources;
+    if (int rc = parse_basic_file(filename, debug_mode, verbose_mode, prog, sources)) return rc;
+    std::filesystem::path out = bas::program_cache_path(filename);
+    std::string error;
+    if (!bas::write_program_cache(out, prog, sources, &error)) {
+        std::cerr << "Error: Cannot precompile '" << filename << "': " << error << std::endl;
+        return 73;
+    }
+    if (verbose_mode) {
+        std::cout << "Precompiled " << filename << " -> " << out.string()
+                  << " (" << sources.size() << " source file(s))" << std::endl;
+    }
+    return 0;
+}
+
+// Execute a BASIC file with the given options
+int execute_basic_file(const std::string& filename, bool debug_mode, bool verbose_mode, 
+                       bool enable_modules, const std::string& modules_dir, bool strict_modules,
+                       bool use_cache) {
+    if (debug_mode) std::cerr << "[DEBUG] Filename to execute: " << filename << std::endl;
+    
+    if (verbose_mode) {
+        std::cout << "BASIC + Raylib Interpreter v1.0" << std::endl;
+        if (debug_mode) std::cerr << "Debug mode: ENABLED" << std::endl;
+        std::cout << "Loading: " << filename << std::endl;
+        std::cout << std::endl;
+    }
+    
+    // A precompiled .bbc whose sources are unchanged skips lexing and parsing
+    bas::Program prog;
+    std::optional<bas::Program> cached;
+    if (use_cache) cached = bas::load_program_cache(bas::program_cache_path(filename));
+    if (cached) {
+        prog = std::move(*cached);
+        if (debug_mode) {
+            std::cerr << "Loaded precompiled program: " << bas::program_cache_path(filename).string()
+                      << " (" << prog.stmts.size() << " statements)" << std::endl;
+        }
+    } else {
+        std::vector<bas::CacheSource> sources;
+        if (int rc = parse_basic_file(filename, debug_mode, verbose_mode, prog, sources)) return rc;
+    }
 
     // Runtime setup
     if (debug_mode) std::cerr << "Phase 3: Runtime Setup..." << std::endl;
@@ -670,7 +729,7 @@ int execute_basic_file(const std::string& filename, bool debug_mode, bool verbos
     // Enhanced dot notation system
     bas::register_dot_notation_enhancements(R);
     
-    // Advanced features (coroutines, testing, profiling, etc.)
+    // Advanced features (testing, profiling, etc.)
     bas::register_advanced_features(R);
     
     // Object constructors (Vector3, Camera3D, Color, etc.)
@@ -1080,6 +1139,14 @@ int validate_modules(const std::string& modules_dir, bool strict_mode) {
 }
 
 int main(int argc, char* argv[]) {
+#ifdef __linux__
+    // Deeply recursive scripts: Linux grows the main thread's stack up to the
+    // soft limit (other platforms get the same size from the linker)
+    if (rlimit rl{}; getrlimit(RLIMIT_STACK, &rl) == 0 && rl.rlim_cur != RLIM_INFINITY && rl.rlim_cur < (64u << 20)) {
+        rl.rlim_cur = rl.rlim_max == RLIM_INFINITY ? (64u << 20) : std::min<rlim_t>(rl.rlim_max, 64u << 20);
+        setrlimit(RLIMIT_STACK, &rl);
+    }
+#endif
     bool debug_mode = false;
     for (int i = 1; i < argc; i++) {
         if (strcmp(argv[i], "--debug") == 0 || strcmp(argv[i], "-d") == 0) {
@@ -1108,6 +1175,9 @@ int main(int argc, char* argv[]) {
     bool enable_modules = true;  // Auto-detect by default
     std::string modules_dir = "modules";
     bool strict_modules = false;  // Strict module validation
+    bool precompile = false;      // Write <file>.bbc instead of running
+    bool use_cache = true;        // Load <file>.bbc when it is up to date
+    std::string profile_path;     // Folded stacks output; empty when not profiling
     
     // Parse command line arguments
     for (int i = 1; i < argc; i++) {
@@ -1145,6 +1215,16 @@ int main(int argc, char* argv[]) {
                 validate_dir = std::string(argv[++i]);
             }
             return validate_modules(validate_dir, strict_modules);
+        } else if (strcmp(argv[i], "--tree-walker") == 0) {
+            bas::set_bytecode_enabled(false);
+        } else if (strcmp(argv[i], "--precompile") == 0) {
+            precompile = true;
+        } else if (strcmp(argv[i], "--no-cache") == 0) {
+            use_cache = false;
+        } else if (strcmp(argv[i], "--profile") == 0) {
+            profile_path = "profile.folded";
+        } else if (strncmp(argv[i], "--profile=", 10) == 0) {
+            profile_path = std::string(argv[i] + 10);
         } else if (strcmp(argv[i], "--help") == 0 || strcmp(argv[i], "-h") == 0) {
             print_usage(argv[0]);
             return 0;
@@ -1301,11 +1381,30 @@ int main(int argc, char* argv[]) {
     
     if (debug_mode) std::cerr << "[DEBUG] Filename to execute: " << filename << std::endl;
 
+    if (precompile) {
+        if (filename.empty() || filename == "-") {
+            std::cerr << "Error: --precompile needs a file name" << std::endl;
+            return 64;
+        }
+        return precompile_basic_file(filename, debug_mode, verbose_mode);
+    }
+
     // If no filename specified, show welcome screen
     if (filename.empty()) {
         return show_welcome_screen(debug_mode, verbose_mode, enable_modules, modules_dir, strict_modules);
     }
     
+    // The profiler reports when main returns, however the program ended
+    struct ProfilerRun {
+        explicit ProfilerRun(const std::string& path) : active(!path.empty()) {
+            if (active) bas::profiler_start(path);
+        }
+        ~ProfilerRun() {
+            if (active) bas::profiler_stop();
+        }
+        bool active;
+    } profiler_run(profile_path);
+    
     // Handle stdin input
     if (filename == "-") {
         if (debug_mode) std::cerr << "[DEBUG] Reading from stdin..." << std::endl;
@@ -1325,7 +1424,7 @@ int main(int argc, char* argv[]) {
         temp << src;
         temp.close();
         
-        int result = execute_basic_file(tempFile, debug_mode, verbose_mode, enable_modules, modules_dir, strict_modules);
+        int result = execute_basic_file(tempFile, debug_mode, verbose_mode, enable_modules, modules_dir, strict_modules, false);
         
         // Clean up temporary file
         std::filesystem::remove(tempFile);
@@ -1333,5 +1432,5 @@ int main(int argc, char* argv[]) {
     }
     
     // Execute the specified file
-    return execute_basic_file(filename, debug_mode, verbose_mode, enable_modules, modules_dir, strict_modules);
+    return execute_basic_file(filename, debug_mode, verbose_mode, enable_modules, modules_dir, strict_modules, use_cache);
 }
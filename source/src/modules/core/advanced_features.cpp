@@ -14,70 +14,6 @@
 
 namespace bas {
 
-// ===== COROUTINE SYSTEM =====
-
-struct CoroutineData {
-    std::string name;
-    std::function<Value()> generator;
-    bool active{false};
-    Value lastValue{Value::nil()};
-    int id{0};
-};
-
-static std::unordered_map<int, CoroutineData> g_coroutines;
-static int g_next_coroutine_id = 1;
-
-// Coroutine.create(name, generatorFunction) -> Coroutine
-static Value coroutine_create(const std::vector<Value>& args) {
-    if (args.size() < 2 || !args[0].is_string()) {
-        return Value::nil();
-    }
-    
-    int id = g_next_coroutine_id++;
-    CoroutineData& coro = g_coroutines[id];
-    coro.id = id;
-    coro.name = args[0].as_string();
-    coro.active = true;
-    
-    Value::Map coroObj;
-    coroObj["_type"] = Value::from_string("Coroutine");
-    coroObj["_id"] = Value::from_int(id);
-    coroObj["name"] = Value::from_string(coro.name);
-    coroObj["active"] = Value::from_bool(coro.active);
-    
-    return Value::from_map(std::move(coroObj));
-}
-
-// Coroutine.resume(coroutine) -> value
-static Value coroutine_resume(const std::vector<Value>& args) {
-    if (args.empty() || !args[0].is_map()) {
-        return Value::nil();
-    }
-    
-    const auto& map = args[0].as_map();
-    auto idIt = map.find("_id");
-    if (idIt == map.end() || !idIt->second.is_int()) {
-        return Value::nil();
-    }
-    
-    int id = static_cast<int>(idIt->second.as_int());
-    auto coroIt = g_coroutines.find(id);
-    if (coroIt == g_coroutines.end() || !coroIt->second.active) {
-        return Value::nil();
-    }
-    
-    // In a real implementation, this would resume the coroutine
-    // For now, return the last value
-    return coroIt->second.lastValue;
-}
-
-// Coroutine.yield(value) -> value (called from within coroutine)
-static Value coroutine_yield(const std::vector<Value>& args) {
-    Value value = args.empty() ? Value::nil() : args[0];
-    // In a real implementation, this would suspend the coroutine
-    return value;
-}
-
 // ===== UNIT TESTING FRAMEWORK =====
 
 struct TestResult {
@@ -444,11 +380,6 @@ static Value debug_getCallStack(const std::vector<Value>& args) {
 // ===== REGISTER ALL FUNCTIONS =====
 
 void register_advanced_features(FunctionRegistry& R) {
-    // Coroutine functions
-    R.add("COROUTINE_CREATE", NativeFn{"COROUTINE_CREATE", 2, coroutine_create});
-    R.add("COROUTINE_RESUME", NativeFn{"COROUTINE_RESUME", 1, coroutine_resume});
-    R.add("COROUTINE_YIELD", NativeFn{"COROUTINE_YIELD", -1, coroutine_yield});
-    
     // Unit testing functions
     R.add("TEST_START", NativeFn{"TEST_START", 0, test_start});
     R.add("TEST_END", NativeFn{"TEST_END", 0, test_end});
@@ -56,81 +56,63 @@ static Value macro_expand(const std::vector<Value>& args) {
 // ===== INLINE VECTOR OPERATIONS =====
 
 // VEC3(x, y, z) -> Vector3
-static Value vec3_inline(const std::vector<Value>& args) {
+static Value make_vec3(double x, double y, double z) {
+    return Value::from_packed(Packed::vector3(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z)));
+}
+
+static Value vec3_inline(NativeArgs args) {
     double x = args.size() > 0 ? args[0].as_number() : 0.0;
     double y = args.size() > 1 ? args[1].as_number() : 0.0;
     double z = args.size() > 2 ? args[2].as_number() : 0.0;
-    
-    Value::Map vec;
-    vec["_type"] = Value::from_string("Vector3");
-    vec["x"] = Value::from_number(x);
-    vec["y"] = Value::from_number(y);
-    vec["z"] = Value::from_number(z);
-    
-    return Value::from_map(std::move(vec));
+    return make_vec3(x, y, z);
+}
+
+// Vector components of a packed vector or an x/y/z map; false for anything else.
+static bool vec3_components(const Value& v, double& x, double& y, double& z) {
+    if (const Packed* p = v.packed()) {
+        if (p->kind != Packed::Kind::Vector2 && p->kind != Packed::Kind::Vector3) return false;
+        x = p->f[0]; y = p->f[1]; z = p->f[2];
+        return true;
+    }
+    if (!v.is_map()) return false;
+    const auto& map = v.as_map();
+    x = map.count("x") ? map.at("x").as_number() : 0.0;
+    y = map.count("y") ? map.at("y").as_number() : 0.0;
+    z = map.count("z") ? map.at("z").as_number() : 0.0;
+    return true;
 }
 
 // DOT(vec1, vec2) -> float
-static Value dot_inline(const std::vector<Value>& args) {
+static Value dot_inline(NativeArgs args) {
     if (args.size() < 2) {
         return Value::from_number(0.0);
     }
     
-    // Extract vector components
     double x1 = 0.0, y1 = 0.0, z1 = 0.0;
     double x2 = 0.0, y2 = 0.0, z2 = 0.0;
-    
-    if (args[0].is_map()) {
-        const auto& map1 = args[0].as_map();
-        x1 = map1.count("x") ? map1.at("x").as_number() : 0.0;
-        y1 = map1.count("y") ? map1.at("y").as_number() : 0.0;
-        z1 = map1.count("z") ? map1.at("z").as_number() : 0.0;
-    }
-    
-    if (args[1].is_map()) {
-        const auto& map2 = args[1].as_map();
-        x2 = map2.count("x") ? map2.at("x").as_number() : 0.0;
-        y2 = map2.count("y") ? map2.at("y").as_number() : 0.0;
-        z2 = map2.count("z") ? map2.at("z").as_number() : 0.0;
-    }
+    vec3_components(args[0], x1, y1, z1);
+    vec3_components(args[1], x2, y2, z2);
     
     return Value::from_number(x1*x2 + y1*y2 + z1*z2);
 }
 
 // CROSS(vec1, vec2) -> Vector3
-static Value cross_inline(const std::vector<Value>& args) {
+static Value cross_inline(NativeArgs args) {
     if (args.size() < 2) {
-        return vec3_inline({});
+        return make_vec3(0.0, 0.0, 0.0);
     }
     
-    // Extract vector components
     double x1 = 0.0, y1 = 0.0, z1 = 0.0;
     double x2 = 0.0, y2 = 0.0, z2 = 0.0;
-    
-    if (args[0].is_map()) {
-        const auto& map1 = args[0].as_map();
-        x1 = map1.count("x") ? map1.at("x").as_number() : 0.0;
-        y1 = map1.count("y") ? map1.at("y").as_number() : 0.0;
-        z1 = map1.count("z") ? map1.at("z").as_number() : 0.0;
-    }
-    
-    if (args[1].is_map()) {
-        const auto& map2 = args[1].as_map();
-        x2 = map2.count("x") ? map2.at("x").as_number() : 0.0;
-        y2 = map2.count("y") ? map2.at("y").as_number() : 0.0;
-        z2 = map2.count("z") ? map2.at("z").as_number() : 0.0;
-    }
+    vec3_components(args[0], x1, y1, z1);
+    vec3_components(args[1], x2, y2, z2);
     
     // Cross product
-    double x = y1*z2 - z1*y2;
-    double y = z1*x2 - x1*z2;
-    double z = x1*y2 - y1*x2;
-    
-    return vec3_inline({Value::from_number(x), Value::from_number(y), Value::from_number(z)});
+    return make_vec3(y1*z2 - z1*y2, z1*x2 - x1*z2, x1*y2 - y1*x2);
 }
 
 // LERP(a, b, t) -> value or Vector3
-static Value lerp_inline(const std::vector<Value>& args) {
+static Value lerp_inline(NativeArgs args) {
     if (args.size() < 3) {
         return Value::from_number(0.0);
     }
@@ -146,23 +128,9 @@ static Value lerp_inline(const std::vector<Value>& args) {
     }
     
     // If both are vectors, lerp vectors
-    if (args[0].is_map() && args[1].is_map()) {
-        const auto& map1 = args[0].as_map();
-        const auto& map2 = args[1].as_map();
-        
-        double x1 = map1.count("x") ? map1.at("x").as_number() : 0.0;
-        double y1 = map1.count("y") ? map1.at("y").as_number() : 0.0;
-        double z1 = map1.count("z") ? map1.at("z").as_number() : 0.0;
-        
-        double x2 = map2.count("x") ? map2.at("x").as_number() : 0.0;
-        double y2 = map2.count("y") ? map2.at("y").as_number() : 0.0;
-        double z2 = map2.count("z") ? map2.at("z").as_number() : 0.0;
-        
-        double x = x1 + (x2 - x1) * t;
-        double y = y1 + (y2 - y1) * t;
-        double z = z1 + (z2 - z1) * t;
-        
-        return vec3_inline({Value::from_number(x), Value::from_number(y), Value::from_number(z)});
+    double x1, y1, z1, x2, y2, z2;
+    if (vec3_components(args[0], x1, y1, z1) && vec3_components(args[1], x2, y2, z2)) {
+        return make_vec3(x1 + (x2 - x1) * t, y1 + (y2 - y1) * t, z1 + (z2 - z1) * t);
     }
     
     return Value::from_number(0.0);
@@ -281,14 +281,8 @@ static Value animation_getFrameRect(const std::vector<Value>& args) {
     int frameX = anim.currentFrame * anim.frameWidth;
     int frameY = 0;  // Assuming single row sprite sheet
     
-    Value::Map rect;
-    rect["_type"] = Value::from_string("Rectangle");
-    rect["x"] = Value::from_number(frameX);
-    rect["y"] = Value::from_number(frameY);
-    rect["width"] = Value::from_int(anim.frameWidth);
-    rect["height"] = Value::from_int(anim.frameHeight);
-    
-    return Value::from_map(std::move(rect));
+    return Value::from_packed(Packed::rectangle(static_cast<float>(frameX), static_cast<float>(frameY),
+                                                static_cast<float>(anim.frameWidth), static_cast<float>(anim.frameHeight)));
 }
 
 // Register animation system functions
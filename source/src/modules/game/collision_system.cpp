@@ -1,68 +1,36 @@
 #include "bas/runtime.hpp"
 #include "bas/value.hpp"
+#include "bas/raygui_helpers.hpp"
 #include <raylib.h>
 #include <cmath>
 
 namespace bas {
 
+// Rectangles arrive as packed RECTANGLE() values or as x/y/width/height maps.
+static bool is_rect(const Value& v) {
+    const Packed* p = v.packed();
+    return p ? p->kind == Packed::Kind::Rectangle : v.is_map();
+}
+
 // Check collision between two rectangles (2D)
 static Value collision_checkRectRect(const std::vector<Value>& args) {
-    if (args.size() < 2 || !args[0].is_map() || !args[1].is_map()) {
+    if (args.size() < 2 || !is_rect(args[0]) || !is_rect(args[1])) {
         return Value::from_bool(false);
     }
-    
-    const auto& rect1 = args[0].as_map();
-    const auto& rect2 = args[1].as_map();
-    
-    auto getFloat = [](const Value::Map& m, const std::string& key, float def) -> float {
-        auto it = m.find(key);
-        if (it != m.end()) {
-            return static_cast<float>(it->second.as_number());
-        }
-        return def;
-    };
-    
-    Rectangle r1;
-    r1.x = getFloat(rect1, "x", 0.0f);
-    r1.y = getFloat(rect1, "y", 0.0f);
-    r1.width = getFloat(rect1, "width", 0.0f);
-    r1.height = getFloat(rect1, "height", 0.0f);
-    
-    Rectangle r2;
-    r2.x = getFloat(rect2, "x", 0.0f);
-    r2.y = getFloat(rect2, "y", 0.0f);
-    r2.width = getFloat(rect2, "width", 0.0f);
-    r2.height = getFloat(rect2, "height", 0.0f);
-    
-    return Value::from_bool(CheckCollisionRecs(r1, r2));
+    return Value::from_bool(CheckCollisionRecs(Value_to_Rectangle(args[0]), Value_to_Rectangle(args[1])));
 }
 
 // Check collision between rectangle and point (2D)
 static Value collision_checkRectPoint(const std::vector<Value>& args) {
-    if (args.size() < 3 || !args[0].is_map()) {
+    if (args.size() < 3 || !is_rect(args[0])) {
         return Value::from_bool(false);
     }
     
-    const auto& rect = args[0].as_map();
     float x = static_cast<float>(args[1].as_number());
     float y = static_cast<float>(args[2].as_number());
     
-    auto getFloat = [](const Value::Map& m, const std::string& key, float def) -> float {
-        auto it = m.find(key);
-        if (it != m.end()) {
-            return static_cast<float>(it->second.as_number());
-        }
-        return def;
-    };
-    
-    Rectangle r;
-    r.x = getFloat(rect, "x", 0.0f);
-    r.y = getFloat(rect, "y", 0.0f);
-    r.width = getFloat(rect, "width", 0.0f);
-    r.height = getFloat(rect, "height", 0.0f);
-    
     Vector2 point{x, y};
-    return Value::from_bool(CheckCollisionPointRec(point, r));
+    return Value::from_bool(CheckCollisionPointRec(point, Value_to_Rectangle(args[0])));
 }
 
 // Check collision between two circles (2D)
@@ -0,0 +1,213 @@
+#include "bas/ecs_scheduler.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace bas {
+
+namespace {
+
+// Entities per chunk of a thread safe system
+constexpr size_t kChunkSize = 1024;
+constexpr size_t kMaxWorkers = 8;
+
+// Worker threads that share the tasks of one batch at a time. Every thread,
+// the calling one included, claims the next unclaimed task until none are
+// left, so a thread that finishes early takes work the others have not
+// started.
+class WorkerPool {
+public:
+    explicit WorkerPool(size_t workers) {
+        for (size_t i = 0; i < workers; ++i) threads_.emplace_back([this] { work(); });
+    }
+
+    ~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        wake_.notify_all();
+        for (std::thread& t : threads_) t.join();
+    }
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    [[nodiscard]] size_t size() const { return threads_.size(); }
+
+    // Run task(0) .. task(count - 1) on the workers and local() on the
+    // calling thread, which then joins in on the tasks. Returns once all are
+    // done, rethrowing the first exception any of them threw.
+    void run(size_t count, const std::function<void(size_t)>& task, const std::function<void()>& local) {
+        auto batch = std::make_shared<Batch>();
+        batch->task = &task;
+        batch->count = count;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            batch_ = batch;
+            ++generation_;
+        }
+        wake_.notify_all();
+
+        try {
+            local();
+        } catch (...) {
+            batch->fail(std::current_exception());
+        }
+        claim(*batch);
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            finished_.wait(lock, [&] { return batch->done.load() == count; });
+            batch_.reset();
+        }
+        if (batch->error) std::rethrow_exception(batch->error);
+    }
+
+private:
+    struct Batch {
+        const std::function<void(size_t)>* task{nullptr};
+        size_t count{0};
+        std::atomic<size_t> next{0};
+        std::atomic<size_t> done{0};
+        std::mutex errorMutex;
+        std::exception_ptr error;
+
+        void fail(std::exception_ptr e) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!error) error = std::move(e);
+        }
+    };
+
+    void claim(Batch& batch) {
+        for (size_t i = batch.next++; i < batch.count; i = batch.next++) {
+            try {
+                (*batch.task)(i);
+            } catch (...) {
+                batch.fail(std::current_exception());
+            }
+            if (++batch.done == batch.count) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                finished_.notify_all();
+            }
+        }
+    }
+
+    void work() {
+        uint64_t seen = 0;
+        for (;;) {
+            std::shared_ptr<Batch> batch;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wake_.wait(lock, [&] { return stopping_ || generation_ != seen; });
+                if (stopping_) return;
+                seen = generation_;
+                batch = batch_;
+            }
+            if (batch) claim(*batch);
+        }
+    }
+
+    std::vector<std::thread> threads_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable finished_;
+    std::shared_ptr<Batch> batch_;
+    uint64_t generation_{0};
+    bool stopping_{false};
+};
+
+// Started by the first frame with a thread safe system
+WorkerPool& worker_pool() {
+    static WorkerPool pool(std::min<size_t>(kMaxWorkers, std::max(1u, std::thread::hardware_concurrency()) - 1));
+    return pool;
+}
+
+bool conflicts(const SystemRegistration& a, const SystemRegistration& b) {
+    if (!a.accessDeclared || !b.accessDeclared) return true;
+    const ComponentMask aReads = a.requiredMask & ~a.writeMask;
+    const ComponentMask bReads = b.requiredMask & ~b.writeMask;
+    return (a.writeMask & (b.writeMask | bReads)).any() || (b.writeMask & aReads).any();
+}
+
+void run_on_main(SystemRegistration& sys, const EntityQuery& query, double deltaTime) {
+    for (EntityID id : query.entities) sys.updateFn(id, deltaTime);
+}
+
+struct Chunk {
+    SystemRegistration* system;
+    const EntityQuery* query;
+    size_t begin;
+    size_t end;
+};
+
+// Kept between frames, so that the schedule's lists are not reallocated
+// every frame
+struct FrameScratch {
+    std::vector<size_t> stage;  // by system index
+    std::vector<SystemRegistration*> local;
+    std::vector<const EntityQuery*> localQueries;
+    std::vector<Chunk> chunks;
+};
+
+} // namespace
+
+void run_system_frame(std::vector<SystemRegistration>& systems, double deltaTime, int sceneId) {
+    static FrameScratch scratch;
+    auto& stage = scratch.stage;
+    const size_t n = systems.size();
+    stage.assign(n, 0);
+    size_t stages = 0;
+    for (size_t i = 0; i < n; ++i) {
+        if (!systems[i].enabled) continue;
+        size_t s = 0;
+        for (size_t j = 0; j < i; ++j) {
+            if (systems[j].enabled && conflicts(systems[i], systems[j])) s = std::max(s, stage[j] + 1);
+        }
+        stage[i] = s;
+        stages = std::max(stages, s + 1);
+    }
+
+    for (size_t s = 0; s < stages; ++s) {
+        // Queries are resolved here, on the calling thread, since resolving
+        // one may create it
+        scratch.local.clear();
+        scratch.localQueries.clear();
+        scratch.chunks.clear();
+        for (size_t i = 0; i < n; ++i) {
+            SystemRegistration& sys = systems[i];
+            if (!sys.enabled || stage[i] != s) continue;
+            const EntityQuery& query = ecs_query_data(ecs_cached_query(sys.requiredMask, sceneId));
+            if (!sys.threadSafe || worker_pool().size() == 0) {
+                scratch.local.push_back(&sys);
+                scratch.localQueries.push_back(&query);
+                continue;
+            }
+            for (size_t begin = 0; begin < query.entities.size(); begin += kChunkSize) {
+                scratch.chunks.push_back(Chunk{&sys, &query, begin, std::min(begin + kChunkSize, query.entities.size())});
+            }
+        }
+
+        auto runLocal = [&] {
+            for (size_t i = 0; i < scratch.local.size(); ++i) {
+                run_on_main(*scratch.local[i], *scratch.localQueries[i], deltaTime);
+            }
+        };
+        if (scratch.chunks.empty()) {
+            runLocal();
+            continue;
+        }
+        worker_pool().run(scratch.chunks.size(), [&](size_t c) {
+            const Chunk& chunk = scratch.chunks[c];
+            for (size_t i = chunk.begin; i < chunk.end; ++i) {
+                chunk.system->updateFn(chunk.query->entities[i], deltaTime);
+            }
+        }, runLocal);
+    }
+}
+
+} // namespace bas
@@ -0,0 +1,451 @@
+#include "bas/ecs_storage.hpp"
+#include "bas/ecs_system.hpp"
+#include <cctype>
+#include <deque>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace bas {
+
+namespace {
+
+std::deque<ComponentType> g_types;  // references stay valid as types are added
+std::unordered_map<std::string, ComponentTypeID> g_type_ids;
+std::vector<Archetype> g_archetypes;
+std::unordered_map<ComponentMask, uint32_t> g_archetype_ids;
+std::deque<EntityQuery> g_queries;  // references stay valid as queries are added
+std::unordered_map<ComponentMask, std::vector<QueryID>> g_query_ids;  // by mask, one per scene
+
+std::string to_upper(const std::string& value) {
+    std::string out;
+    out.reserve(value.size());
+    for (unsigned char c : value) {
+        out.push_back(static_cast<char>(std::toupper(c)));
+    }
+    return out;
+}
+
+// Standard fields of the built-in components
+Value::Map builtin_defaults(const std::string& key) {
+    Value::Map d;
+    if (key == "TRANSFORM") {
+        d["x"] = Value::from_number(0.0);
+        d["y"] = Value::from_number(0.0);
+        d["z"] = Value::from_number(0.0);
+        d["rotationX"] = Value::from_number(0.0);
+        d["rotationY"] = Value::from_number(0.0);
+        d["rotationZ"] = Value::from_number(0.0);
+        d["scaleX"] = Value::from_number(1.0);
+        d["scaleY"] = Value::from_number(1.0);
+        d["scaleZ"] = Value::from_number(1.0);
+    } else if (key == "SPRITE") {
+        d["textureId"] = Value::from_int(0);
+        d["visible"] = Value::from_bool(true);
+        d["tint"] = Value::from_string("WHITE");
+    } else if (key == "MODEL3D") {
+        d["modelId"] = Value::from_int(0);
+        d["visible"] = Value::from_bool(true);
+        d["tint"] = Value::from_string("WHITE");
+    } else if (key == "RIGIDBODY") {
+        d["bodyId"] = Value::from_int(0);
+        d["mass"] = Value::from_number(1.0);
+        d["friction"] = Value::from_number(0.5);
+        d["restitution"] = Value::from_number(0.0);
+    } else if (key == "COLLIDER") {
+        d["shape"] = Value::from_string("Box");
+        d["width"] = Value::from_number(1.0);
+        d["height"] = Value::from_number(1.0);
+        d["depth"] = Value::from_number(1.0);
+        d["radius"] = Value::from_number(0.5);
+        d["isTrigger"] = Value::from_bool(false);
+    } else if (key == "HEALTH") {
+        d["maxHealth"] = Value::from_number(100.0);
+        d["currentHealth"] = Value::from_number(100.0);
+        d["isDead"] = Value::from_bool(false);
+    } else if (key == "AI") {
+        d["behaviorTree"] = Value::from_string("");
+        d["state"] = Value::from_string("Idle");
+        d["targetId"] = Value::from_int(INVALID_ENTITY);
+    } else if (key == "INVENTORY") {
+        d["items"] = Value::from_array(Value::Array{});
+        d["maxSize"] = Value::from_int(10);
+    } else if (key == "ANIMATION") {
+        d["animationId"] = Value::from_int(0);
+        d["playing"] = Value::from_bool(false);
+        d["loop"] = Value::from_bool(true);
+    } else if (key == "LIGHT") {
+        d["type"] = Value::from_string("Point");
+        d["color"] = Value::from_string("WHITE");
+        d["intensity"] = Value::from_number(1.0);
+        d["range"] = Value::from_number(10.0);
+    } else if (key == "AUDIOSOURCE") {
+        d["soundId"] = Value::from_int(0);
+        d["volume"] = Value::from_number(1.0);
+        d["pitch"] = Value::from_number(1.0);
+        d["loop"] = Value::from_bool(false);
+    } else if (key == "SCRIPT") {
+        d["scriptName"] = Value::from_string("");
+        d["enabled"] = Value::from_bool(true);
+    }
+    return d;
+}
+
+FieldKind kind_of(const Value& v) {
+    if (v.is_int()) return FieldKind::Int;
+    if (v.is_number()) return FieldKind::Number;
+    if (v.is_bool()) return FieldKind::Bool;
+    if (v.is_string()) return FieldKind::String;
+    return FieldKind::Boxed;
+}
+
+Column make_column(FieldKind kind) {
+    switch (kind) {
+        case FieldKind::Number: return std::vector<double>{};
+        case FieldKind::Int: return std::vector<long long>{};
+        case FieldKind::Bool: return std::vector<uint8_t>{};
+        case FieldKind::String: return std::vector<std::string>{};
+        case FieldKind::Boxed: break;
+    }
+    return std::vector<Value>{};
+}
+
+void push_value(Column& column, const Value& v) {
+    std::visit([&](auto& data) {
+        using T = typename std::decay_t<decltype(data)>::value_type;
+        if constexpr (std::is_same_v<T, double>) data.push_back(v.as_number());
+        else if constexpr (std::is_same_v<T, long long>) data.push_back(v.as_int());
+        else if constexpr (std::is_same_v<T, uint8_t>) data.push_back(v.as_bool() ? 1 : 0);
+        else if constexpr (std::is_same_v<T, std::string>) data.push_back(v.is_string() ? v.as_string() : std::string());
+        else data.push_back(v);
+    }, column);
+}
+
+Value read_value(const Column& column, size_t row) {
+    return std::visit([&](const auto& data) -> Value {
+        using T = typename std::decay_t<decltype(data)>::value_type;
+        if constexpr (std::is_same_v<T, double>) return Value::from_number(data[row]);
+        else if constexpr (std::is_same_v<T, long long>) return Value::from_int(data[row]);
+        else if constexpr (std::is_same_v<T, uint8_t>) return Value::from_bool(data[row] != 0);
+        else if constexpr (std::is_same_v<T, std::string>) return Value::from_string(data[row]);
+        else return data[row];
+    }, column);
+}
+
+// Store `v` in place; false when the column's kind cannot hold it
+bool write_value(Column& column, size_t row, const Value& v) {
+    return std::visit([&](auto& data) -> bool {
+        using T = typename std::decay_t<decltype(data)>::value_type;
+        if constexpr (std::is_same_v<T, double>) {
+            if (!v.is_number()) return false;
+            data[row] = v.as_number();
+        } else if constexpr (std::is_same_v<T, long long>) {
+            if (!v.is_int()) return false;
+            data[row] = v.as_int();
+        } else if constexpr (std::is_same_v<T, uint8_t>) {
+            if (!v.is_bool()) return false;
+            data[row] = v.as_bool() ? 1 : 0;
+        } else if constexpr (std::is_same_v<T, std::string>) {
+            if (!v.is_string()) return false;
+            data[row] = v.as_string();
+        } else {
+            data[row] = v;
+        }
+        return true;
+    }, column);
+}
+
+// Append row `row` of `src` to `dst`, a column of the same kind
+void move_row(Column& dst, Column& src, size_t row) {
+    std::visit([&](auto& from) {
+        using V = std::decay_t<decltype(from)>;
+        std::get<V>(dst).push_back(std::move(from[row]));
+    }, src);
+}
+
+void swap_remove(Column& column, size_t row) {
+    std::visit([&](auto& data) {
+        if (row + 1 != data.size()) data[row] = std::move(data.back());
+        data.pop_back();
+    }, column);
+}
+
+// Change the kind of a field's column in every archetype, keeping its values
+void convert_field(ComponentType& type, int field, FieldKind kind) {
+    type.fields[static_cast<size_t>(field)].kind = kind;
+    for (Archetype& a : g_archetypes) {
+        ComponentTable* t = a.table(type.id);
+        if (!t) continue;
+        Column& old = t->columns[static_cast<size_t>(field)];
+        Column converted = make_column(kind);
+        const size_t n = a.entities.size();
+        for (size_t row = 0; row < n; ++row) push_value(converted, read_value(old, row));
+        old = std::move(converted);
+    }
+}
+
+// Kind a field must have to hold both its current values and `v`
+FieldKind widened(FieldKind kind, const Value& v) {
+    if (kind == FieldKind::Number && v.is_number()) return kind;
+    if (kind == FieldKind::Int && v.is_number()) return v.is_int() ? kind : FieldKind::Number;
+    return kind_of(v) == kind ? kind : FieldKind::Boxed;
+}
+
+int add_field(ComponentType& type, const std::string& name, const Value& defaultValue, FieldKind kind) {
+    int field = static_cast<int>(type.fields.size());
+    type.fields.push_back(FieldDesc{name, kind, defaultValue});
+    type.fieldIndex[to_upper(name)] = field;
+    for (Archetype& a : g_archetypes) {
+        ComponentTable* t = a.table(type.id);
+        if (!t) continue;
+        Column column = make_column(kind);
+        for (size_t row = 0; row < a.entities.size(); ++row) push_value(column, defaultValue);
+        t->columns.push_back(std::move(column));
+    }
+    return field;
+}
+
+uint32_t archetype_for(const ComponentMask& mask) {
+    if (auto it = g_archetype_ids.find(mask); it != g_archetype_ids.end()) return it->second;
+    Archetype a;
+    a.mask = mask;
+    a.tableIndex.fill(-1);
+    for (ComponentTypeID type = 0; type < MAX_COMPONENT_TYPES; ++type) {
+        if (!mask.test(type)) continue;
+        a.tableIndex[type] = static_cast<int8_t>(a.tables.size());
+        ComponentTable t;
+        t.type = type;
+        for (const FieldDesc& f : g_types[type].fields) t.columns.push_back(make_column(f.kind));
+        a.tables.push_back(std::move(t));
+    }
+    uint32_t id = static_cast<uint32_t>(g_archetypes.size());
+    g_archetypes.push_back(std::move(a));
+    g_archetype_ids.emplace(mask, id);
+    return id;
+}
+
+// Drop row `row` of archetype `a`; the last row takes its place
+void remove_row(Archetype& a, uint32_t row) {
+    for (ComponentTable& t : a.tables) {
+        for (Column& c : t.columns) swap_remove(c, row);
+    }
+    EntityID moved = a.entities.back();
+    a.entities[row] = moved;
+    a.entities.pop_back();
+    if (row < a.entities.size()) {
+        if (EntityData* entity = g_entities.find(moved)) entity->location.row = row;
+    }
+}
+
+bool query_matches(const EntityQuery& q, const ComponentMask& mask, bool active, int sceneId) {
+    return active && (q.sceneId == -1 || q.sceneId == sceneId) && (mask & q.required) == q.required;
+}
+
+constexpr uint32_t kNotInQuery = UINT32_MAX;
+
+void query_insert(EntityQuery& q, EntityID id) {
+    const uint32_t index = entity_index(id);
+    if (index >= q.position.size()) q.position.resize(index + 1, kNotInQuery);
+    q.position[index] = static_cast<uint32_t>(q.entities.size());
+    q.entities.push_back(id);
+}
+
+void query_erase(EntityQuery& q, EntityID id) {
+    const uint32_t index = entity_index(id);
+    if (index >= q.position.size() || q.position[index] == kNotInQuery) return;
+    const uint32_t at = q.position[index];
+    q.position[index] = kNotInQuery;
+    EntityID moved = q.entities.back();
+    q.entities[at] = moved;
+    q.entities.pop_back();
+    if (at < q.entities.size()) q.position[entity_index(moved)] = at;
+}
+
+// Bring every query up to date with an entity that had `oldMask` and
+// `wasActive` before a change
+void update_queries(const EntityData& entity, const ComponentMask& oldMask, bool wasActive) {
+    for (EntityQuery& q : g_queries) {
+        bool was = query_matches(q, oldMask, wasActive, entity.sceneId);
+        bool now = query_matches(q, entity.componentMask, entity.active, entity.sceneId);
+        if (was == now) continue;
+        if (now) query_insert(q, entity.id);
+        else query_erase(q, entity.id);
+    }
+}
+
+// Move an entity to the archetype of `mask`, carrying over shared components
+void relocate(EntityData& entity, const ComponentMask& mask) {
+    uint32_t target = archetype_for(mask);  // may grow g_archetypes
+    Archetype& from = g_archetypes[entity.location.archetype];
+    Archetype& to = g_archetypes[target];
+    const uint32_t row = entity.location.row;
+    for (ComponentTable& t : to.tables) {
+        ComponentTable* src = from.table(t.type);
+        const auto& fields = g_types[t.type].fields;
+        for (size_t f = 0; f < t.columns.size(); ++f) {
+            if (src) move_row(t.columns[f], src->columns[f], row);
+            else push_value(t.columns[f], fields[f].defaultValue);
+        }
+    }
+    to.entities.push_back(entity.id);
+    remove_row(from, row);
+    entity.location = EntityLocation{target, static_cast<uint32_t>(to.entities.size() - 1)};
+    const ComponentMask oldMask = entity.componentMask;
+    entity.componentMask = mask;
+    update_queries(entity, oldMask, entity.active);
+}
+
+ComponentTable& table_of(const EntityData& entity, ComponentTypeID type) {
+    ComponentTable* t = g_archetypes[entity.location.archetype].table(type);
+    if (!t) throw std::runtime_error("ECS: entity has no " + g_types[type].name + " component");
+    return *t;
+}
+
+} // namespace
+
+ComponentType& ecs_component_type(const std::string& name) {
+    std::string key = to_upper(name);
+    if (auto it = g_type_ids.find(key); it != g_type_ids.end()) return g_types[it->second];
+    if (g_types.size() >= MAX_COMPONENT_TYPES) {
+        throw std::runtime_error("ECS: too many component types (at most " + std::to_string(MAX_COMPONENT_TYPES) + ")");
+    }
+    ComponentType type;
+    type.id = g_types.size();
+    type.name = key;
+    g_types.push_back(std::move(type));
+    g_type_ids.emplace(key, g_types.back().id);
+    ComponentType& created = g_types.back();
+    for (const auto& [field, value] : builtin_defaults(key)) add_field(created, field, value, kind_of(value));
+    return created;
+}
+
+ComponentType& ecs_component_type(ComponentTypeID id) {
+    return g_types.at(id);
+}
+
+ComponentType* ecs_find_component_type(const std::string& name) {
+    auto it = g_type_ids.find(to_upper(name));
+    return it == g_type_ids.end() ? nullptr : &g_types[it->second];
+}
+
+ComponentType& ecs_define_component(const std::string& name, const Value::Map& defaults) {
+    ComponentType& type = ecs_component_type(name);
+    for (const auto& [field, value] : defaults) {
+        if (!field.empty() && field[0] == '_') continue;
+        int i = type.field(to_upper(field));
+        if (i < 0) {
+            add_field(type, field, value, kind_of(value));
+            continue;
+        }
+        FieldDesc& desc = type.fields[static_cast<size_t>(i)];
+        FieldKind kind = widened(desc.kind, value);
+        if (kind != desc.kind) convert_field(type, i, kind);
+        desc.defaultValue = value;
+    }
+    return type;
+}
+
+int ecs_field_for_write(ComponentType& type, const std::string& name) {
+    int i = type.field(to_upper(name));
+    return i >= 0 ? i : add_field(type, name, Value::nil(), FieldKind::Boxed);
+}
+
+std::vector<Archetype>& ecs_archetypes() {
+    if (g_archetypes.empty()) archetype_for(ComponentMask{});
+    return g_archetypes;
+}
+
+void ecs_attach(EntityData& entity) {
+    Archetype& empty = ecs_archetypes()[0];
+    empty.entities.push_back(entity.id);
+    entity.location = EntityLocation{0, static_cast<uint32_t>(empty.entities.size() - 1)};
+    entity.componentMask.reset();
+    update_queries(entity, ComponentMask{}, false);
+}
+
+void ecs_detach(EntityData& entity) {
+    for (EntityQuery& q : g_queries) query_erase(q, entity.id);
+    remove_row(g_archetypes[entity.location.archetype], entity.location.row);
+    entity.location = EntityLocation{};
+    entity.componentMask.reset();
+}
+
+bool ecs_add_component(EntityData& entity, ComponentTypeID type) {
+    if (entity.componentMask.test(type)) return false;
+    relocate(entity, ComponentMask(entity.componentMask).set(type));
+    return true;
+}
+
+bool ecs_remove_component(EntityData& entity, ComponentTypeID type) {
+    if (!entity.componentMask.test(type)) return false;
+    relocate(entity, ComponentMask(entity.componentMask).reset(type));
+    return true;
+}
+
+Value ecs_get_field(const EntityData& entity, ComponentTypeID type, int field) {
+    return read_value(table_of(entity, type).columns[static_cast<size_t>(field)], entity.location.row);
+}
+
+void ecs_set_field(EntityData& entity, ComponentTypeID type, int field, const Value& value) {
+    auto& columns = table_of(entity, type).columns;
+    if (write_value(columns[static_cast<size_t>(field)], entity.location.row, value)) return;
+    ComponentType& t = g_types[type];
+    convert_field(t, field, widened(t.fields[static_cast<size_t>(field)].kind, value));
+    write_value(columns[static_cast<size_t>(field)], entity.location.row, value);
+}
+
+void ecs_set_fields(EntityData& entity, ComponentTypeID type, const Value::Map& data) {
+    ComponentType& t = g_types[type];
+    for (const auto& [field, value] : data) {
+        if (!field.empty() && field[0] == '_') continue;
+        ecs_set_field(entity, type, ecs_field_for_write(t, field), value);
+    }
+}
+
+Value::Map ecs_component_map(const EntityData& entity, ComponentTypeID type) {
+    const ComponentTable& table = table_of(entity, type);
+    const ComponentType& t = g_types[type];
+    Value::Map map;
+    map.reserve(t.fields.size() + 2);
+    map["_type"] = Value::from_string(t.name);
+    map["_entityId"] = Value::from_int(entity.id);
+    for (size_t f = 0; f < t.fields.size(); ++f) {
+        map[t.fields[f].name] = read_value(table.columns[f], entity.location.row);
+    }
+    return map;
+}
+
+QueryID ecs_cached_query(const ComponentMask& required, int sceneId) {
+    std::vector<QueryID>& ids = g_query_ids[required];
+    for (QueryID id : ids) {
+        if (g_queries[id].sceneId == sceneId) return id;
+    }
+    EntityQuery q;
+    q.required = required;
+    q.sceneId = sceneId;
+    for (const Archetype& a : ecs_archetypes()) {
+        if ((a.mask & required) != required) continue;
+        for (EntityID id : a.entities) {
+            const EntityData* entity = g_entities.find(id);
+            if (entity && query_matches(q, a.mask, entity->active, entity->sceneId)) {
+                query_insert(q, id);
+            }
+        }
+    }
+    QueryID id = static_cast<QueryID>(g_queries.size());
+    g_queries.push_back(std::move(q));
+    ids.push_back(id);
+    return id;
+}
+
+const EntityQuery& ecs_query_data(QueryID id) {
+    return g_queries.at(id);
+}
+
+void ecs_set_active(EntityData& entity, bool active) {
+    if (entity.active == active) return;
+    entity.active = active;
+    update_queries(entity, entity.componentMask, !active);
+}
+
+} // namespace bas
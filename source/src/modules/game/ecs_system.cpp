@@ -1,4 +1,5 @@
 #include "bas/ecs_system.hpp"
+#include "bas/ecs_scheduler.hpp"
 #include "bas/runtime.hpp"
 #include "bas/value.hpp"
 #include <raylib.h>
@@ -6,27 +7,21 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <array>
 #include <bitset>
 #include <algorithm>
+#include <mutex>
 #include <optional>
+#include <stdexcept>
 
 namespace bas {
 
-// Component type ID
-using ComponentTypeID = size_t;
-static ComponentTypeID g_next_component_type_id = 0;
-
 // Global storage
-std::unordered_map<EntityID, EntityData> g_entities;
+EntityStore g_entities;
 std::unordered_map<int, SceneData> g_scenes;
-static EntityID g_next_entity_id = 1;
 static int g_next_scene_id = 1;
 [[maybe_unused]] static int g_current_scene = 0;
 
-// Component type registry
-static std::unordered_map<std::string, ComponentTypeID> g_component_types;
-static std::unordered_map<ComponentTypeID, std::string> g_component_type_names;
-
 // Component registry (new)
 std::unordered_map<std::string, ComponentDescriptor> g_component_registry;
 // System registry (new)
@@ -41,29 +36,64 @@ static std::string to_upper(const std::string& value) {
     return out;
 }
 
-// Get or create component type ID
-static ComponentTypeID get_component_type_id(const std::string& typeName) {
-    std::string key = to_upper(typeName);
-    auto it = g_component_types.find(key);
-    if (it != g_component_types.end()) {
-        return it->second;
+static ComponentTypeID lookup_component_type_id(const std::string& typeName) {
+    const ComponentType* type = ecs_find_component_type(typeName);
+    return type ? type->id : static_cast<ComponentTypeID>(-1);
+}
+
+EntityData& EntityStore::create() {
+    uint32_t index;
+    if (!free_.empty()) {
+        index = free_.back();
+        free_.pop_back();
+    } else {
+        index = static_cast<uint32_t>(slots_.size());
+        slots_.emplace_back();
+    }
+    EntityData& entity = slots_[index];
+    entity.id = make_entity_id(index, entity.generation);
+    ++live_;
+    return entity;
+}
+
+EntityID EntityStore::reserve() {
+    // Free slots are handed out from the back, as create() takes them
+    uint32_t taken = freeReserved_.fetch_add(1, std::memory_order_relaxed);
+    if (taken < free_.size()) {
+        uint32_t index = free_[free_.size() - 1 - taken];
+        return make_entity_id(index, slots_[index].generation);
     }
-    ComponentTypeID id = g_next_component_type_id++;
-    g_component_types[key] = id;
-    g_component_type_names[id] = key;
-    return id;
+    uint32_t index = static_cast<uint32_t>(slots_.size()) + newReserved_.fetch_add(1, std::memory_order_relaxed);
+    return make_entity_id(index, 0);
 }
 
-static ComponentTypeID lookup_component_type_id(const std::string& typeName) {
-    std::string key = to_upper(typeName);
-    auto it = g_component_types.find(key);
-    return it == g_component_types.end() ? static_cast<ComponentTypeID>(-1) : it->second;
+void EntityStore::commit_reservations() {
+    size_t fromFree = std::min<size_t>(freeReserved_.exchange(0), free_.size());
+    free_.resize(free_.size() - fromFree);
+    slots_.resize(slots_.size() + newReserved_.exchange(0));
+}
+
+EntityData& EntityStore::place(EntityID id) {
+    EntityData& entity = slots_[entity_index(id)];
+    entity.id = id;
+    ++live_;
+    return entity;
+}
+
+void EntityStore::destroy(EntityID id) {
+    EntityData* entity = find(id);
+    if (!entity) return;
+    uint32_t index = entity_index(id);
+    uint32_t generation = entity->generation + 1;
+    *entity = EntityData{};
+    entity->generation = generation;
+    --live_;
+    // A slot whose generation would overflow the handle is retired
+    if (generation <= 0x7fffffffu) free_.push_back(index);
 }
 
 static EntityData* get_entity(EntityID id) {
-    auto it = g_entities.find(id);
-    if (it == g_entities.end()) return nullptr;
-    return &it->second;
+    return g_entities.find(id);
 }
 
 static SceneData* get_scene(int id) {
@@ -91,58 +121,285 @@ static Value make_scene_value(const SceneData& scene, int sceneId) {
     return Value::from_map(std::move(sceneObj));
 }
 
-static Value::Map* find_component_data(EntityData& entity, const std::string& componentUpper) {
-    for (auto& entry : entity.components) {
-        if (to_upper(entry.first) == componentUpper) {
-            return &entry.second;
-        }
-    }
-    return nullptr;
+// Component type of an entity's component, or nullptr when it has none
+static const ComponentType* entity_component(const EntityData& entity, const std::string& componentUpper) {
+    const ComponentType* type = ecs_find_component_type(componentUpper);
+    return type && entity.componentMask.test(type->id) ? type : nullptr;
 }
 
-static Value::Map* find_component_data(EntityID id, const std::string& componentUpper) {
-    auto* entity = get_entity(id);
-    if (!entity) return nullptr;
-    return find_component_data(*entity, componentUpper);
-}
-
-static Value make_component_proxy(EntityID id, const std::string& componentUpper) {
-    auto* comp = find_component_data(id, componentUpper);
-    if (!comp) return Value::nil();
+// Proxies carry the component's type id, so member accesses through them
+// need no lookup by name
+static Value make_component_proxy(const EntityData& entity, const ComponentType& type) {
     Value::Map proxy;
     proxy["_type"] = Value::from_string("ComponentProxy");
-    proxy["_entityId"] = Value::from_int(id);
-    proxy["_component"] = Value::from_string(componentUpper);
+    proxy["_entityId"] = Value::from_int(entity.id);
+    proxy["_component"] = Value::from_string(type.name);
+    proxy["_typeId"] = Value::from_int(static_cast<long long>(type.id));
     return Value::from_map(std::move(proxy));
 }
 
-static std::optional<Value> get_component_field(EntityID id, const std::string& componentUpper, const std::string& fieldUpper) {
-    auto* comp = find_component_data(id, componentUpper);
-    if (!comp) return std::nullopt;
-    auto it = comp->find(fieldUpper);
-    if (it != comp->end()) return it->second;
-    for (const auto& entry : *comp) {
-        if (to_upper(entry.first) == fieldUpper) return entry.second;
+// Names resolved by the member hooks, one entry per access site. Hooks get
+// the member folded to lower case, and the parsed name a site passes is the
+// same string every time, so an entry is found by the string's address and
+// confirmed by comparing the name; a hit neither upper-cases the name nor
+// hashes it. `scope` is 0 for component names of entities and the type id
+// + 1 for fields of that component type. Only names that resolve are kept:
+// component types and fields are never removed, so entries cannot go stale.
+struct MemberSite {
+    const std::string* site{nullptr};
+    size_t scope{0};
+    std::string member;
+    int resolved{-1};
+};
+
+static int resolve_member(const std::string& member, size_t scope, int (*resolve)(const std::string& upper, size_t scope)) {
+    static std::array<MemberSite, 256> sites;
+    const auto key = (reinterpret_cast<uintptr_t>(&member) >> 4) ^ (scope * 31);
+    MemberSite& entry = sites[key % sites.size()];
+    if (entry.site == &member && entry.scope == scope && entry.member == member) return entry.resolved;
+    int resolved = resolve(to_upper(member), scope);
+    if (resolved >= 0) entry = MemberSite{&member, scope, member, resolved};
+    return resolved;
+}
+
+// Component type named by an entity member, or -1
+static int component_of_member(const std::string& member) {
+    return resolve_member(member, 0, [](const std::string& upper, size_t) {
+        const ComponentType* type = ecs_find_component_type(upper);
+        return type ? static_cast<int>(type->id) : -1;
+    });
+}
+
+// Column of a component field named by a proxy member, or -1
+static int field_of_member(const ComponentType& type, const std::string& member) {
+    return resolve_member(member, type.id + 1, [](const std::string& upper, size_t scope) {
+        return ecs_component_type(static_cast<ComponentTypeID>(scope - 1)).field(upper);
+    });
+}
+
+// Case-insensitive match of a handle's `_type` against an upper-case name
+static bool is_handle_type(const std::string& type, const char* upper) {
+    size_t i = 0;
+    for (; i < type.size() && upper[i]; ++i) {
+        if (std::toupper(static_cast<unsigned char>(type[i])) != upper[i]) return false;
     }
-    return std::nullopt;
+    return i == type.size() && !upper[i];
 }
 
-static bool set_component_field(EntityID id, const std::string& componentUpper, const std::string& fieldUpper, const Value& v) {
-    auto* comp = find_component_data(id, componentUpper);
-    if (!comp) return false;
-    auto it = comp->find(fieldUpper);
-    if (it != comp->end()) {
-        it->second = v;
-        return true;
+// Entity and component type of a component proxy, or false when the entity
+// is gone or no longer has the component
+static bool proxy_target(const Value::Map& map, EntityData*& entity, const ComponentType*& type) {
+    auto entityIt = map.find("_entityId");
+    auto typeIt = map.find("_typeId");
+    if (entityIt == map.end() || typeIt == map.end() || !entityIt->second.is_int() || !typeIt->second.is_int()) {
+        return false;
     }
-    for (auto& entry : *comp) {
-        if (to_upper(entry.first) == fieldUpper) {
-            entry.second = v;
-            return true;
+    entity = get_entity(static_cast<EntityID>(entityIt->second.as_int()));
+    const auto id = static_cast<ComponentTypeID>(typeIt->second.as_int());
+    if (!entity || id >= MAX_COMPONENT_TYPES || !entity->componentMask.test(id)) return false;
+    type = &ecs_component_type(id);
+    return true;
+}
+
+// ===== COMMAND BUFFERS =====
+
+struct EntityCommand {
+    enum class Op : uint8_t { Create, Destroy, AddComponent, RemoveComponent, SetActive };
+    Op op;
+    EntityID entity;
+    ComponentTypeID component{0};
+    bool active{false};
+    std::optional<Value::Map> data;  // AddComponent
+    // Create
+    int sceneId{0};
+    EntityID parent{INVALID_ENTITY};
+    std::string name;
+};
+
+struct CommandBuffer {
+    std::vector<EntityCommand> commands;
+};
+
+// Set while update_systems runs; written only between frames
+static bool g_deferring = false;
+static std::mutex g_command_buffers_mutex;
+static std::vector<std::unique_ptr<CommandBuffer>> g_command_buffers;  // in playback order
+
+// The calling thread's buffer, made on first use
+static CommandBuffer& thread_command_buffer() {
+    thread_local CommandBuffer* buffer = nullptr;
+    if (!buffer) {
+        std::lock_guard<std::mutex> lock(g_command_buffers_mutex);
+        g_command_buffers.push_back(std::make_unique<CommandBuffer>());
+        buffer = g_command_buffers.back().get();
+    }
+    return *buffer;
+}
+
+static void record(EntityCommand command) {
+    thread_command_buffer().commands.push_back(std::move(command));
+}
+
+static void add_component_now(EntityData& entity, ComponentTypeID type, const Value::Map* data) {
+    if (ecs_add_component(entity, type)) {
+        auto desc = g_component_registry.find(ecs_component_type(type).name);
+        if (desc != g_component_registry.end() && desc->second.factory) {
+            ecs_set_fields(entity, type, desc->second.factory());
         }
     }
-    (*comp)[fieldUpper] = v;
-    return true;
+    if (data) ecs_set_fields(entity, type, *data);
+}
+
+// Give a new entity its slot, its place under its parent and in its scene,
+// and enter it in the storage
+static void place_entity(EntityData& entity, const std::string& name, int sceneId, EntityID parent) {
+    entity.name = name;
+    entity.active = true;
+    entity.sceneId = sceneId;
+    entity.parent = parent;
+    ecs_attach(entity);
+    if (EntityData* parentEntity = get_entity(parent)) parentEntity->children.push_back(entity.id);
+    if (SceneData* scene = get_scene(sceneId)) scene->entities.push_back(entity.id);
+}
+
+// Take an entity and its descendants out of the storage and free their
+// slots, noting the scenes whose entity lists need compacting
+static void free_entity_tree(EntityID id, std::vector<int>& scenes) {
+    EntityData* root = get_entity(id);
+    if (!root) return;
+    if (EntityData* parent = get_entity(root->parent)) {
+        auto& children = parent->children;
+        children.erase(std::remove(children.begin(), children.end(), id), children.end());
+    }
+    std::vector<EntityID> tree{id};
+    for (size_t i = 0; i < tree.size(); ++i) {
+        if (EntityData* entity = get_entity(tree[i])) {
+            tree.insert(tree.end(), entity->children.begin(), entity->children.end());
+        }
+    }
+    for (EntityID doomed : tree) {
+        EntityData* entity = get_entity(doomed);
+        if (!entity) continue;
+        if (std::find(scenes.begin(), scenes.end(), entity->sceneId) == scenes.end()) {
+            scenes.push_back(entity->sceneId);
+        }
+        ecs_detach(*entity);
+        g_entities.destroy(doomed);
+    }
+}
+
+// Drop destroyed entities from scene lists, one pass per scene
+static void compact_scenes(const std::vector<int>& scenes) {
+    for (int sceneId : scenes) {
+        if (SceneData* scene = get_scene(sceneId)) {
+            auto& entities = scene->entities;
+            entities.erase(std::remove_if(entities.begin(), entities.end(),
+                [](EntityID id) { return !get_entity(id); }), entities.end());
+        }
+    }
+}
+
+static void play_back_commands() {
+    g_deferring = false;
+    std::vector<int> scenes;
+    // Buffers are emptied even if a command throws
+    struct Clear {
+        ~Clear() {
+            for (auto& buffer : g_command_buffers) buffer->commands.clear();
+        }
+    } clear;
+    g_entities.commit_reservations();
+    for (auto& buffer : g_command_buffers) {
+        for (EntityCommand& command : buffer->commands) {
+            if (command.op == EntityCommand::Op::Create) {
+                place_entity(g_entities.place(command.entity), command.name, command.sceneId, command.parent);
+                continue;
+            }
+            EntityData* entity = get_entity(command.entity);
+            if (!entity) continue;  // destroyed by an earlier command
+            switch (command.op) {
+                case EntityCommand::Op::Create:
+                    break;
+                case EntityCommand::Op::Destroy:
+                    free_entity_tree(command.entity, scenes);
+                    break;
+                case EntityCommand::Op::AddComponent:
+                    add_component_now(*entity, command.component, command.data ? &*command.data : nullptr);
+                    break;
+                case EntityCommand::Op::RemoveComponent:
+                    ecs_remove_component(*entity, command.component);
+                    break;
+                case EntityCommand::Op::SetActive:
+                    ecs_set_active(*entity, command.active);
+                    break;
+            }
+        }
+    }
+    compact_scenes(scenes);
+}
+
+EntityID ecs_create_entity(int sceneId, const std::string& name, EntityID parent) {
+    if (g_deferring) {
+        EntityCommand command{EntityCommand::Op::Create, g_entities.reserve()};
+        command.sceneId = sceneId;
+        command.parent = parent;
+        command.name = name;
+        EntityID id = command.entity;
+        record(std::move(command));
+        return id;
+    }
+    EntityData& entity = g_entities.create();
+    place_entity(entity, name, sceneId, parent);
+    return entity.id;
+}
+
+void ecs_destroy_entity(EntityID id) {
+    if (g_deferring) {
+        record(EntityCommand{EntityCommand::Op::Destroy, id});
+        return;
+    }
+    std::vector<int> scenes;
+    free_entity_tree(id, scenes);
+    compact_scenes(scenes);
+}
+
+void add_component(EntityID id, ComponentTypeID type, const Value::Map* data) {
+    EntityData* entity = get_entity(id);
+    // Setting the fields of a component the entity has is not structural.
+    // An entity created in this frame is not in the store yet.
+    if (g_deferring && (!entity || !entity->componentMask.test(type))) {
+        EntityCommand command{EntityCommand::Op::AddComponent, id, type};
+        if (data) command.data = *data;
+        record(std::move(command));
+        return;
+    }
+    if (entity) add_component_now(*entity, type, data);
+}
+
+void remove_component(EntityID id, ComponentTypeID type) {
+    if (g_deferring) {
+        record(EntityCommand{EntityCommand::Op::RemoveComponent, id, type});
+        return;
+    }
+    if (EntityData* entity = get_entity(id)) ecs_remove_component(*entity, type);
+}
+
+void set_entity_active(EntityID id, bool active) {
+    if (g_deferring) {
+        record(EntityCommand{EntityCommand::Op::SetActive, id, 0, active});
+        return;
+    }
+    if (EntityData* entity = get_entity(id)) ecs_set_active(*entity, active);
+}
+
+static void attach_component(EntityID id, const std::string& componentType, const Value::Map* data) {
+    add_component(id, ecs_component_type(componentType).id, data);
+}
+
+// Whether changes to an entity can be made or recorded: it exists, or
+// systems are running and it may have been created in this frame
+static bool entity_changeable(EntityID id) {
+    return g_deferring || get_entity(id);
 }
 
 // ===== SCENE FUNCTIONS =====
@@ -172,8 +429,7 @@ static Value scene_createEntity(const std::vector<Value>& args) {
     }
     
     int sceneId = static_cast<int>(idIt->second.as_int());
-    auto sceneIt = g_scenes.find(sceneId);
-    if (sceneIt == g_scenes.end()) {
+    if (!get_scene(sceneId)) {
         return Value::nil();
     }
     
@@ -187,23 +443,10 @@ static Value scene_createEntity(const std::vector<Value>& args) {
         }
     }
     
-    EntityID entityId = g_next_entity_id++;
-    EntityData& entity = g_entities[entityId];
-    entity.id = entityId;
+    EntityData entity;
+    entity.id = ecs_create_entity(sceneId, name, parentId);
     entity.name = name;
-    entity.active = true;
     entity.sceneId = sceneId;
-    entity.parent = parentId;
-    
-    if (parentId != INVALID_ENTITY) {
-        auto parentIt = g_entities.find(parentId);
-        if (parentIt != g_entities.end()) {
-            parentIt->second.children.push_back(entityId);
-        }
-    }
-    
-    sceneIt->second.entities.push_back(entityId);
-    
     return make_entity_value(entity);
 }
 
@@ -219,37 +462,7 @@ static Value scene_destroyEntity(const std::vector<Value>& args) {
         return Value::nil();
     }
     
-    EntityID entityId = idIt->second.as_int();
-    auto entityIt = g_entities.find(entityId);
-    if (entityIt == g_entities.end()) {
-        return Value::nil();
-    }
-    
-    int sceneId = entityIt->second.sceneId;
-    auto sceneIt = g_scenes.find(sceneId);
-    if (sceneIt != g_scenes.end()) {
-        auto& entities = sceneIt->second.entities;
-        entities.erase(std::remove(entities.begin(), entities.end(), entityId), entities.end());
-    }
-    
-    // Remove from parent's children
-    if (entityIt->second.parent != INVALID_ENTITY) {
-        auto parentIt = g_entities.find(entityIt->second.parent);
-        if (parentIt != g_entities.end()) {
-            auto& children = parentIt->second.children;
-            children.erase(std::remove(children.begin(), children.end(), entityId), children.end());
-        }
-    }
-    
-    // Destroy children recursively
-    for (EntityID childId : entityIt->second.children) {
-        Value::Map childObj;
-        childObj["_id"] = Value::from_int(childId);
-        std::vector<Value> destroyArgs = {args[0], Value::from_map(childObj)};
-        scene_destroyEntity(destroyArgs);
-    }
-    
-    g_entities.erase(entityIt);
+    ecs_destroy_entity(idIt->second.as_int());
     
     return Value::nil();
 }
@@ -269,99 +482,12 @@ static Value entity_addComponent(const std::vector<Value>& args) {
     }
     
     EntityID entityId = idIt->second.as_int();
-    auto entityIt = g_entities.find(entityId);
-    if (entityIt == g_entities.end()) {
+    if (!entity_changeable(entityId)) {
         return args[0];
     }
     
     std::string componentType = args[1].as_string();
-    std::string componentKey = to_upper(componentType);
-    ComponentTypeID typeId = get_component_type_id(componentKey);
-    
-    EntityData& entity = entityIt->second;
-    entity.componentMask.set(typeId);
-    
-    // Create component data
-    Value::Map componentData;
-    componentData["_type"] = Value::from_string(componentKey);
-    componentData["_entityId"] = Value::from_int(entityId);
-    
-    // Initialize component based on type
-    if (componentKey == "TRANSFORM") {
-        componentData["x"] = Value::from_number(0.0);
-        componentData["y"] = Value::from_number(0.0);
-        componentData["z"] = Value::from_number(0.0);
-        componentData["rotationX"] = Value::from_number(0.0);
-        componentData["rotationY"] = Value::from_number(0.0);
-        componentData["rotationZ"] = Value::from_number(0.0);
-        componentData["scaleX"] = Value::from_number(1.0);
-        componentData["scaleY"] = Value::from_number(1.0);
-        componentData["scaleZ"] = Value::from_number(1.0);
-    } else if (componentKey == "SPRITE") {
-        componentData["textureId"] = Value::from_int(0);
-        componentData["visible"] = Value::from_bool(true);
-        componentData["tint"] = Value::from_string("WHITE");
-    } else if (componentKey == "MODEL3D") {
-        componentData["modelId"] = Value::from_int(0);
-        componentData["visible"] = Value::from_bool(true);
-        componentData["tint"] = Value::from_string("WHITE");
-    } else if (componentKey == "RIGIDBODY") {
-        componentData["bodyId"] = Value::from_int(0);
-        componentData["mass"] = Value::from_number(1.0);
-        componentData["friction"] = Value::from_number(0.5);
-        componentData["restitution"] = Value::from_number(0.0);
-    } else if (componentKey == "COLLIDER") {
-        componentData["shape"] = Value::from_string("Box");
-        componentData["width"] = Value::from_number(1.0);
-        componentData["height"] = Value::from_number(1.0);
-        componentData["depth"] = Value::from_number(1.0);
-        componentData["radius"] = Value::from_number(0.5);
-        componentData["isTrigger"] = Value::from_bool(false);
-    } else if (componentKey == "HEALTH") {
-        componentData["maxHealth"] = Value::from_number(100.0);
-        componentData["currentHealth"] = Value::from_number(100.0);
-        componentData["isDead"] = Value::from_bool(false);
-    } else if (componentKey == "AI") {
-        componentData["behaviorTree"] = Value::from_string("");
-        componentData["state"] = Value::from_string("Idle");
-        componentData["targetId"] = Value::from_int(INVALID_ENTITY);
-    } else if (componentKey == "INVENTORY") {
-        componentData["items"] = Value::from_array(Value::Array{});
-        componentData["maxSize"] = Value::from_int(10);
-    } else if (componentKey == "ANIMATION") {
-        componentData["animationId"] = Value::from_int(0);
-        componentData["playing"] = Value::from_bool(false);
-        componentData["loop"] = Value::from_bool(true);
-    } else if (componentKey == "LIGHT") {
-        componentData["type"] = Value::from_string("Point");
-        componentData["color"] = Value::from_string("WHITE");
-        componentData["intensity"] = Value::from_number(1.0);
-        componentData["range"] = Value::from_number(10.0);
-    } else if (componentKey == "AUDIOSOURCE") {
-        componentData["soundId"] = Value::from_int(0);
-        componentData["volume"] = Value::from_number(1.0);
-        componentData["pitch"] = Value::from_number(1.0);
-        componentData["loop"] = Value::from_bool(false);
-    } else if (componentKey == "SCRIPT") {
-        componentData["scriptName"] = Value::from_string("");
-        componentData["enabled"] = Value::from_bool(true);
-    }
-    
-    // Merge custom data if provided
-    if (args.size() > 2 && args[2].is_map()) {
-        const auto& customData = args[2].as_map();
-        for (const auto& pair : customData) {
-            componentData[pair.first] = pair.second;
-        }
-    }
-    
-    entity.components[componentKey] = componentData;
-    
-    // Store in scene's component storage
-    auto sceneIt = g_scenes.find(entity.sceneId);
-    if (sceneIt != g_scenes.end()) {
-        sceneIt->second.componentStorages[componentKey].components[entityId] = componentData;
-    }
+    attach_component(entityId, componentType, args.size() > 2 && args[2].is_map() ? &args[2].as_map() : nullptr);
     
     Value::Map updated = map;
     updated["has" + componentType] = Value::from_bool(true);
@@ -382,19 +508,17 @@ static Value entity_getComponent(const std::vector<Value>& args) {
     }
     
     EntityID entityId = idIt->second.as_int();
-    auto entityIt = g_entities.find(entityId);
-    if (entityIt == g_entities.end()) {
+    EntityData* entity = g_entities.find(entityId);
+    if (!entity) {
         return Value::nil();
     }
     
-    std::string componentKey = to_upper(args[1].as_string());
-    Value::Map* data = find_component_data(entityIt->second, componentKey);
-    if (!data) {
+    const ComponentType* type = entity_component(*entity, to_upper(args[1].as_string()));
+    if (!type) {
         return Value::nil();
     }
     
-    Value::Map copy = *data;
-    return Value::from_map(std::move(copy));
+    return Value::from_map(ecs_component_map(*entity, type->id));
 }
 
 // Entity.hasComponent(entity, componentType) -> bool
@@ -410,8 +534,8 @@ static Value entity_hasComponent(const std::vector<Value>& args) {
     }
     
     EntityID entityId = idIt->second.as_int();
-    auto entityIt = g_entities.find(entityId);
-    if (entityIt == g_entities.end()) {
+    EntityData* entity = g_entities.find(entityId);
+    if (!entity) {
         return Value::from_bool(false);
     }
     
@@ -421,7 +545,20 @@ static Value entity_hasComponent(const std::vector<Value>& args) {
         return Value::from_bool(false);
     }
     
-    return Value::from_bool(entityIt->second.componentMask.test(typeId));
+    return Value::from_bool(entity->componentMask.test(typeId));
+}
+
+// Entity.isAlive(entity) -> FALSE once the entity is destroyed, even if its
+// slot now holds another entity
+static Value entity_isAlive(const std::vector<Value>& args) {
+    if (!args[0].is_map()) {
+        return Value::from_bool(false);
+    }
+    auto idIt = args[0].as_map().find("_id");
+    if (idIt == args[0].as_map().end() || !idIt->second.is_int()) {
+        return Value::from_bool(false);
+    }
+    return Value::from_bool(get_entity(idIt->second.as_int()) != nullptr);
 }
 
 // Entity.removeComponent(entity, componentType)
@@ -437,8 +574,7 @@ static Value entity_removeComponent(const std::vector<Value>& args) {
     }
     
     EntityID entityId = idIt->second.as_int();
-    auto entityIt = g_entities.find(entityId);
-    if (entityIt == g_entities.end()) {
+    if (!entity_changeable(entityId)) {
         return args[0];
     }
     
@@ -449,18 +585,7 @@ static Value entity_removeComponent(const std::vector<Value>& args) {
         return args[0];
     }
     
-    EntityData& entity = entityIt->second;
-    entity.componentMask.reset(typeId);
-    entity.components.erase(componentKey);
-    
-    // Remove from scene storage
-    auto sceneIt = g_scenes.find(entity.sceneId);
-    if (sceneIt != g_scenes.end()) {
-        auto storageIt = sceneIt->second.componentStorages.find(componentKey);
-        if (storageIt != sceneIt->second.componentStorages.end()) {
-            storageIt->second.components.erase(entityId);
-        }
-    }
+    remove_component(entityId, typeId);
     
     Value::Map updated = map;
     updated["has" + componentType] = Value::from_bool(false);
@@ -481,34 +606,43 @@ static Value entity_setComponentData(const std::vector<Value>& args) {
     }
     
     EntityID entityId = idIt->second.as_int();
-    auto entityIt = g_entities.find(entityId);
-    if (entityIt == g_entities.end()) {
+    EntityData* entity = g_entities.find(entityId);
+    if (!entity) {
         return args[0];
     }
     
-    std::string componentType = args[1].as_string();
-    std::string componentKey = to_upper(componentType);
-    const auto& data = args[2].as_map();
-    
-    Value::Map* comp = find_component_data(entityIt->second, componentKey);
-    if (!comp) {
+    const ComponentType* type = entity_component(*entity, to_upper(args[1].as_string()));
+    if (!type) {
         return args[0];
     }
     
-    for (const auto& pair : data) {
-        (*comp)[pair.first] = pair.second;
-    }
-    
-    auto sceneIt = g_scenes.find(entityIt->second.sceneId);
-    if (sceneIt != g_scenes.end()) {
-        sceneIt->second.componentStorages[componentKey].components[entityId] = *comp;
-    }
-    
+    ecs_set_fields(*entity, type->id, args[2].as_map());
     return args[0];
 }
 
 // ===== QUERY FUNCTIONS =====
 
+// Mask of the named component types; false when one was never used
+static bool required_mask(const std::vector<std::string>& componentTypes, ComponentMask& mask) {
+    for (const auto& type : componentTypes) {
+        ComponentTypeID typeId = lookup_component_type_id(type);
+        if (typeId == static_cast<ComponentTypeID>(-1)) return false;
+        mask.set(typeId);
+    }
+    return true;
+}
+
+// Calls fn(entity) for each active entity (of scene `sceneId`, unless -1)
+// that has every component in `required`, from the cached query. `fn` must
+// not add or remove components, or activate or deactivate entities.
+template <typename Fn>
+static void for_each_match(const ComponentMask& required, int sceneId, Fn&& fn) {
+    const EntityQuery& query = ecs_query_data(ecs_cached_query(required, sceneId));
+    for (EntityID id : query.entities) {
+        if (const EntityData* entity = get_entity(id)) fn(*entity);
+    }
+}
+
 // Scene.query(scene, componentType) -> array of entities
 static Value scene_query(const std::vector<Value>& args) {
     if (args.size() < 2 || !args[0].is_map()) {
@@ -527,21 +661,15 @@ static Value scene_query(const std::vector<Value>& args) {
         return Value::from_array(Value::Array{});
     }
     
-    std::string componentType = args[1].as_string();
-    std::string componentKey = to_upper(componentType);
-    auto storageIt = sceneIt->second.componentStorages.find(componentKey);
-    if (storageIt == sceneIt->second.componentStorages.end()) {
+    ComponentMask required;
+    if (!required_mask({args[1].as_string()}, required)) {
         return Value::from_array(Value::Array{});
     }
     
     Value::Array result;
-    for (const auto& pair : storageIt->second.components) {
-        EntityID entityId = pair.first;
-        auto entityIt = g_entities.find(entityId);
-        if (entityIt != g_entities.end() && entityIt->second.active) {
-            result.push_back(make_entity_value(entityIt->second));
-        }
-    }
+    for_each_match(required, sceneId, [&](const EntityData& entity) {
+        result.push_back(make_entity_value(entity));
+    });
     
     return Value::from_array(std::move(result));
 }
@@ -567,43 +695,117 @@ static Value scene_queryAll(const std::vector<Value>& args) {
     // Collect required component types
     std::vector<std::string> requiredTypes;
     for (size_t i = 1; i < args.size(); ++i) {
-        requiredTypes.push_back(to_upper(args[i].as_string()));
+        requiredTypes.push_back(args[i].as_string());
     }
     
-    if (requiredTypes.empty()) {
+    ComponentMask required;
+    if (requiredTypes.empty() || !required_mask(requiredTypes, required)) {
         return Value::from_array(Value::Array{});
     }
     
-    // Get entities from first component type
-    std::string firstType = requiredTypes[0];
-    auto storageIt = sceneIt->second.componentStorages.find(firstType);
-    if (storageIt == sceneIt->second.componentStorages.end()) {
-        return Value::from_array(Value::Array{});
-    }
+    Value::Array result;
+    for_each_match(required, sceneId, [&](const EntityData& entity) {
+        result.push_back(make_entity_value(entity));
+    });
     
+    return Value::from_array(std::move(result));
+}
+
+// ===== QUERY OBJECTS =====
+// A script query is a cursor over a cached query. Component types named
+// before any entity has them are created, so the query fills as they are
+// added. The query value owns its cursor, which goes away with the last
+// copy of the value; the cached query itself is shared by every cursor
+// with the same components and scene.
+
+struct QueryCursor {
+    QueryID query{0};
+    size_t next{0};
+};
+
+// Held in the query value's `_cursor`; calling it gives the match count
+struct QueryCursorRef : Callable {
+    std::shared_ptr<QueryCursor> cursor;
+    explicit QueryCursorRef(std::shared_ptr<QueryCursor> c) : cursor(std::move(c)) {}
+    Value call(NativeArgs) const override {
+        return Value::from_int(static_cast<long long>(ecs_query_data(cursor->query).entities.size()));
+    }
+};
+
+static Value make_query_value(const std::vector<Value>& args, size_t firstType, int sceneId) {
+    ComponentMask required;
+    for (size_t i = firstType; i < args.size(); ++i) {
+        if (args[i].is_string()) required.set(ecs_component_type(args[i].as_string()).id);
+    }
+    auto cursor = std::make_shared<QueryCursor>(QueryCursor{ecs_cached_query(required, sceneId), 0});
+    Value::Map queryObj;
+    queryObj["_type"] = Value::from_string("Query");
+    queryObj["_cursor"] = Value::from_callable(std::make_shared<QueryCursorRef>(std::move(cursor)));
+    return Value::from_map(std::move(queryObj));
+}
+
+static QueryCursor* get_query_cursor(const Value& v) {
+    if (!v.is_map()) return nullptr;
+    const auto& map = v.as_map();
+    auto cursorIt = map.find("_cursor");
+    if (cursorIt == map.end()) return nullptr;
+    auto ref = std::dynamic_pointer_cast<const QueryCursorRef>(cursorIt->second.as_callable());
+    return ref ? ref->cursor.get() : nullptr;
+}
+
+// ECS.createQuery(componentTypes...) -> query over every scene
+static Value ecs_createQuery(const std::vector<Value>& args) {
+    return make_query_value(args, 0, -1);
+}
+
+// Scene.createQuery(scene, componentTypes...) -> query over one scene
+static Value scene_createQuery(const std::vector<Value>& args) {
+    if (args.empty() || !args[0].is_map()) {
+        return Value::nil();
+    }
+    auto idIt = args[0].as_map().find("_id");
+    if (idIt == args[0].as_map().end() || !idIt->second.is_int() || !get_scene(static_cast<int>(idIt->second.as_int()))) {
+        return Value::nil();
+    }
+    return make_query_value(args, 1, static_cast<int>(idIt->second.as_int()));
+}
+
+// Query.count(query) -> number of matching entities
+static Value query_count(const std::vector<Value>& args) {
+    QueryCursor* cursor = get_query_cursor(args[0]);
+    if (!cursor) return Value::from_int(0);
+    return Value::from_int(static_cast<long long>(ecs_query_data(cursor->query).entities.size()));
+}
+
+// Query.getNext(query) -> next matching entity, or NIL (and back to the first)
+// once every match has been returned
+static Value query_getNext(const std::vector<Value>& args) {
+    QueryCursor* cursor = get_query_cursor(args[0]);
+    if (!cursor) return Value::nil();
+    const auto& entities = ecs_query_data(cursor->query).entities;
+    while (cursor->next < entities.size()) {
+        if (const EntityData* entity = get_entity(entities[cursor->next++])) return make_entity_value(*entity);
+    }
+    cursor->next = 0;
+    return Value::nil();
+}
+
+// Query.reset(query) - Start over from the first match
+static Value query_reset(const std::vector<Value>& args) {
+    if (QueryCursor* cursor = get_query_cursor(args[0])) cursor->next = 0;
+    return args[0];
+}
+
+// Query.entities(query) -> array of the matching entities
+static Value query_entities_array(const std::vector<Value>& args) {
     Value::Array result;
-    for (const auto& pair : storageIt->second.components) {
-        EntityID entityId = pair.first;
-        auto entityIt = g_entities.find(entityId);
-        if (entityIt == g_entities.end() || !entityIt->second.active) {
-            continue;
-        }
-        
-        // Check if entity has all required components
-        bool hasAll = true;
-        for (const auto& type : requiredTypes) {
-            ComponentTypeID typeId = lookup_component_type_id(type);
-            if (typeId == static_cast<ComponentTypeID>(-1) || !entityIt->second.componentMask.test(typeId)) {
-                hasAll = false;
-                break;
-            }
-        }
-        
-        if (hasAll) {
-            result.push_back(make_entity_value(entityIt->second));
+    if (QueryCursor* cursor = get_query_cursor(args[0])) {
+        const auto& entities = ecs_query_data(cursor->query).entities;
+        result.reserve(entities.size());
+        for (EntityID id : entities) {
+            if (const EntityData* entity = get_entity(id)) result.push_back(make_entity_value(*entity));
         }
     }
-    
     return Value::from_array(std::move(result));
 }
 
@@ -622,28 +824,18 @@ static Value entity_setPosition(const std::vector<Value>& args) {
     }
     
     EntityID entityId = idIt->second.as_int();
-    auto entityIt = g_entities.find(entityId);
-    if (entityIt == g_entities.end()) {
+    if (!entity_changeable(entityId)) {
         return args[0];
     }
     
     // Get or create Transform component
-    std::string componentType = "Transform";
-    auto compIt = entityIt->second.components.find(componentType);
-    if (compIt == entityIt->second.components.end()) {
-        // Add Transform component
-        std::vector<Value> addArgs = {args[0], Value::from_string(componentType)};
-        entity_addComponent(addArgs);
-        compIt = entityIt->second.components.find(componentType);
-    }
-    
-    if (compIt != entityIt->second.components.end()) {
-        compIt->second["x"] = args[1];
-        compIt->second["y"] = args[2];
-        if (args.size() > 3) {
-            compIt->second["z"] = args[3];
-        }
+    Value::Map position;
+    position["x"] = args[1];
+    position["y"] = args[2];
+    if (args.size() > 3) {
+        position["z"] = args[3];
     }
+    attach_component(entityId, "Transform", &position);
     
     Value::Map updated = map;
     updated["x"] = args[1];
@@ -668,28 +860,25 @@ static Value entity_getPosition(const std::vector<Value>& args) {
     }
     
     EntityID entityId = idIt->second.as_int();
-    auto entityIt = g_entities.find(entityId);
-    if (entityIt == g_entities.end()) {
+    EntityData* entity = g_entities.find(entityId);
+    if (!entity) {
         return Value::nil();
     }
     
-    auto compIt = entityIt->second.components.find("Transform");
-    if (compIt == entityIt->second.components.end()) {
+    const ComponentType* transform = entity_component(*entity, "TRANSFORM");
+    if (!transform) {
         return Value::nil();
     }
     
-    const auto& transform = compIt->second;
-    double x = transform.count("x") ? transform.at("x").as_number() : 0.0;
-    double y = transform.count("y") ? transform.at("y").as_number() : 0.0;
-    double z = transform.count("z") ? transform.at("z").as_number() : 0.0;
+    auto coordinate = [&](const char* name) {
+        int field = transform->field(name);
+        return field < 0 ? 0.0 : ecs_get_field(*entity, transform->id, field).as_number();
+    };
+    double x = coordinate("X");
+    double y = coordinate("Y");
+    double z = coordinate("Z");
     
-    Value::Map vec;
-    vec["_type"] = Value::from_string("Vector3");
-    vec["x"] = Value::from_number(x);
-    vec["y"] = Value::from_number(y);
-    vec["z"] = Value::from_number(z);
-    
-    return Value::from_map(std::move(vec));
+    return Value::from_packed(Packed::vector3(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z)));
 }
 
 // Entity.setActive(entity, active)
@@ -705,9 +894,8 @@ static Value entity_setActive(const std::vector<Value>& args) {
     }
     
     EntityID entityId = idIt->second.as_int();
-    auto entityIt = g_entities.find(entityId);
-    if (entityIt != g_entities.end()) {
-        entityIt->second.active = args[1].as_bool();
+    if (entity_changeable(entityId)) {
+        set_entity_active(entityId, args[1].as_bool());
     }
     
     Value::Map updated = map;
@@ -736,25 +924,25 @@ static Value entity_setParent(const std::vector<Value>& args) {
     EntityID entityId = entityIdIt->second.as_int();
     EntityID parentId = parentIdIt->second.as_int();
     
-    auto entityIt = g_entities.find(entityId);
-    auto parentIt = g_entities.find(parentId);
+    EntityData* entity = g_entities.find(entityId);
+    EntityData* parent = g_entities.find(parentId);
     
-    if (entityIt == g_entities.end() || parentIt == g_entities.end()) {
+    if (!entity || !parent) {
         return args[0];
     }
     
     // Remove from old parent
-    if (entityIt->second.parent != INVALID_ENTITY) {
-        auto oldParentIt = g_entities.find(entityIt->second.parent);
-        if (oldParentIt != g_entities.end()) {
-            auto& children = oldParentIt->second.children;
+    if (entity->parent != INVALID_ENTITY) {
+        EntityData* oldParent = g_entities.find(entity->parent);
+        if (oldParent) {
+            auto& children = oldParent->children;
             children.erase(std::remove(children.begin(), children.end(), entityId), children.end());
         }
     }
     
     // Add to new parent
-    entityIt->second.parent = parentId;
-    parentIt->second.children.push_back(entityId);
+    entity->parent = parentId;
+    parent->children.push_back(entityId);
     
     return args[0];
 }
@@ -784,8 +972,8 @@ static Value scene_update(const std::vector<Value>& args) {
     
     // Update all active entities
     for (EntityID entityId : sceneIt->second.entities) {
-        auto entityIt = g_entities.find(entityId);
-        if (entityIt == g_entities.end() || !entityIt->second.active) {
+        EntityData* entity = g_entities.find(entityId);
+        if (!entity || !entity->active) {
             continue;
         }
         
@@ -816,20 +1004,18 @@ static Value scene_draw(const std::vector<Value>& args) {
     
     // Draw all active entities with Sprite or Model3D components
     for (EntityID entityId : sceneIt->second.entities) {
-        auto entityIt = g_entities.find(entityId);
-        if (entityIt == g_entities.end() || !entityIt->second.active) {
+        EntityData* entity = g_entities.find(entityId);
+        if (!entity || !entity->active) {
             continue;
         }
         
         // Draw sprite if present
-        auto spriteIt = entityIt->second.components.find("Sprite");
-        if (spriteIt != entityIt->second.components.end()) {
+        if (entity_component(*entity, "SPRITE")) {
             // Would draw sprite here
         }
         
         // Draw 3D model if present
-        auto modelIt = entityIt->second.components.find("Model3D");
-        if (modelIt != entityIt->second.components.end()) {
+        if (entity_component(*entity, "MODEL3D")) {
             // Would draw model here
         }
     }
@@ -875,12 +1061,9 @@ static Value scene_getEntityCount(const std::vector<Value>& args) {
         }
     } else if (first.is_string()) {
         std::string nameUpper = to_upper(first.as_string());
-        for (auto& entry : g_entities) {
-            if (to_upper(entry.second.name) == nameUpper) {
-                id = entry.first;
-                break;
-            }
-        }
+        g_entities.for_each([&](const EntityData& entity) {
+            if (id == INVALID_ENTITY && to_upper(entity.name) == nameUpper) id = entity.id;
+        });
     }
     auto* entity = get_entity(id);
     return entity ? make_entity_value(*entity) : Value::nil();
@@ -936,58 +1119,52 @@ static Value scene_getEntityCount(const std::vector<Value>& args) {
     if (args.size() <= index) {
         return Value::from_array({});
     }
-    std::vector<ComponentTypeID> requiredTypes;
+    ComponentMask required;
     for (; index < args.size(); ++index) {
         if (!args[index].is_string()) continue;
         ComponentTypeID typeId = lookup_component_type_id(args[index].as_string());
         if (typeId == static_cast<ComponentTypeID>(-1)) {
             return Value::from_array({});
         }
-        requiredTypes.push_back(typeId);
+        required.set(typeId);
     }
     Value::Array matches;
-    for (auto& pair : g_entities) {
-        const EntityData& entity = pair.second;
-        if (targetScene != -1 && entity.sceneId != targetScene) continue;
-        bool ok = true;
-        for (ComponentTypeID typeId : requiredTypes) {
-            if (typeId >= entity.componentMask.size() || !entity.componentMask.test(typeId)) {
-                ok = false;
-                break;
-            }
-        }
-        if (ok) {
-            matches.push_back(make_entity_value(entity));
+    for (const Archetype& archetype : ecs_archetypes()) {
+        if ((archetype.mask & required) != required) continue;
+        for (EntityID id : archetype.entities) {
+            const EntityData* entity = get_entity(id);
+            if (!entity || (targetScene != -1 && entity->sceneId != targetScene)) continue;
+            matches.push_back(make_entity_value(*entity));
         }
     }
     return Value::from_array(std::move(matches));
 }
 
-// Member access hooks integrate ECS handles with dot-notation.
+// Member access hooks integrate ECS handles with dot-notation. Members
+// arrive folded to lower case (see try_resolve_member).
 static std::optional<Value> ecs_member_read_hook(const Value& object, const std::string& member) {
     if (!object.is_map()) return std::nullopt;
     const auto& map = object.as_map();
     auto typeIt = map.find("_type");
     if (typeIt == map.end() || !typeIt->second.is_string()) return std::nullopt;
-    std::string typeUpper = to_upper(typeIt->second.as_string());
-    std::string memberUpper = to_upper(member);
+    const std::string& handleType = typeIt->second.as_string();
     
-    if (typeUpper == "ENTITY") {
+    if (is_handle_type(handleType, "ENTITY")) {
         auto idIt = map.find("_id");
         if (idIt == map.end() || !idIt->second.is_int()) return std::nullopt;
         EntityID entityId = static_cast<EntityID>(idIt->second.as_int());
         auto* entity = get_entity(entityId);
         if (!entity) return std::nullopt;
         
-        if (memberUpper == "ID") return Value::from_int(entityId);
-        if (memberUpper == "NAME") return Value::from_string(entity->name);
-        if (memberUpper == "ACTIVE") return Value::from_bool(entity->active);
-        if (memberUpper == "SCENE") {
+        if (member == "id") return Value::from_int(entityId);
+        if (member == "name") return Value::from_string(entity->name);
+        if (member == "active") return Value::from_bool(entity->active);
+        if (member == "scene") {
             auto* scene = get_scene(entity->sceneId);
             return scene ? std::optional<Value>(make_scene_value(*scene, entity->sceneId))
                          : std::optional<Value>(Value::nil());
         }
-        if (memberUpper == "CHILDREN") {
+        if (member == "children") {
             Value::Array arr;
             for (auto childId : entity->children) {
                 auto* child = get_entity(childId);
@@ -995,59 +1172,53 @@ static std::optional<Value> ecs_member_read_hook(const Value& object, const std:
             }
             return Value::from_array(std::move(arr));
         }
-        if (memberUpper == "PARENT") {
+        if (member == "parent") {
             if (entity->parent == INVALID_ENTITY) return Value::nil();
             auto* parent = get_entity(entity->parent);
             return parent ? std::optional<Value>(make_entity_value(*parent))
                           : std::optional<Value>(Value::nil());
         }
-        if (memberUpper == "COMPONENTS") {
+        if (member == "components") {
             Value::Array arr;
-            for (auto& compEntry : entity->components) {
-                Value proxy = make_component_proxy(entityId, to_upper(compEntry.first));
-                if (!proxy.is_nil()) arr.push_back(proxy);
+            for (const ComponentTable& table : ecs_archetypes()[entity->location.archetype].tables) {
+                arr.push_back(make_component_proxy(*entity, ecs_component_type(table.type)));
             }
             return Value::from_array(std::move(arr));
         }
-        Value proxy = make_component_proxy(entityId, memberUpper);
-        if (!proxy.is_nil()) return proxy;
+        int component = component_of_member(member);
+        if (component >= 0 && entity->componentMask.test(static_cast<ComponentTypeID>(component))) {
+            return make_component_proxy(*entity, ecs_component_type(static_cast<ComponentTypeID>(component)));
+        }
         return std::nullopt;
     }
     
-    if (typeUpper == "COMPONENTPROXY") {
-        auto entityIt = map.find("_entityId");
-        auto compIt = map.find("_component");
-        if (entityIt == map.end() || compIt == map.end() || !entityIt->second.is_int() || !compIt->second.is_string()) {
-            return std::nullopt;
-        }
-        EntityID entityId = static_cast<EntityID>(entityIt->second.as_int());
-        std::string componentUpper = to_upper(compIt->second.as_string());
-        if (memberUpper == "ENTITY") {
-            auto* entity = get_entity(entityId);
+    if (is_handle_type(handleType, "COMPONENTPROXY")) {
+        if (member == "entity") {
+            auto entityIt = map.find("_entityId");
+            auto* entity = entityIt != map.end() && entityIt->second.is_int()
+                               ? get_entity(static_cast<EntityID>(entityIt->second.as_int())) : nullptr;
             return entity ? std::optional<Value>(make_entity_value(*entity))
                           : std::optional<Value>(Value::nil());
         }
-        if (memberUpper == "NAME") {
-            return Value::from_string(componentUpper);
+        if (member == "name") {
+            auto compIt = map.find("_component");
+            return compIt != map.end() ? compIt->second : Value::nil();
         }
-        if (memberUpper == "RAW") {
-            auto* comp = find_component_data(entityId, componentUpper);
-            if (!comp) return Value::nil();
-            return Value::from_map(*comp);
-        }
-        if (auto field = get_component_field(entityId, componentUpper, memberUpper)) {
-            return field;
-        }
-        return Value::nil();
+        EntityData* entity = nullptr;
+        const ComponentType* type = nullptr;
+        if (!proxy_target(map, entity, type)) return Value::nil();
+        if (member == "raw") return Value::from_map(ecs_component_map(*entity, type->id));
+        int field = field_of_member(*type, member);
+        return field >= 0 ? ecs_get_field(*entity, type->id, field) : Value::nil();
     }
     
-    if (typeUpper == "SCENE") {
+    if (is_handle_type(handleType, "SCENE")) {
         auto idIt = map.find("_id");
         if (idIt == map.end() || !idIt->second.is_int()) return std::nullopt;
         int sceneId = static_cast<int>(idIt->second.as_int());
         auto* scene = get_scene(sceneId);
         if (!scene) return std::nullopt;
-        if (memberUpper == "ENTITIES") {
+        if (member == "entities") {
             Value::Array arr;
             for (auto entityId : scene->entities) {
                 auto* entity = get_entity(entityId);
@@ -1065,45 +1236,42 @@ static bool ecs_member_write_hook(const Value& object, const std::string& member
     const auto& map = object.as_map();
     auto typeIt = map.find("_type");
     if (typeIt == map.end() || !typeIt->second.is_string()) return false;
-    std::string typeUpper = to_upper(typeIt->second.as_string());
-    std::string memberUpper = to_upper(member);
+    const std::string& handleType = typeIt->second.as_string();
     
-    if (typeUpper == "ENTITY") {
+    if (is_handle_type(handleType, "ENTITY")) {
         auto idIt = map.find("_id");
         if (idIt == map.end() || !idIt->second.is_int()) return false;
         EntityID entityId = static_cast<EntityID>(idIt->second.as_int());
         auto* entity = get_entity(entityId);
         if (!entity) return false;
-        if (memberUpper == "NAME" && value.is_string()) {
+        if (member == "name" && value.is_string()) {
             entity->name = value.as_string();
             return true;
         }
-        if (memberUpper == "ACTIVE") {
-            entity->active = value.as_bool();
+        if (member == "active") {
+            set_entity_active(entityId, value.as_bool());
             return true;
         }
         if (value.is_map()) {
-            entity->components[memberUpper] = value.as_map();
+            attach_component(entityId, to_upper(member), &value.as_map());
             return true;
         }
         return false;
     }
     
-    if (typeUpper == "COMPONENTPROXY") {
-        auto entityIt = map.find("_entityId");
-        auto compIt = map.find("_component");
-        if (entityIt == map.end() || compIt == map.end() || !entityIt->second.is_int() || !compIt->second.is_string()) {
-            return false;
-        }
-        EntityID entityId = static_cast<EntityID>(entityIt->second.as_int());
-        std::string componentUpper = to_upper(compIt->second.as_string());
-        if (memberUpper == "RAW" && value.is_map()) {
-            auto* comp = find_component_data(entityId, componentUpper);
-            if (!comp) return false;
-            *comp = value.as_map();
+    if (is_handle_type(handleType, "COMPONENTPROXY")) {
+        EntityData* entity = nullptr;
+        const ComponentType* type = nullptr;
+        if (!proxy_target(map, entity, type)) return false;
+        if (member == "raw" && value.is_map()) {
+            ecs_set_fields(*entity, type->id, value.as_map());
             return true;
         }
-        return set_component_field(entityId, componentUpper, memberUpper, value);
+        int field = field_of_member(*type, member);
+        // A field the type does not declare yet is added on its first write
+        if (field < 0) field = ecs_field_for_write(ecs_component_type(type->id), to_upper(member));
+        ecs_set_field(*entity, type->id, field, value);
+        return true;
     }
     
     return false;
@@ -1117,6 +1285,7 @@ void register_component_type(const std::string& name, const Value::Map& defaults
     desc.name = key;
     desc.defaults = defaults;
     g_component_registry[key] = desc;
+    ecs_define_component(key, defaults);
 }
 
 void register_component_type(const std::string& name, std::function<Value::Map()> factory) {
@@ -1125,6 +1294,7 @@ void register_component_type(const std::string& name, std::function<Value::Map()
     desc.name = key;
     desc.factory = factory;
     g_component_registry[key] = desc;
+    if (factory) ecs_define_component(key, factory());
 }
 
 ComponentDescriptor* get_component_descriptor(const std::string& name) {
@@ -1135,23 +1305,63 @@ ComponentDescriptor* get_component_descriptor(const std::string& name) {
 
 // ===== SYSTEM REGISTRATION =====
 
-void register_system(const std::string& name, const std::vector<std::string>& components, SystemUpdateFn fn, int priority) {
+static SystemRegistration make_system(const std::string& name, const std::vector<std::string>& components, SystemUpdateFn fn, int priority) {
     SystemRegistration sys;
     sys.name = to_upper(name);
     sys.requiredComponents.reserve(components.size());
     for (const auto& comp : components) {
         sys.requiredComponents.push_back(to_upper(comp));
+        sys.requiredMask.set(ecs_component_type(comp).id);
     }
     sys.updateFn = fn;
     sys.priority = priority;
     sys.enabled = true;
-    
+    return sys;
+}
+
+static void insert_system(SystemRegistration sys) {
     // Insert sorted by priority
     auto it = std::lower_bound(g_systems.begin(), g_systems.end(), sys,
         [](const SystemRegistration& a, const SystemRegistration& b) {
             return a.priority < b.priority;
         });
-    g_systems.insert(it, sys);
+    g_systems.insert(it, std::move(sys));
+}
+
+static ComponentMask component_mask(const std::vector<std::string>& components) {
+    ComponentMask mask;
+    for (const auto& comp : components) {
+        mask.set(ecs_component_type(comp).id);
+    }
+    return mask;
+}
+
+void register_system(const std::string& name, const std::vector<std::string>& components, SystemUpdateFn fn, int priority) {
+    insert_system(make_system(name, components, std::move(fn), priority));
+}
+
+void register_system(const std::string& name, const std::vector<std::string>& reads,
+                     const std::vector<std::string>& writes, SystemUpdateFn fn, int priority,
+                     bool threadSafe) {
+    std::vector<std::string> components = reads;
+    components.insert(components.end(), writes.begin(), writes.end());
+    SystemRegistration sys = make_system(name, components, std::move(fn), priority);
+    sys.writeMask = component_mask(writes);
+    sys.accessDeclared = true;
+    sys.threadSafe = threadSafe;
+    insert_system(std::move(sys));
+}
+
+bool declare_system_access(const std::string& name, const std::vector<std::string>& writes) {
+    std::string key = to_upper(name);
+    for (auto& sys : g_systems) {
+        if (sys.name == key) {
+            sys.writeMask = component_mask(writes);
+            sys.accessDeclared = true;
+            return true;
+        }
+    }
+    return false;
 }
 
 void unregister_system(const std::string& name) {
@@ -1177,34 +1387,14 @@ void enable_system(const std::string& name, bool enabled) {
 
 Value::Array query_entities(const std::vector<std::string>& componentTypes, int sceneId) {
     Value::Array result;
-    std::vector<ComponentTypeID> requiredTypes;
-    requiredTypes.reserve(componentTypes.size());
-    
-    for (const auto& type : componentTypes) {
-        ComponentTypeID typeId = lookup_component_type_id(type);
-        if (typeId == static_cast<ComponentTypeID>(-1)) {
-            return result; // Invalid component type
-        }
-        requiredTypes.push_back(typeId);
+    ComponentMask required;
+    if (!required_mask(componentTypes, required)) {
+        return result; // Invalid component type
     }
     
-    for (auto& pair : g_entities) {
-        EntityData& entity = pair.second;
-        if (sceneId != -1 && entity.sceneId != sceneId) continue;
-        if (!entity.active) continue;
-        
-        bool hasAll = true;
-        for (ComponentTypeID typeId : requiredTypes) {
-            if (typeId >= entity.componentMask.size() || !entity.componentMask.test(typeId)) {
-                hasAll = false;
-                break;
-            }
-        }
-        
-        if (hasAll) {
-            result.push_back(make_entity_value(entity));
-        }
-    }
+    for_each_match(required, sceneId, [&](const EntityData& entity) {
+        result.push_back(make_entity_value(entity));
+    });
     
     return result;
 }
@@ -1213,36 +1403,14 @@ Value::Array query_entities_with_filter(const std::vector<std::string>& componen
                                         std::function<bool(EntityID)> filter, 
                                         int sceneId) {
     Value::Array result;
-    std::vector<ComponentTypeID> requiredTypes;
-    requiredTypes.reserve(componentTypes.size());
-    
-    for (const auto& type : componentTypes) {
-        ComponentTypeID typeId = lookup_component_type_id(type);
-        if (typeId == static_cast<ComponentTypeID>(-1)) {
-            return result;
-        }
-        requiredTypes.push_back(typeId);
+    ComponentMask required;
+    if (!required_mask(componentTypes, required)) {
+        return result;
     }
     
-    for (auto& pair : g_entities) {
-        EntityID id = pair.first;
-        EntityData& entity = pair.second;
-        if (sceneId != -1 && entity.sceneId != sceneId) continue;
-        if (!entity.active) continue;
-        if (!filter(id)) continue;
-        
-        bool hasAll = true;
-        for (ComponentTypeID typeId : requiredTypes) {
-            if (typeId >= entity.componentMask.size() || !entity.componentMask.test(typeId)) {
-                hasAll = false;
-                break;
-            }
-        }
-        
-        if (hasAll) {
-            result.push_back(make_entity_value(entity));
-        }
-    }
+    for_each_match(required, sceneId, [&](const EntityData& entity) {
+        if (filter(entity.id)) result.push_back(make_entity_value(entity));
+    });
     
     return result;
 }
@@ -1250,22 +1418,18 @@ Value::Array query_entities_with_filter(const std::vector<std::string>& componen
 // ===== SYSTEM UPDATES =====
 
 void update_systems(double deltaTime, int sceneId) {
-    for (auto& sys : g_systems) {
-        if (!sys.enabled) continue;
-        
-        // Get entities matching this system's component requirements
-        Value::Array entities = query_entities(sys.requiredComponents, sceneId);
-        
-        for (const Value& entityVal : entities) {
-            if (!entityVal.is_map()) continue;
-            const auto& map = entityVal.as_map();
-            auto idIt = map.find("_id");
-            if (idIt == map.end() || !idIt->second.is_int()) continue;
-            
-            EntityID id = static_cast<EntityID>(idIt->second.as_int());
-            sys.updateFn(id, deltaTime);
-        }
-    }
+    if (g_deferring) {
+        throw std::runtime_error("ECS: systems cannot be updated from inside a system");
+    }
+    g_deferring = true;
+    thread_command_buffer();  // the calling thread's changes play back first
+    try {
+        run_system_frame(g_systems, deltaTime, sceneId);
+    } catch (...) {
+        play_back_commands();
+        throw;
+    }
+    play_back_commands();
 }
 
 // ===== NEW ECS FUNCTIONS =====
@@ -1307,7 +1471,9 @@ static Value ecs_updateSystems(const std::vector<Value>& args) {
     return Value::nil();
 }
 
-// ECS.registerSystem(name, components, priority) - Register a system
+// ECS.registerSystem(name, components, [callback], [priority]) - Register a system
+// `callback` (a LAMBDA or SUB/FUNCTION name, default `name`) is called as
+// callback(entityId, deltaTime) for each matching entity.
 static Value ecs_registerSystem(const std::vector<Value>& args) {
     if (args.size() < 2 || !args[0].is_string() || !args[1].is_array()) {
         return Value::nil();
@@ -1321,30 +1487,56 @@ static Value ecs_registerSystem(const std::vector<Value>& args) {
             components.push_back(comp.as_string());
         }
     }
-    int priority = args.size() > 2 ? static_cast<int>(args[2].as_int()) : 0;
-    (void)priority; // Suppress unused variable warning
+    size_t next = 2;
+    Value callback = args[0];
+    if (args.size() > next && !args[next].is_number()) callback = args[next++];
+    int priority = args.size() > next ? static_cast<int>(args[next].as_int()) : 0;
     
-    // Note: SystemUpdateFn would need to be callable from BASIC
-    // For now, this is a placeholder - systems would need to be registered from C++
+    // Resolved once; each entity update is a direct call
+    auto fn = to_callable(callback);
+    if (!fn) {
+        throw std::runtime_error("ECS.registerSystem: callback must be a LAMBDA or the name of a SUB or FUNCTION");
+    }
+    register_system(name, components, [fn](EntityID id, double deltaTime) {
+        const Value callArgs[2] = {Value::from_int(static_cast<long long>(id)), Value::from_number(deltaTime)};
+        (void)fn->call(callArgs);
+    }, priority);
     return Value::from_bool(true);
 }
 
+// ECS.markSystemPure(name, writes) - Declare that a system changes only the
+// components in `writes`, only reads its other components, and creates no
+// entities. It can then share a frame stage with systems it does not
+// conflict with. It still runs on the main thread, like every script.
+static Value ecs_markSystemPure(const std::vector<Value>& args) {
+    if (!args[0].is_string() || !args[1].is_array()) {
+        return Value::from_bool(false);
+    }
+    std::vector<std::string> writes;
+    for (const auto& comp : args[1].as_array()) {
+        if (comp.is_string()) writes.push_back(comp.as_string());
+    }
+    return Value::from_bool(declare_system_access(args[0].as_string(), writes));
+}
+
 // Register ECS system
 void register_ecs_system(FunctionRegistry& R) {
     // Scene functions
     R.add_with_policy("SCENE", NativeFn{"SCENE", 1, scene_constructor}, true);
-    R.add_with_policy("SCENE_CREATEENTITY", NativeFn{"SCENE_CREATEENTITY", 3, scene_createEntity}, true);
+    R.add_with_policy("SCENE_CREATEENTITY", NativeFn{"SCENE_CREATEENTITY", -1, scene_createEntity}, true);
     R.add("SCENE_DESTROYENTITY", NativeFn{"SCENE_DESTROYENTITY", 2, scene_destroyEntity});
     R.add_with_policy("SCENE_UPDATE", NativeFn{"SCENE_UPDATE", 2, scene_update}, true);
     R.add_with_policy("SCENE_DRAW", NativeFn{"SCENE_DRAW", 1, scene_draw}, true);
     R.add_with_policy("SCENE_GETENTITYCOUNT", NativeFn{"SCENE_GETENTITYCOUNT", 1, scene_getEntityCount}, true);
     R.add("SCENE_QUERY", NativeFn{"SCENE_QUERY", 2, scene_query});
     R.add("SCENE_QUERYALL", NativeFn{"SCENE_QUERYALL", -1, scene_queryAll});
+    R.add("SCENE_CREATEQUERY", NativeFn{"SCENE_CREATEQUERY", -1, scene_createQuery});
     
     // Entity component functions
-    R.add_with_policy("ENTITY_ADDCOMPONENT", NativeFn{"ENTITY_ADDCOMPONENT", 3, entity_addComponent}, true);
+    R.add_with_policy("ENTITY_ADDCOMPONENT", NativeFn{"ENTITY_ADDCOMPONENT", -1, entity_addComponent}, true);
     R.add("ENTITY_GETCOMPONENT", NativeFn{"ENTITY_GETCOMPONENT", 2, entity_getComponent});
     R.add("ENTITY_HASCOMPONENT", NativeFn{"ENTITY_HASCOMPONENT", 2, entity_hasComponent});
+    R.add("ENTITY_ISALIVE", NativeFn{"ENTITY_ISALIVE", 1, entity_isAlive});
     R.add("ENTITY_REMOVECOMPONENT", NativeFn{"ENTITY_REMOVECOMPONENT", 2, entity_removeComponent});
     R.add("ENTITY_SETCOMPONENTDATA", NativeFn{"ENTITY_SETCOMPONENTDATA", 3, entity_setComponentData});
     
@@ -1357,8 +1549,16 @@ void register_ecs_system(FunctionRegistry& R) {
     // New ECS functions
     R.add("ECS_REGISTERCOMPONENT", NativeFn{"ECS_REGISTERCOMPONENT", 2, ecs_registerComponent});
     R.add("ECS_QUERY", NativeFn{"ECS_QUERY", -1, ecs_query});
+    R.add("ECS_CREATEQUERY", NativeFn{"ECS_CREATEQUERY", -1, ecs_createQuery});
     R.add("ECS_UPDATESYSTEMS", NativeFn{"ECS_UPDATESYSTEMS", -1, ecs_updateSystems});
     R.add("ECS_REGISTERSYSTEM", NativeFn{"ECS_REGISTERSYSTEM", -1, ecs_registerSystem});
+    R.add("ECS_MARKSYSTEMPURE", NativeFn{"ECS_MARKSYSTEMPURE", 2, ecs_markSystemPure});
+    
+    // Query object functions
+    R.add("QUERY_COUNT", NativeFn{"QUERY_COUNT", 1, query_count});
+    R.add("QUERY_GETNEXT", NativeFn{"QUERY_GETNEXT", 1, query_getNext});
+    R.add("QUERY_RESET", NativeFn{"QUERY_RESET", 1, query_reset});
+    R.add("QUERY_ENTITIES", NativeFn{"QUERY_ENTITIES", 1, query_entities_array});
     
     // Register member access hooks for dot notation
     register_member_read_hook(ecs_member_read_hook);
@@ -5,6 +5,8 @@
 #include <string>
 #include <vector>
 #include <functional>
+#include <memory>
+#include <stdexcept>
 
 namespace bas {
 
@@ -12,25 +14,42 @@ namespace bas {
 struct EventListener {
     std::string eventName;
     std::string handlerId;
-    std::string handlerFunction;  // Function name to call
+    std::shared_ptr<const Callable> handler;  // called with the payload
     bool isActive;
 };
 
 static std::unordered_map<std::string, std::vector<EventListener>> g_event_handlers;
-static std::vector<std::pair<std::string, std::string>> g_event_queue;  // eventName, payload
+static std::vector<std::pair<std::string, Value>> g_event_queue;  // eventName, payload
 
-// EVENT.subscribe(eventName, handlerFunction) -> handlerId
+// Call every active handler of `eventName`. Handlers may subscribe or fire
+// other events, so they run from a copy of the list.
+static void dispatch_event(const std::string& eventName, const Value& payload) {
+    auto it = g_event_handlers.find(eventName);
+    if (it == g_event_handlers.end()) return;
+    std::vector<EventListener> handlers = it->second;
+    for (const auto& handler : handlers) {
+        if (handler.isActive && handler.handler) {
+            (void)handler.handler->call(NativeArgs(&payload, 1));
+        }
+    }
+}
+
+// EVENT.subscribe(eventName, handler) -> handlerId
+// `handler` is a LAMBDA or the name of a SUB/FUNCTION taking the payload.
 static Value event_subscribe(const std::vector<Value>& args) {
     if (args.size() < 2) {
         return Value::from_string("");
     }
     
     std::string eventName = args[0].as_string();
-    std::string handlerFunction = args[1].as_string();
+    auto fn = to_callable(args[1]);
+    if (!fn) {
+        throw std::runtime_error("EVENT.subscribe: handler must be a LAMBDA or the name of a SUB or FUNCTION");
+    }
     
     EventListener handler;
     handler.eventName = eventName;
-    handler.handlerFunction = handlerFunction;
+    handler.handler = std::move(fn);
     handler.handlerId = eventName + "_" + std::to_string(g_event_handlers[eventName].size());
     handler.isActive = true;
     
@@ -66,7 +85,7 @@ static Value event_fire(const std::vector<Value>& args) {
     }
     
     std::string eventName = args[0].as_string();
-    std::string payload = args.size() > 1 ? args[1].as_string() : "";
+    Value payload = args.size() > 1 ? args[1] : Value::nil();
     
     // Add to queue for processing
     g_event_queue.push_back({eventName, payload});
@@ -81,19 +100,8 @@ static Value event_fireImmediate(const std::vector<Value>& args) {
     }
     
     std::string eventName = args[0].as_string();
-    std::string payload = args.size() > 1 ? args[1].as_string() : "";
-    
-    // Fire immediately (would call handler functions here)
-    auto it = g_event_handlers.find(eventName);
-    if (it != g_event_handlers.end()) {
-        for (const auto& handler : it->second) {
-            if (handler.isActive) {
-                // Would call handler.handlerFunction(payload) here
-                // This requires integration with the interpreter
-            }
-        }
-    }
-    
+    Value payload = args.size() > 1 ? args[1] : Value::nil();
+    dispatch_event(eventName, payload);
     return Value::nil();
 }
 
@@ -101,22 +109,12 @@ static Value event_fireImmediate(const std::vector<Value>& args) {
 static Value event_processQueue(const std::vector<Value>& args) {
     (void)args;
     
-    // Process all queued events
-    for (const auto& event : g_event_queue) {
-        std::string eventName = event.first;
-        std::string payload = event.second;
-        
-        auto it = g_event_handlers.find(eventName);
-        if (it != g_event_handlers.end()) {
-            for (const auto& handler : it->second) {
-                if (handler.isActive) {
-                    // Would call handler.handlerFunction(payload) here
-                }
-            }
-        }
+    // Process the events queued so far; ones fired by handlers wait for the next call
+    std::vector<std::pair<std::string, Value>> events;
+    events.swap(g_event_queue);
+    for (const auto& event : events) {
+        dispatch_event(event.first, event.second);
     }
-    
-    g_event_queue.clear();
     return Value::nil();
 }
 
@@ -1,6 +1,7 @@
 #include "bas/runtime.hpp"
 #include "bas/value.hpp"
 #include "bas/networking_advanced.hpp"
+#include "bas/coroutines.hpp"
 #include <string>
 #include <sstream>
 #include <vector>
@@ -149,7 +150,7 @@ static std::string resolve_hostname(const std::string& hostname) {
 }
 
 // HTTP GET implementation
-Value http_get_impl(const std::vector<Value>& args) {
+Value http_get_impl(NativeArgs args) {
     if (args.empty()) return Value::from_string("HTTP GET: URL required");
     
     init_networking();
@@ -222,7 +223,7 @@ Value http_get_impl(const std::vector<Value>& args) {
 }
 
 // HTTP POST implementation
-Value http_post_impl(const std::vector<Value>& args) {
+Value http_post_impl(NativeArgs args) {
     if (args.size() < 2) return Value::from_string("HTTP POST: URL and data required");
     
     init_networking();
@@ -295,8 +296,25 @@ Value http_post_impl(const std::vector<Value>& args) {
     return Value::from_string(response);
 }
 
+// Asynchronous HTTP: the request runs on a worker thread and the returned
+// future completes with what HTTPGET/HTTPPOST would return, so a coroutine
+// can AWAIT it without stalling the frame.
+Value http_get_async_impl(NativeArgs args) {
+    if (args.empty()) return Value::from_string("HTTP GET: URL required");
+    init_networking();
+    std::vector<Value> request(args.begin(), args.end());
+    return run_async([request]() { return http_get_impl(request); });
+}
+
+Value http_post_async_impl(NativeArgs args) {
+    if (args.size() < 2) return Value::from_string("HTTP POST: URL and data required");
+    init_networking();
+    std::vector<Value> request(args.begin(), args.end());
+    return run_async([request]() { return http_post_impl(request); });
+}
+
 // Download file implementation
-Value download_file_impl(const std::vector<Value>& args) {
+Value download_file_impl(NativeArgs args) {
     if (args.size() < 2) return Value::from_bool(false);
     
     init_networking();
@@ -304,7 +322,7 @@ Value download_file_impl(const std::vector<Value>& args) {
     std::string filename = args[1].as_string();
     
     // Get HTTP response
-    Value response = http_get_impl({Value::from_string(url)});
+    Value response = http_get_impl(std::vector<Value>{Value::from_string(url)});
     std::string content = response.as_string();
     
     // Write to file
@@ -320,7 +338,7 @@ Value download_file_impl(const std::vector<Value>& args) {
 }
 
 // Upload file implementation
-Value upload_file_impl(const std::vector<Value>& args) {
+Value upload_file_impl(NativeArgs args) {
     if (args.size() < 2) return Value::from_bool(false);
     
     init_networking();
@@ -344,13 +362,13 @@ Value upload_file_impl(const std::vector<Value>& args) {
     std::string data(buffer.data(), file_size);
     
     // POST to URL
-    Value response = http_post_impl({Value::from_string(url), Value::from_string(data)});
+    Value response = http_post_impl(std::vector<Value>{Value::from_string(url), Value::from_string(data)});
     
     return Value::from_bool(!response.as_string().empty());
 }
 
 // TCP Connect implementation
-Value tcp_connect_impl(const std::vector<Value>& args) {
+Value tcp_connect_impl(NativeArgs args) {
     if (args.size() < 2) return Value::from_int(-1);
     
     init_networking();
@@ -394,7 +412,7 @@ Value tcp_connect_impl(const std::vector<Value>& args) {
 }
 
 // TCP Send implementation
-Value tcp_send_impl(const std::vector<Value>& args) {
+Value tcp_send_impl(NativeArgs args) {
     if (args.size() < 2) return Value::from_bool(false);
     
     std::lock_guard<std::mutex> lock(g_networking_mutex);
@@ -412,7 +430,7 @@ Value tcp_send_impl(const std::vector<Value>& args) {
 }
 
 // TCP Receive implementation
-Value tcp_receive_impl(const std::vector<Value>& args) {
+Value tcp_receive_impl(NativeArgs args) {
     if (args.empty()) return Value::from_string("");
     
     std::lock_guard<std::mutex> lock(g_networking_mutex);
@@ -435,7 +453,7 @@ Value tcp_receive_impl(const std::vector<Value>& args) {
 }
 
 // TCP Close implementation
-Value tcp_close_impl(const std::vector<Value>& args) {
+Value tcp_close_impl(NativeArgs args) {
     if (args.empty()) return Value::nil();
     
     std::lock_guard<std::mutex> lock(g_networking_mutex);
@@ -453,7 +471,7 @@ Value tcp_close_impl(const std::vector<Value>& args) {
 }
 
 // UDP Create implementation
-Value udp_create_impl(const std::vector<Value>& args) {
+Value udp_create_impl(NativeArgs args) {
     init_networking();
     
     int port = args.empty() ? 0 : static_cast<int>(args[0].as_int());
@@ -488,7 +506,7 @@ Value udp_create_impl(const std::vector<Value>& args) {
 }
 
 // UDP Send implementation
-Value udp_send_impl(const std::vector<Value>& args) {
+Value udp_send_impl(NativeArgs args) {
     if (args.size() < 4) return Value::from_bool(false);
     
     std::lock_guard<std::mutex> lock(g_networking_mutex);
@@ -521,7 +539,7 @@ Value udp_send_impl(const std::vector<Value>& args) {
 }
 
 // UDP Receive implementation
-Value udp_receive_impl(const std::vector<Value>& args) {
+Value udp_receive_impl(NativeArgs args) {
     if (args.empty()) return Value::from_string("");
     
     std::lock_guard<std::mutex> lock(g_networking_mutex);
@@ -557,7 +575,7 @@ Value udp_receive_impl(const std::vector<Value>& args) {
 }
 
 // UDP Close implementation
-Value udp_close_impl(const std::vector<Value>& args) {
+Value udp_close_impl(NativeArgs args) {
     if (args.empty()) return Value::nil();
     
     std::lock_guard<std::mutex> lock(g_networking_mutex);
@@ -575,7 +593,7 @@ Value udp_close_impl(const std::vector<Value>& args) {
 }
 
 // WebSocket Connect (simplified - basic HTTP upgrade)
-Value websocket_connect_impl(const std::vector<Value>& args) {
+Value websocket_connect_impl(NativeArgs args) {
     if (args.empty()) return Value::from_int(-1);
     
     init_networking();
@@ -649,7 +667,7 @@ Value websocket_connect_impl(const std::vector<Value>& args) {
 }
 
 // WebSocket Send (simplified frame format)
-Value websocket_send_impl(const std::vector<Value>& args) {
+Value websocket_send_impl(NativeArgs args) {
     if (args.size() < 2) return Value::from_bool(false);
     
     std::lock_guard<std::mutex> lock(g_networking_mutex);
@@ -686,7 +704,7 @@ Value websocket_send_impl(const std::vector<Value>& args) {
 }
 
 // WebSocket Receive (simplified frame parsing)
-Value websocket_receive_impl(const std::vector<Value>& args) {
+Value websocket_receive_impl(NativeArgs args) {
     if (args.empty()) return Value::from_string("");
     
     std::lock_guard<std::mutex> lock(g_networking_mutex);
@@ -733,7 +751,7 @@ Value websocket_receive_impl(const std::vector<Value>& args) {
 }
 
 // WebSocket Close
-Value websocket_close_impl(const std::vector<Value>& args) {
+Value websocket_close_impl(NativeArgs args) {
     if (args.empty()) return Value::nil();
     
     std::lock_guard<std::mutex> lock(g_networking_mutex);
@@ -754,6 +772,8 @@ Value websocket_close_impl(const std::vector<Value>& args) {
 void register_advanced_networking_functions(FunctionRegistry& R) {
     R.add("HTTPGET", NativeFn{"HTTPGET", 1, http_get_impl});
     R.add("HTTPPOST", NativeFn{"HTTPPOST", 2, http_post_impl});
+    R.add("HTTPGETASYNC", NativeFn{"HTTPGETASYNC", 1, http_get_async_impl});
+    R.add("HTTPPOSTASYNC", NativeFn{"HTTPPOSTASYNC", 2, http_post_async_impl});
     R.add("DOWNLOADFILE", NativeFn{"DOWNLOADFILE", 2, download_file_impl});
     R.add("UPLOADFILE", NativeFn{"UPLOADFILE", 2, upload_file_impl});
     R.add("WEBSOCKETCONNECT", NativeFn{"WEBSOCKETCONNECT", 1, websocket_connect_impl});
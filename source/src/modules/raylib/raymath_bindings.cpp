@@ -15,22 +15,22 @@ namespace bas {
 void register_raymath_functions(FunctionRegistry& R) {
     // --- Vector2 ---
     R.add_with_policy("VECTOR2ZERO", NativeFn{"VECTOR2ZERO", 0, [](const std::vector<Value>&) {
-        return Value::from_map(Vector2_to_Map(Vector2Zero()));
+        return Vector2_to_Value(Vector2Zero());
     }}, true);
     R.add_with_policy("VECTOR2ONE", NativeFn{"VECTOR2ONE", 0, [](const std::vector<Value>&) {
-        return Value::from_map(Vector2_to_Map(Vector2One()));
+        return Vector2_to_Value(Vector2One());
     }}, true);
     R.add_with_policy("VECTOR2ADD", NativeFn{"VECTOR2ADD", 2, [](const std::vector<Value>& a) {
-        return Value::from_map(Vector2_to_Map(Vector2Add(Value_to_Vector2(a[0]), Value_to_Vector2(a[1]))));
+        return Vector2_to_Value(Vector2Add(Value_to_Vector2(a[0]), Value_to_Vector2(a[1])));
     }}, true);
     R.add_with_policy("VECTOR2ADDVALUE", NativeFn{"VECTOR2ADDVALUE", 2, [](const std::vector<Value>& a) {
-        return Value::from_map(Vector2_to_Map(Vector2AddValue(Value_to_Vector2(a[0]), static_cast<float>(a[1].as_number()))));
+        return Vector2_to_Value(Vector2AddValue(Value_to_Vector2(a[0]), static_cast<float>(a[1].as_number())));
     }}, true);
     R.add_with_policy("VECTOR2SUBTRACT", NativeFn{"VECTOR2SUBTRACT", 2, [](const std::vector<Value>& a) {
-        return Value::from_map(Vector2_to_Map(Vector2Subtract(Value_to_Vector2(a[0]), Value_to_Vector2(a[1]))));
+        return Vector2_to_Value(Vector2Subtract(Value_to_Vector2(a[0]), Value_to_Vector2(a[1])));
     }}, true);
     R.add_with_policy("VECTOR2SUBTRACTVALUE", NativeFn{"VECTOR2SUBTRACTVALUE", 2, [](const std::vector<Value>& a) {
-        return Value::from_map(Vector2_to_Map(Vector2SubtractValue(Value_to_Vector2(a[0]), static_cast<float>(a[1].as_number()))));
+        return Vector2_to_Value(Vector2SubtractValue(Value_to_Vector2(a[0]), static_cast<float>(a[1].as_number())));
     }}, true);
     R.add_with_policy("VECTOR2LENGTH", NativeFn{"VECTOR2LENGTH", 1, [](const std::vector<Value>& a) {
         return Value::from_number(Vector2Length(Value_to_Vector2(a[0])));
@@ -45,22 +45,22 @@ void register_raymath_functions(FunctionRegistry& R) {
         return Value::from_number(Vector2Angle(Value_to_Vector2(a[0]), Value_to_Vector2(a[1])));
     }}, true);
     R.add_with_policy("VECTOR2SCALE", NativeFn{"VECTOR2SCALE", 2, [](const std::vector<Value>& a) {
-        return Value::from_map(Vector2_to_Map(Vector2Scale(Value_to_Vector2(a[0]), static_cast<float>(a[1].as_number()))));
+        return Vector2_to_Value(Vector2Scale(Value_to_Vector2(a[0]), static_cast<float>(a[1].as_number())));
     }}, true);
     R.add_with_policy("VECTOR2MULTIPLY", NativeFn{"VECTOR2MULTIPLY", 2, [](const std::vector<Value>& a) {
-        return Value::from_map(Vector2_to_Map(Vector2Multiply(Value_to_Vector2(a[0]), Value_to_Vector2(a[1]))));
+        return Vector2_to_Value(Vector2Multiply(Value_to_Vector2(a[0]), Value_to_Vector2(a[1])));
     }}, true);
     R.add_with_policy("VECTOR2NEGATE", NativeFn{"VECTOR2NEGATE", 1, [](const std::vector<Value>& a) {
-        return Value::from_map(Vector2_to_Map(Vector2Negate(Value_to_Vector2(a[0]))));
+        return Vector2_to_Value(Vector2Negate(Value_to_Vector2(a[0])));
     }}, true);
     R.add_with_policy("VECTOR2DIVIDE", NativeFn{"VECTOR2DIVIDE", 2, [](const std::vector<Value>& a) {
-        return Value::from_map(Vector2_to_Map(Vector2Divide(Value_to_Vector2(a[0]), Value_to_Vector2(a[1]))));
+        return Vector2_to_Value(Vector2Divide(Value_to_Vector2(a[0]), Value_to_Vector2(a[1])));
     }}, true);
     R.add_with_policy("VECTOR2NORMALIZE", NativeFn{"VECTOR2NORMALIZE", 1, [](const std::vector<Value>& a) {
-        return Value::from_map(Vector2_to_Map(Vector2Normalize(Value_to_Vector2(a[0]))));
+        return Vector2_to_Value(Vector2Normalize(Value_to_Vector2(a[0])));
     }}, true);
     R.add_with_policy("VECTOR2LERP", NativeFn{"VECTOR2LERP", 3, [](const std::vector<Value>& a) {
-        return Value::from_map(Vector2_to_Map(Vector2Lerp(Value_to_Vector2(a[0]), Value_to_Vector2(a[1]), static_cast<float>(a[2].as_number()))));
+        return Vector2_to_Value(Vector2Lerp(Value_to_Vector2(a[0]), Value_to_Vector2(a[1]), static_cast<float>(a[2].as_number())));
     }}, true);
     R.add_with_policy("VECTOR2LENGTHSQR", NativeFn{"VECTOR2LENGTHSQR", 1, [](const std::vector<Value>& a) {
         return Value::from_number(Vector2LengthSqr(Value_to_Vector2(a[0])));
@@ -69,22 +69,22 @@ void register_raymath_functions(FunctionRegistry& R) {
         return Value::from_number(Vector2DistanceSqr(Value_to_Vector2(a[0]), Value_to_Vector2(a[1])));
     }}, true);
     R.add_with_policy("VECTOR2REFLECT", NativeFn{"VECTOR2REFLECT", 2, [](const std::vector<Value>& a) {
-        return Value::from_map(Vector2_to_Map(Vector2Reflect(Value_to_Vector2(a[0]), Value_to_Vector2(a[1]))));
+        return Vector2_to_Value(Vector2Reflect(Value_to_Vector2(a[0]), Value_to_Vector2(a[1])));
     }}, true);
     R.add_with_policy("VECTOR2ROTATE", NativeFn{"VECTOR2ROTATE", 2, [](const std::vector<Value>& a) {
-        return Value::from_map(Vector2_to_Map(Vector2Rotate(Value_to_Vector2(a[0]), static_cast<float>(a[1].as_number()))));
+        return Vector2_to_Value(Vector2Rotate(Value_to_Vector2(a[0]), static_cast<float>(a[1].as_number())));
     }}, true);
     R.add_with_policy("VECTOR2MOVETOWARDS", NativeFn{"VECTOR2MOVETOWARDS", 3, [](const std::vector<Value>& a) {
-        return Value::from_map(Vector2_to_Map(Vector2MoveTowards(Value_to_Vector2(a[0]), Value_to_Vector2(a[1]), static_cast<float>(a[2].as_number()))));
+        return Vector2_to_Value(Vector2MoveTowards(Value_to_Vector2(a[0]), Value_to_Vector2(a[1]), static_cast<float>(a[2].as_number())));
     }}, true);
     R.add_with_policy("VECTOR2INVERT", NativeFn{"VECTOR2INVERT", 1, [](const std::vector<Value>& a) {
-        return Value::from_map(Vector2_to_Map(Vector2Invert(Value_to_Vector2(a[0]))));
+        return Vector2_to_Value(Vector2Invert(Value_to_Vector2(a[0])));
     }}, true);
     R.add_with_policy("VECTOR2CLAMP", NativeFn{"VECTOR2CLAMP", 3, [](const std::vector<Value>& a) {
-        return Value::from_map(Vector2_to_Map(Vector2Clamp(Value_to_Vector2(a[0]), Value_to_Vector2(a[1]), Value_to_Vector2(a[2]))));
+        return Vector2_to_Value(Vector2Clamp(Value_to_Vector2(a[0]), Value_to_Vector2(a[1]), Value_to_Vector2(a[2])));
     }}, true);
     R.add_with_policy("VECTOR2CLAMPVALUE", NativeFn{"VECTOR2CLAMPVALUE", 3, [](const std::vector<Value>& a) {
-        return Value::from_map(Vector2_to_Map(Vector2ClampValue(Value_to_Vector2(a[0]), static_cast<float>(a[1].as_number()), static_cast<float>(a[2].as_number()))));
+        return Vector2_to_Value(Vector2ClampValue(Value_to_Vector2(a[0]), static_cast<float>(a[1].as_number()), static_cast<float>(a[2].as_number())));
     }}, true);
     R.add_with_policy("VECTOR2EQUALS", NativeFn{"VECTOR2EQUALS", 2, [](const std::vector<Value>& a) {
         return Value::from_bool(Vector2Equals(Value_to_Vector2(a[0]), Value_to_Vector2(a[1])));
@@ -92,34 +92,34 @@ void register_raymath_functions(FunctionRegistry& R) {
 
     // --- Vector3 ---
     R.add_with_policy("VECTOR3ZERO", NativeFn{"VECTOR3ZERO", 0, [](const std::vector<Value>&) {
-        return Value::from_map(Vector3_to_Map(Vector3Zero()));
+        return Vector3_to_Value(Vector3Zero());
     }}, true);
     R.add_with_policy("VECTOR3ONE", NativeFn{"VECTOR3ONE", 0, [](const std::vector<Value>&) {
-        return Value::from_map(Vector3_to_Map(Vector3One()));
+        return Vector3_to_Value(Vector3One());
     }}, true);
     R.add_with_policy("VECTOR3ADD", NativeFn{"VECTOR3ADD", 2, [](const std::vector<Value>& a) {
-        return Value::from_map(Vector3_to_Map(Vector3Add(Value_to_Vector3(a[0]), Value_to_Vector3(a[1]))));
+        return Vector3_to_Value(Vector3Add(Value_to_Vector3(a[0]), Value_to_Vector3(a[1])));
     }}, true);
     R.add_with_policy("VECTOR3ADDVALUE", NativeFn{"VECTOR3ADDVALUE", 2, [](const std::vector<Value>& a) {
-        return Value::from_map(Vector3_to_Map(Vector3AddValue(Value_to_Vector3(a[0]), static_cast<float>(a[1].as_number()))));
+        return Vector3_to_Value(Vector3AddValue(Value_to_Vector3(a[0]), static_cast<float>(a[1].as_number())));
     }}, true);
     R.add_with_policy("VECTOR3SUBTRACT", NativeFn{"VECTOR3SUBTRACT", 2, [](const std::vector<Value>& a) {
-        return Value::from_map(Vector3_to_Map(Vector3Subtract(Value_to_Vector3(a[0]), Value_to_Vector3(a[1]))));
+        return Vector3_to_Value(Vector3Subtract(Value_to_Vector3(a[0]), Value_to_Vector3(a[1])));
     }}, true);
     R.add_with_policy("VECTOR3SUBTRACTVALUE", NativeFn{"VECTOR3SUBTRACTVALUE", 2, [](const std::vector<Value>& a) {
-        return Value::from_map(Vector3_to_Map(Vector3SubtractValue(Value_to_Vector3(a[0]), static_cast<float>(a[1].as_number()))));
+        return Vector3_to_Value(Vector3SubtractValue(Value_to_Vector3(a[0]), static_cast<float>(a[1].as_number())));
     }}, true);
     R.add_with_policy("VECTOR3SCALE", NativeFn{"VECTOR3SCALE", 2, [](const std::vector<Value>& a) {
-        return Value::from_map(Vector3_to_Map(Vector3Scale(Value_to_Vector3(a[0]), static_cast<float>(a[1].as_number()))));
+        return Vector3_to_Value(Vector3Scale(Value_to_Vector3(a[0]), static_cast<float>(a[1].as_number())));
     }}, true);
     R.add_with_policy("VECTOR3MULTIPLY", NativeFn{"VECTOR3MULTIPLY", 2, [](const std::vector<Value>& a) {
-        return Value::from_map(Vector3_to_Map(Vector3Multiply(Value_to_Vector3(a[0]), Value_to_Vector3(a[1]))));
+        return Vector3_to_Value(Vector3Multiply(Value_to_Vector3(a[0]), Value_to_Vector3(a[1])));
     }}, true);
     R.add_with_policy("VECTOR3CROSSPRODUCT", NativeFn{"VECTOR3CROSSPRODUCT", 2, [](const std::vector<Value>& a) {
-        return Value::from_map(Vector3_to_Map(Vector3CrossProduct(Value_to_Vector3(a[0]), Value_to_Vector3(a[1]))));
+        return Vector3_to_Value(Vector3CrossProduct(Value_to_Vector3(a[0]), Value_to_Vector3(a[1])));
     }}, true);
     R.add_with_policy("VECTOR3PERPENDICULAR", NativeFn{"VECTOR3PERPENDICULAR", 1, [](const std::vector<Value>& a) {
-        return Value::from_map(Vector3_to_Map(Vector3Perpendicular(Value_to_Vector3(a[0]))));
+        return Vector3_to_Value(Vector3Perpendicular(Value_to_Vector3(a[0])));
     }}, true);
     R.add_with_policy("VECTOR3LENGTH", NativeFn{"VECTOR3LENGTH", 1, [](const std::vector<Value>& a) {
         return Value::from_number(Vector3Length(Value_to_Vector3(a[0])));
@@ -140,43 +140,43 @@ void register_raymath_functions(FunctionRegistry& R) {
         return Value::from_number(Vector3Angle(Value_to_Vector3(a[0]), Value_to_Vector3(a[1])));
     }}, true);
     R.add_with_policy("VECTOR3NEGATE", NativeFn{"VECTOR3NEGATE", 1, [](const std::vector<Value>& a) {
-        return Value::from_map(Vector3_to_Map(Vector3Negate(Value_to_Vector3(a[0]))));
+        return Vector3_to_Value(Vector3Negate(Value_to_Vector3(a[0])));
     }}, true);
     R.add_with_policy("VECTOR3DIVIDE", NativeFn{"VECTOR3DIVIDE", 2, [](const std::vector<Value>& a) {
-        return Value::from_map(Vector3_to_Map(Vector3Divide(Value_to_Vector3(a[0]), Value_to_Vector3(a[1]))));
+        return Vector3_to_Value(Vector3Divide(Value_to_Vector3(a[0]), Value_to_Vector3(a[1])));
     }}, true);
     R.add_with_policy("VECTOR3NORMALIZE", NativeFn{"VECTOR3NORMALIZE", 1, [](const std::vector<Value>& a) {
-        return Value::from_map(Vector3_to_Map(Vector3Normalize(Value_to_Vector3(a[0]))));
+        return Vector3_to_Value(Vector3Normalize(Value_to_Vector3(a[0])));
     }}, true);
     R.add_with_policy("VECTOR3LERP", NativeFn{"VECTOR3LERP", 3, [](const std::vector<Value>& a) {
-        return Value::from_map(Vector3_to_Map(Vector3Lerp(Value_to_Vector3(a[0]), Value_to_Vector3(a[1]), static_cast<float>(a[2].as_number()))));
+        return Vector3_to_Value(Vector3Lerp(Value_to_Vector3(a[0]), Value_to_Vector3(a[1]), static_cast<float>(a[2].as_number())));
     }}, true);
     R.add_with_policy("VECTOR3REFLECT", NativeFn{"VECTOR3REFLECT", 2, [](const std::vector<Value>& a) {
-        return Value::from_map(Vector3_to_Map(Vector3Reflect(Value_to_Vector3(a[0]), Value_to_Vector3(a[1]))));
+        return Vector3_to_Value(Vector3Reflect(Value_to_Vector3(a[0]), Value_to_Vector3(a[1])));
     }}, true);
     R.add_with_policy("VECTOR3MIN", NativeFn{"VECTOR3MIN", 2, [](const std::vector<Value>& a) {
-        return Value::from_map(Vector3_to_Map(Vector3Min(Value_to_Vector3(a[0]), Value_to_Vector3(a[1]))));
+        return Vector3_to_Value(Vector3Min(Value_to_Vector3(a[0]), Value_to_Vector3(a[1])));
     }}, true);
     R.add_with_policy("VECTOR3MAX", NativeFn{"VECTOR3MAX", 2, [](const std::vector<Value>& a) {
-        return Value::from_map(Vector3_to_Map(Vector3Max(Value_to_Vector3(a[0]), Value_to_Vector3(a[1]))));
+        return Vector3_to_Value(Vector3Max(Value_to_Vector3(a[0]), Value_to_Vector3(a[1])));
     }}, true);
     R.add_with_policy("VECTOR3BARYCENTER", NativeFn{"VECTOR3BARYCENTER", 4, [](const std::vector<Value>& a) {
-        return Value::from_map(Vector3_to_Map(Vector3Barycenter(Value_to_Vector3(a[0]), Value_to_Vector3(a[1]), Value_to_Vector3(a[2]), Value_to_Vector3(a[3]))));
+        return Vector3_to_Value(Vector3Barycenter(Value_to_Vector3(a[0]), Value_to_Vector3(a[1]), Value_to_Vector3(a[2]), Value_to_Vector3(a[3])));
     }}, true);
     R.add_with_policy("VECTOR3INVERT", NativeFn{"VECTOR3INVERT", 1, [](const std::vector<Value>& a) {
-        return Value::from_map(Vector3_to_Map(Vector3Invert(Value_to_Vector3(a[0]))));
+        return Vector3_to_Value(Vector3Invert(Value_to_Vector3(a[0])));
     }}, true);
     R.add_with_policy("VECTOR3CLAMP", NativeFn{"VECTOR3CLAMP", 3, [](const std::vector<Value>& a) {
-        return Value::from_map(Vector3_to_Map(Vector3Clamp(Value_to_Vector3(a[0]), Value_to_Vector3(a[1]), Value_to_Vector3(a[2]))));
+        return Vector3_to_Value(Vector3Clamp(Value_to_Vector3(a[0]), Value_to_Vector3(a[1]), Value_to_Vector3(a[2])));
     }}, true);
     R.add_with_policy("VECTOR3CLAMPVALUE", NativeFn{"VECTOR3CLAMPVALUE", 3, [](const std::vector<Value>& a) {
-        return Value::from_map(Vector3_to_Map(Vector3ClampValue(Value_to_Vector3(a[0]), static_cast<float>(a[1].as_number()), static_cast<float>(a[2].as_number()))));
+        return Vector3_to_Value(Vector3ClampValue(Value_to_Vector3(a[0]), static_cast<float>(a[1].as_number()), static_cast<float>(a[2].as_number())));
     }}, true);
     R.add_with_policy("VECTOR3EQUALS", NativeFn{"VECTOR3EQUALS", 2, [](const std::vector<Value>& a) {
         return Value::from_bool(Vector3Equals(Value_to_Vector3(a[0]), Value_to_Vector3(a[1])));
     }}, true);
     R.add_with_policy("VECTOR3REFRACT", NativeFn{"VECTOR3REFRACT", 3, [](const std::vector<Value>& a) {
-        return Value::from_map(Vector3_to_Map(Vector3Refract(Value_to_Vector3(a[0]), Value_to_Vector3(a[1]), static_cast<float>(a[2].as_number()))));
+        return Vector3_to_Value(Vector3Refract(Value_to_Vector3(a[0]), Value_to_Vector3(a[1]), static_cast<float>(a[2].as_number())));
     }}, true);
 
     // --- Matrix ---
@@ -270,7 +270,7 @@ void register_raymath_functions(FunctionRegistry& R) {
         return Value::from_map(Quaternion_to_Map(QuaternionFromEuler(static_cast<float>(a[0].as_number()), static_cast<float>(a[1].as_number()), static_cast<float>(a[2].as_number()))));
     }}, true);
     R.add_with_policy("QUATERNIONTOEULER", NativeFn{"QUATERNIONTOEULER", 1, [](const std::vector<Value>& a) {
-        return Value::from_map(Vector3_to_Map(QuaternionToEuler(Value_to_Quaternion(a[0]))));
+        return Vector3_to_Value(QuaternionToEuler(Value_to_Quaternion(a[0])));
     }}, true);
 }
 
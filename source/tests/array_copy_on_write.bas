@@ -0,0 +1,22 @@
+SUB modify(arr)
+  arr[0] = 99
+  PRINT arr[0]
+END SUB
+DIM a(3)
+a[0] = 1
+b = a
+b[0] = 2
+PRINT a[0]
+PRINT b[0]
+modify(a)
+PRINT a[0]
+a[1] = a
+PRINT a[1][0]
+a[0] = 7
+PRINT a[1][0]
+DIM g(2, 2)
+g[1][1] = 5
+h = g
+h[1][1] = 6
+PRINT g[1][1]
+PRINT h[1][1]
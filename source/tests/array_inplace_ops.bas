@@ -0,0 +1,33 @@
+a = [3, 1, 2]
+b = a
+a = PUSH(a, 10)
+PUSH(a, 20)
+PRINT LEN(a)
+PRINT LEN(b)
+a = SORT(a)
+PRINT a[0]
+PRINT a[4]
+PRINT b[0]
+a = POP(a)
+PRINT LEN(a)
+a = INSERT(a, 0, 99)
+PRINT a[0]
+a = REMOVE(a, 0)
+PRINT a[0]
+c = PUSH(a, 5)
+PRINT LEN(a)
+PRINT LEN(c)
+CALL SORT(b)
+PRINT b[0]
+SUB addone(arr)
+  arr = PUSH(arr, 1)
+  PRINT LEN(arr)
+END SUB
+addone(a)
+PRINT LEN(a)
+q = [1]
+q = PUSH(q, 2)
+PRINT q
+s = ["b", 1, "a"]
+s = SORT(s)
+PRINT s[0]
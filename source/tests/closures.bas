@@ -0,0 +1,41 @@
+REM Closures: LAMBDA values called directly, captured locals, callbacks, fields
+double = LAMBDA(x)
+  RETURN x * 2
+END LAMBDA
+PRINT double(21)
+PRINT double.invoke(5)
+
+REM Each closure keeps its own copy of the creating frame's locals
+FUNCTION MakeAdder(n)
+  RETURN LAMBDA(x) RETURN x + n END LAMBDA
+END FUNCTION
+add5 = MakeAdder(5)
+add10 = MakeAdder(10)
+PRINT add5(1)
+PRINT add10(1)
+
+REM Function values as arguments
+SUB Apply(f, v)
+  PRINT f(v)
+END SUB
+Apply(add5, 100)
+
+REM Globals are read when the closure runs
+greeting = "hi"
+greet = LAMBDA(name) RETURN greeting + " " + name END LAMBDA
+greeting = "hello"
+PRINT greet("bob")
+
+REM A field holding a function value is called like a method
+TYPE Unit
+  onhit
+ENDTYPE
+u = Unit()
+u.onhit = double
+PRINT u.onhit(4)
+
+REM Defaults, identity
+scale = LAMBDA(a, b = 3) RETURN a * b ENDLAMBDA
+PRINT scale(2)
+PRINT add5 = add5
+PRINT add5 = add10
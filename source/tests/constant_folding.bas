@@ -0,0 +1,22 @@
+CONST W = 800 / 2
+CONST PI = 3.14159
+CONST HALF = W / 2
+CONST BIG = 1000000
+SUB show(x)
+  PRINT x * (PI / 180)
+END SUB
+PRINT W
+PRINT HALF
+PRINT BIG
+PRINT BIG * 2
+PRINT 7 \ 2
+PRINT 2 ^ 10
+PRINT -3 + 1
+PRINT "a" + "b"
+PRINT 1 = 1.0
+PRINT 3 > 2
+PRINT 10 MOD 3
+show(180)
+x = 5
+PRINT x + 1
+PRINT 5 / 2
@@ -0,0 +1,70 @@
+REM Coroutines: YIELD values, RETURN result, scheduler, AWAIT on time and coroutines
+SUB patrol(label, steps)
+  FOR i = 1 TO steps
+    PRINT label + " step " + STR(i)
+    YIELD
+  NEXT i
+  PRINT label + " done"
+END SUB
+FUNCTION counter(n)
+  total = 0
+  FOR i = 1 TO n
+    total = total + i
+    YIELD total
+  NEXT i
+  RETURN "sum=" + STR(total)
+END FUNCTION
+c = COROUTINE_CREATE("counter", 3)
+PRINT COROUTINE_RESUME(c)
+PRINT COROUTINE_RESUME(c)
+PRINT COROUTINE_STATUS(c)
+PRINT COROUTINE_RESUME(c)
+PRINT COROUTINE_RESUME(c)
+PRINT COROUTINE_STATUS(c)
+a = COROUTINE_SPAWN("patrol", "guard", 2)
+b = COROUTINE_SPAWN("patrol", "scout", 3)
+frame = 0
+WHILE COROUTINE_UPDATE() > 0
+  frame = frame + 1
+WEND
+PRINT frame
+SUB waiter()
+  PRINT "waiting"
+  AWAIT 0.01
+  PRINT "woke"
+END SUB
+w = COROUTINE_SPAWN("waiter")
+AWAIT w
+PRINT COROUTINE_STATUS(w)
+YIELD
+REM YIELD and AWAIT suspend from inside FOR EACH and SELECT CASE
+FUNCTION each_case(items)
+  FOR EACH it IN items
+    SELECT it
+      CASE 1
+        YIELD "one"
+      CASE 2
+        AWAIT 0
+        YIELD "two"
+      ELSE
+        YIELD "other"
+    ENDSELECT
+  NEXT
+  RETURN "end"
+END FUNCTION
+e = COROUTINE_CREATE("each_case", [1, 2, 3])
+PRINT COROUTINE_RESUME(e)
+PRINT COROUTINE_RESUME(e)
+PRINT COROUTINE_RESUME(e)
+PRINT COROUTINE_RESUME(e)
+PRINT COROUTINE_RESUME(e)
+REM A file read as a future, awaited by a coroutine
+ok = WRITEALL("coroutines_async.tmp", "loaded")
+SUB loader()
+  f = READALL_ASYNC("coroutines_async.tmp")
+  AWAIT f
+  PRINT FUTURE_RESULT(f)
+END SUB
+l = COROUTINE_SPAWN("loader")
+AWAIT l
+FILE_DELETE("coroutines_async.tmp")
@@ -0,0 +1,50 @@
+REM ECS components in archetype tables: add, move, query, widen
+TYPE HealthData
+  currentHealth
+ENDTYPE
+s = Scene("Main")
+p = s.createEntity("Player")
+h = HealthData()
+h.currentHealth = 50
+p = p.addComponent("Health", h)
+p = p.setPosition(3, 4, 5)
+PRINT p.transform.x
+PRINT p.health.currenthealth
+
+REM Writes through a component proxy land in the entity's row
+t = p.transform
+t.x = 10
+PRINT p.transform.x
+PRINT LEN(s.queryAll("Health", "Transform"))
+
+REM Removing a component moves the entity and keeps the others
+p = p.removeComponent("Transform")
+PRINT p.hasComponent("Transform")
+PRINT p.health.currentHealth
+PRINT LEN(s.queryAll("Health", "Transform"))
+
+REM New entities start with the component's defaults
+e = s.createEntity("Enemy")
+e = e.addComponent("Health")
+PRINT e.health.currentHealth
+PRINT LEN(s.query("Health"))
+
+REM A value of another type widens the field for every entity
+c = p.health
+c.currentHealth = "dead"
+PRINT p.health.currentHealth
+PRINT e.health.currentHealth
+
+REM One access site resolves fields of different component types
+p = p.setPosition(7, 8, 9)
+FOR EACH comp IN p.components
+  PRINT comp.name + " " + STR(comp.x) + " " + STR(comp.currentHealth)
+NEXT
+REM Fields are matched in any case, and a new field is added on its first write
+t = p.Transform
+t.Spin = 2
+PRINT p.TRANSFORM.spin
+PRINT e.transform
+REM A proxy whose component was removed reads NIL
+p = p.removeComponent("Transform")
+PRINT t.x
@@ -0,0 +1,62 @@
+REM Structural changes made by systems wait for the end of the frame
+s = Scene("Main")
+FOR i = 1 TO 4
+  e = s.createEntity("E" + STR(i))
+  e = e.addComponent("Health")
+NEXT i
+q = ECS_CREATEQUERY("Health")
+tagged = ECS_CREATEQUERY("Script")
+
+REM Reap destroys every entity it visits and spawns one in its place;
+REM the walk still sees all four, and the changes land together
+SUB Reap(id, dt)
+  e = q.getNext()
+  PRINT "reap " + e.name + " " + STR(q.count())
+  x = s.destroyEntity(e)
+  n = s.createEntity("N")
+  n = n.addComponent("Script")
+  PRINT n.hasComponent("Script")
+END SUB
+ok = ECS_REGISTERSYSTEM("Reap", ["Health"])
+ECS_UPDATESYSTEMS(0.1)
+PRINT q.count()
+PRINT tagged.count()
+PRINT s.getEntityCount()
+
+REM Destroying a parent takes its children along
+p = s.createEntity("Parent")
+c = s.createEntity("Child", p)
+g = s.createEntity("Grandchild", c)
+x = s.destroyEntity(p)
+PRINT c.isAlive()
+PRINT g.isAlive()
+PRINT s.getEntityCount()
+
+REM Systems of one stage create entities; each gets a handle at once and
+REM its slot, scene place and components when the frame ends
+FOR i = 1 TO 3
+  e = s.createEntity("W" + STR(i))
+  e = e.addComponent("Work")
+NEXT i
+spawned = ECS_CREATEQUERY("Spawned")
+SUB Spawner(id, dt)
+  GLOBAL made, kid
+  made = s.createEntity("S")
+  made = made.addComponent("Spawned")
+  kid = s.createEntity("Kid", made)
+  PRINT made.isAlive()
+END SUB
+SUB Counter(id, dt)
+  PRINT "count " + STR(spawned.count())
+END SUB
+ok = ECS_REGISTERSYSTEM("Spawner", ["Work"], 0)
+ok = ECS_REGISTERSYSTEM("Counter", ["Work"], 1)
+PRINT ECS_MARKSYSTEMPURE("Spawner", [])
+PRINT ECS_MARKSYSTEMPURE("Counter", [])
+before = s.getEntityCount()
+ECS_UPDATESYSTEMS(0.1)
+PRINT spawned.count()
+PRINT s.getEntityCount() - before
+PRINT made.isAlive()
+PRINT LEN(made.children)
+PRINT kid.parent.name
@@ -0,0 +1,22 @@
+REM Entity handles carry a generation: destroyed entities go stale, and
+REM their slots are reused under a new handle
+s = Scene("Main")
+a = s.createEntity("A")
+b = s.createEntity("B")
+PRINT a.id
+PRINT b.id
+PRINT a.isAlive()
+x = s.destroyEntity(a)
+PRINT a.isAlive()
+PRINT a.hasComponent("Health")
+
+REM The freed slot comes back with the next generation
+c = s.createEntity("C")
+c = c.addComponent("Health")
+PRINT c.id = a.id
+PRINT c.id - 4294967296
+PRINT c.isAlive()
+PRINT a.isAlive()
+PRINT a.hasComponent("Health")
+PRINT c.hasComponent("Health")
+PRINT s.getEntityCount()
@@ -0,0 +1,55 @@
+REM Cached ECS queries follow component and activity changes
+s = Scene("Main")
+q = ECS_CREATEQUERY("Health")
+sq = s.createQuery("Health", "Transform")
+PRINT q.count()
+a = s.createEntity("A")
+a = a.addComponent("Health")
+b = s.createEntity("B")
+b = b.addComponent("Health")
+b = b.setPosition(1, 2)
+PRINT q.count()
+PRINT sq.count()
+
+REM getNext walks the matches, returns NIL once, then starts over
+FOR i = 1 TO q.count()
+  e = q.getNext()
+  PRINT e.name
+NEXT i
+e = q.getNext()
+e = q.getNext()
+PRINT e.name
+
+REM Inactive entities leave every query until reactivated
+b = b.setActive(FALSE)
+PRINT q.count()
+PRINT sq.count()
+b = b.setActive(TRUE)
+PRINT sq.count()
+a = a.removeComponent("Health")
+PRINT q.count()
+PRINT LEN(q.entities())
+
+REM Systems run over the same cached matches
+SUB Tick(id, dt)
+  PRINT "tick " + STR(id)
+END SUB
+ok = ECS_REGISTERSYSTEM("Tick", ["Health"])
+ECS_UPDATESYSTEMS(0.5)
+x = s.destroyEntity(b)
+PRINT q.count()
+
+REM Every query value has a cursor of its own, freed with the value
+c = s.createEntity("C")
+c = c.addComponent("Health")
+d = s.createEntity("D")
+d = d.addComponent("Health")
+q2 = ECS_CREATEQUERY("Health")
+e = q2.getNext()
+FOR i = 1 TO 1000
+  tmp = ECS_CREATEQUERY("Health")
+  e2 = tmp.getNext()
+NEXT i
+PRINT e2.name
+e = q2.getNext()
+PRINT e.name
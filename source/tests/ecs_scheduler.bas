@@ -0,0 +1,28 @@
+REM ECS systems run in stages: a pure system only waits for the systems it
+REM conflicts with, an undeclared one runs alone in priority order
+s = Scene("Main")
+e = s.createEntity("E")
+e = e.setPosition(1, 2)
+e = e.addComponent("Health")
+
+SUB MoveSys(id, dt)
+  PRINT "move"
+END SUB
+SUB FollowSys(id, dt)
+  PRINT "follow"
+END SUB
+SUB RegenSys(id, dt)
+  PRINT "regen"
+END SUB
+
+ok = ECS_REGISTERSYSTEM("MoveSys", ["Transform"], 0)
+ok = ECS_REGISTERSYSTEM("FollowSys", ["Transform"], 1)
+ok = ECS_REGISTERSYSTEM("RegenSys", ["Health"], 2)
+ECS_UPDATESYSTEMS(0.1)
+
+REM Regen touches nothing that Move writes, so it joins Move's stage
+PRINT ECS_MARKSYSTEMPURE("MoveSys", ["Transform"])
+PRINT ECS_MARKSYSTEMPURE("FollowSys", [])
+PRINT ECS_MARKSYSTEMPURE("RegenSys", ["Health"])
+PRINT ECS_MARKSYSTEMPURE("NoSuchSys", [])
+ECS_UPDATESYSTEMS(0.1)
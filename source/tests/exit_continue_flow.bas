@@ -0,0 +1,60 @@
+FUNCTION firstover(limit)
+  FOR i = 1 TO 100
+    IF i * i > limit THEN
+      RETURN i
+    ENDIF
+  NEXT i
+  RETURN -1
+END FUNCTION
+FUNCTION early(v)
+  IF v > 0 THEN
+    EXIT FUNCTION
+  ENDIF
+  RETURN "neg"
+END FUNCTION
+SUB stopper()
+  BREAK
+END SUB
+SUB quiet()
+  PRINT "in quiet"
+  EXIT SUB
+  PRINT "never"
+END SUB
+PRINT firstover(50)
+PRINT early(1)
+PRINT early(-1)
+quiet()
+VAR total = 0
+FOR i = 1 TO 5
+  FOR j = 1 TO 5
+    IF j = 3 THEN EXIT FOR
+    total = total + 1
+  NEXT j
+NEXT i
+PRINT total
+VAR n = 0
+WHILE 1
+  n = n + 1
+  IF n MOD 2 = 0 THEN CONTINUE
+  IF n > 7 THEN EXIT WHILE
+WEND
+PRINT n
+VAR m = 0
+DO
+  m = m + 1
+  IF m = 4 THEN stopper()
+LOOP
+PRINT m
+FOR k = 1 TO 3
+  SELECT k
+    CASE 2
+      CONTINUE
+  ENDSELECT
+  PRINT k
+NEXT k
+DO
+  REPEAT
+    EXIT DO
+  UNTIL 0
+LOOP
+PRINT "done"
@@ -0,0 +1,36 @@
+REM Numeric FOR loops: nested integer loops, fractional limits, body writes
+CONST W = 4
+CONST H = 3
+DIM tiles(H, W)
+sum = 0
+FOR y = 0 TO H - 1
+  FOR x = 0 TO W - 1
+    tiles[y][x] = y * W + x
+    sum = sum + tiles[y][x]
+  NEXT x
+NEXT y
+PRINT sum
+PRINT x
+PRINT y
+FOR i = 1 TO 2.5
+  PRINT i
+NEXT i
+FOR i = 3 TO 1 STEP -1
+  PRINT i
+NEXT i
+FOR i = 1 TO 10
+  IF i = 2 THEN
+    i = 8
+  ENDIF
+  PRINT i
+NEXT i
+FOR i = 1 TO 3
+  i = i + 0.5
+  PRINT i
+NEXT i
+SUB count_down(n)
+  FOR k = n TO 1 STEP -2
+    PRINT k
+  NEXT k
+END SUB
+count_down(5)
@@ -0,0 +1,32 @@
+REM FUNCTION calls: positional fast path, defaults, named arguments, recursion
+FUNCTION Area(w, h = 2)
+  RETURN w * h
+END FUNCTION
+PRINT Area(3, 4)
+PRINT Area(3)
+PRINT Area(h = 5, w = 2)
+PRINT Area(1, 2, 3)
+
+REM Parameters shadow the caller's variables only for the call
+w = 100
+PRINT Area(7, 1)
+PRINT w
+
+REM Constants in the caller stay visible and protected in the callee
+CONST SCALE = 10
+FUNCTION Scaled(v)
+  RETURN v * SCALE
+END FUNCTION
+PRINT Scaled(4)
+
+REM Deep recursion reuses frame storage
+FUNCTION Depth(n)
+  IF n = 0 THEN RETURN 0
+  RETURN Depth(n - 1) + 1
+END FUNCTION
+PRINT Depth(1000)
+FUNCTION Fib(n)
+  IF n < 2 THEN RETURN n
+  RETURN Fib(n - 1) + Fib(n - 2)
+END FUNCTION
+PRINT Fib(20)
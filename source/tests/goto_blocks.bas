@@ -0,0 +1,57 @@
+REM GOTO/GOSUB out of FOR EACH and SELECT CASE, at top level and in a SUB
+FOR EACH name IN ["ann", "bob", "cy"]
+  IF name = "bob" THEN GOTO found
+NEXT
+PRINT "not printed"
+found:
+PRINT "found " + name
+n = 0
+FOR EACH v IN [1, 2, 3]
+  GOSUB bump
+NEXT
+PRINT n
+mode = 2
+SELECT mode
+  CASE 1
+    PRINT "one"
+  CASE 2
+    GOSUB bump
+    GOTO picked
+  ELSE
+    PRINT "other"
+ENDSELECT
+PRINT "not printed"
+picked:
+PRINT n
+GOTO after
+bump:
+n = n + 10
+RETURN
+after:
+REM Blocks still run by the tree-walker jump to labels of the enclosing code
+USING r = 5
+  IF r = 5 THEN GOTO used
+  PRINT "not printed"
+ENDUSING
+used:
+PRINT "left USING"
+SUB classify(items)
+  FOR EACH it IN items
+    SELECT it
+      CASE IS < 0
+        GOTO negative
+      CASE 0 TO 9
+        GOSUB digit
+    ENDSELECT
+  NEXT
+  PRINT "all small"
+  RETURN
+negative:
+  PRINT "negative"
+  RETURN
+digit:
+  PRINT "digit " + STR(it)
+  RETURN
+END SUB
+classify([1, 5])
+classify([3, -2, 4])
@@ -0,0 +1,46 @@
+REM GOTO/GOSUB: line numbers, jumps from nested blocks, GOSUB inside a SUB
+10 N = 0
+20 GOSUB 100
+30 N = N + 1
+40 IF N < 3 THEN GOTO 20
+50 PRINT N
+60 GOTO 200
+100 PRINT "tick"
+110 IF N = 1 THEN
+120   PRINT "one"
+130   RETURN
+140 ENDIF
+150 RETURN
+200 FOR i = 1 TO 10
+210   IF i = 4 THEN GOTO found
+220 NEXT i
+found:
+PRINT i
+SUB twice(n)
+  k = 0
+  GOSUB bump
+  GOSUB bump
+  PRINT k
+  RETURN
+bump:
+  k = k + n
+  RETURN
+END SUB
+twice(5)
+FUNCTION total(items)
+  t = 0
+  FOR EACH v IN items
+    IF v > 0 THEN
+      GOSUB add
+    ENDIF
+  NEXT
+  RETURN t
+add:
+  t = t + v
+  GOSUB note
+  RETURN
+note:
+  PRINT "added " + STR(v)
+  RETURN
+END FUNCTION
+PRINT total([2, -1, 3])
@@ -1,2 +1,4 @@
 WRITEALL("demo.txt","hello world")
 PRINT READALL("demo.txt")
+FILE_DELETE("demo.txt")
+PRINT FILEEXISTS("demo.txt")
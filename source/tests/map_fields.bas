@@ -0,0 +1,53 @@
+REM Object fields: small and large (indexed) maps, overwrite, copy semantics
+TYPE Small
+  hp
+  label
+ENDTYPE
+TYPE Wide
+  f1
+  f2
+  f3
+  f4
+  f5
+  f6
+  f7
+  f8
+  f9
+  f10
+  f11
+  f12
+ENDTYPE
+s = Small()
+s.hp = 3
+s.label = "imp"
+s.hp = s.hp + 1
+PRINT s.hp
+PRINT s.label
+w = Wide()
+w.f1 = 1
+w.f12 = 12
+w.f7 = 7
+w.f12 = w.f12 + w.f1
+PRINT w.f12
+PRINT w.f7
+PRINT w.f3
+c = w
+c.f7 = 70
+PRINT w.f7
+PRINT c.f7
+REM Field names match in any case, in small and in indexed maps
+s.HP = 9
+PRINT s.hp
+PRINT s["Label"]
+PRINT w.F12
+c.F7 = 71
+PRINT c["f7"]
+REM Data keys stay exact: keys differing in case are separate entries
+m = MAP_CREATE()
+m = MAP_SET(m, "Key", 1)
+m = MAP_SET(m, "key", 2)
+PRINT LEN(MAP_KEYS(m))
+PRINT MAP_GET(m, "Key")
+PRINT MAP_GET(m, "key")
+PRINT m["Key"]
+PRINT m["KEY"]
@@ -0,0 +1,23 @@
+REM obj.method() resolves TYPE_METHOD from the receiver's type
+v = Vector3(3, 4, 0)
+PRINT v.length()
+w = v.add(Vector3(1, 1, 1)).scale(2)
+PRINT w.x
+PRINT w.z
+PRINT Vector2(6, 8).normalize().y
+c = Color(100, 50, 0)
+PRINT c.toHex()
+PRINT c.darken(0.5).r
+items = [3, 1, 2]
+PRINT items.length()
+PRINT items.first()
+s = "  Hello  "
+PRINT s.trim().upper()
+FUNCTION sizes(things)
+  total = 0
+  FOR i = 0 TO 2
+    total = total + things[i].length()
+  NEXT i
+  RETURN total
+END FUNCTION
+PRINT sizes([Vector2(3, 4), Vector3(0, 0, 2), Vector2(0, 1)])
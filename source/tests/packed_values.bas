@@ -0,0 +1,54 @@
+REM Vector2/Vector3/Color/Rectangle are value types with fixed fields
+v = Vector3(1, 2, 2)
+PRINT v.x + v.y + v.z
+v.x = 5
+PRINT v.x
+w = v
+w.y = 7
+PRINT v.y
+PRINT w.y
+PRINT v = Vector3(5, 2, 2)
+PRINT v = w
+s = VECTOR3_ADD(v, w)
+PRINT s.x
+PRINT s.y
+PRINT VECTOR3_LENGTH(Vector3(3, 4, 0))
+p = Vector2(3, 4)
+PRINT VECTOR2_LENGTH(p)
+n = VECTOR2_NORMALIZE(p)
+PRINT n.x
+c = Color(300, 20, 30)
+PRINT c.r
+PRINT c.a
+c.g = -5
+PRINT c.g
+PRINT COLOR_TOHEX(c)
+r = Rectangle(10, 20, 30, 40)
+PRINT r.width * r.height
+FUNCTION mid_x(rect)
+  RETURN rect.x + rect.width / 2
+END FUNCTION
+PRINT mid_x(r)
+total = 0
+FOR i = 1 TO 3
+  v.z = v.z + i
+  total = total + v.z
+NEXT i
+PRINT v.z
+PRINT total
+REM A field store keeps its slot per kind and re-resolves it when the kind changes
+FOR EACH q IN [Vector2(1, 1), Color(1, 2, 3, 4), Rectangle(0, 0, 2, 2)]
+  IF q = Color(1, 2, 3, 4) THEN
+    q.b = 400
+    PRINT q.b
+  ELSE
+    q.x = q.x + 8
+    PRINT q.x
+  ENDIF
+NEXT
+SUB nudge()
+  GLOBAL v
+  v.x = v.x + 1
+END SUB
+nudge()
+PRINT v.x
@@ -0,0 +1,22 @@
+REM Identifiers are case-insensitive: variables, constants, functions, GLOBAL
+CONST MaxHp = 10
+Score = 1
+FUNCTION AddPoints(n)
+  GLOBAL score
+  SCORE = Score + n
+  RETURN score
+END FUNCTION
+PRINT addpoints(2)
+PRINT ADDPOINTS(3)
+PRINT score
+PRINT maxhp * 2
+FOR Idx = 1 TO 2
+  PRINT idx
+NEXT IDX
+total = 0
+FOR i = 1 TO 3
+  TOTAL = Total + I
+NEXT i
+PRINT total
+PRINT LEN("abc")
+PRINT len("abcd")
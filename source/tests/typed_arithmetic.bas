@@ -0,0 +1,28 @@
+REM Integer arithmetic stays integral; mixed and string operands still work
+FUNCTION combine(a, b)
+  RETURN a + b
+END FUNCTION
+total = 0
+FOR i = 1 TO 2000
+  total = total + i * 1000
+NEXT i
+PRINT total
+PRINT 9223372036854775807 + 1
+PRINT 1 + 0.5
+PRINT combine(2, 3)
+PRINT combine(2.5, 3)
+PRINT combine("a", "b")
+PRINT combine("n", 1)
+PRINT combine(4, 5)
+n = 0
+WHILE n < 3
+  n = n + 1
+WEND
+PRINT n
+PRINT n = 3
+PRINT n < 2.5
+PRINT "abc" < "abd"
+PRINT -n
+FOR x = 0 TO 1 STEP 0.5
+  PRINT x
+NEXT x
@@ -0,0 +1,57 @@
+FUNCTION fib(n)
+  IF n < 2 THEN
+    RETURN n
+  ENDIF
+  RETURN fib(n - 1) + fib(n - 2)
+END FUNCTION
+SUB brk()
+  BREAK
+END SUB
+PRINT fib(12)
+VAR s = 0
+FOR i = 1 TO 10
+  IF i = 8 THEN
+    BREAK
+  ENDIF
+  s = s + i
+NEXT i
+PRINT s
+VAR k = 0
+WHILE k < 100
+  k = k + 1
+  SELECT k
+    CASE 5
+      BREAK
+  ENDSELECT
+WEND
+PRINT k
+VAR j = 0
+DO
+  j = j + 1
+  IF j > 4 THEN brk()
+LOOP
+PRINT j
+VAR r = 0
+REPEAT
+  r = r + 2
+UNTIL r >= 7
+PRINT r
+FOR a = 10 TO 1 STEP -3
+  PRINTC a
+  PRINTC " "
+NEXT a
+PRINT ""
+GOSUB sub1
+PRINT "after gosub"
+GOTO skip
+PRINT "not printed"
+skip:
+PRINT [1,2,3][1]
+PRINT "a" + 1
+PRINT 7 \ 2
+PRINT 2 ^ 10
+PRINT NOT 0
+END
+sub1:
+PRINT "in sub1"
+RETURN
@@ -0,0 +1,26 @@
+x = 5
+counter = 0
+SUB peek()
+  PRINT x
+  x = 1
+  PRINT x
+END SUB
+SUB bump()
+  GLOBAL counter
+  counter = counter + 1
+END SUB
+FUNCTION twice(v)
+  LOCAL t
+  t = v * 2
+  RETURN t
+END FUNCTION
+peek()
+PRINT x
+bump()
+bump()
+PRINT counter
+PRINT twice(21)
+CONST LIMIT = 3
+FOR q = 1 TO LIMIT
+  PRINTC q
+NEXT q
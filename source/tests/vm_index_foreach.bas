@@ -0,0 +1,61 @@
+REM Indexed stores and FOR EACH run as VM instructions, not through the tree-walker
+DIM a(3)
+k = 10
+FOR i = 0 TO 3
+  a[i] = i + k
+NEXT i
+PRINT a[3]
+REM Nested paths grow, non-arrays become arrays, negative indices are ignored
+g = 0
+g[2][1] = "deep"
+PRINT g[2][1]
+a[-1] = 99
+PRINT LEN(a)
+SUB fill(n)
+  GLOBAL shared
+  shared[n] = n * n
+END SUB
+fill(2)
+fill(4)
+PRINT shared[4]
+REM FOR EACH: arrays, maps, EXIT FOR and CONTINUE
+total = 0
+FOR EACH v IN [1, 2, 3, 4, 5, 6]
+  IF v = 2 THEN CONTINUE
+  IF v = 5 THEN EXIT FOR
+  total = total + v
+NEXT
+PRINT total
+TYPE Pair
+  left
+  right
+ENDTYPE
+p = Pair()
+p.left = "L"
+p.right = "R"
+FOR EACH e IN p
+  IF e.key <> "_type" THEN PRINT e.key + "=" + e.value
+NEXT
+REM The loop sees the collection as it was when it started
+xs = [1, 2, 3]
+FOR EACH x IN xs
+  xs = APPEND(xs, x)
+NEXT
+PRINT LEN(xs)
+REM Blocks compiled natively can suspend and jump like any other
+FUNCTION each_yield(items)
+  FOR EACH it IN items
+    YIELD it * 10
+  NEXT
+  RETURN "end"
+END FUNCTION
+c = COROUTINE_CREATE("each_yield", [1, 2])
+PRINT COROUTINE_RESUME(c)
+PRINT COROUTINE_RESUME(c)
+PRINT COROUTINE_RESUME(c)
+FOR EACH w IN ["a", "b", "c"]
+  IF w = "b" THEN GOTO found
+NEXT
+PRINT "not printed"
+found:
+PRINT "found " + w
@@ -0,0 +1,90 @@
+// Micro-benchmark: Value::Map (FlatMap) against the std::map<std::string, Value>
+// it replaced. Measures object construction, field reads and field writes
+// for objects of a few typical sizes.
+//
+// Build with -DBUILD_BENCHMARKS=ON and run ./bench_value_map [iterations].
+#include "bas/value.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <vector>
+
+using bas::Value;
+
+namespace {
+
+using TreeMap = std::map<std::string, Value>;
+using Clock = std::chrono::steady_clock;
+
+// Field names as a script would use them: short, lowercase, distinct.
+std::vector<std::string> field_names(int n) {
+  static const char* base[] = {"x", "y", "z", "w", "vx", "vy", "vz", "hp",
+                               "name", "kind", "speed", "angle", "scale", "alpha", "layer", "tag"};
+  std::vector<std::string> out;
+  for (int i = 0; i < n; ++i) {
+    out.emplace_back(i < 16 ? std::string(base[i]) : "field" + std::to_string(i));
+  }
+  return out;
+}
+
+template <typename F>
+double time_ms(F&& f) {
+  auto start = Clock::now();
+  f();
+  return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// Keeps results observable so the loops are not optimized away.
+volatile double sink = 0;
+
+template <typename M>
+void run(const char* label, int fields, int iterations) {
+  const auto names = field_names(fields);
+
+  double build = time_ms([&] {
+    for (int it = 0; it < iterations; ++it) {
+      M m;
+      for (int i = 0; i < fields; ++i) m[names[i]] = Value::from_int(i);
+      sink = sink + static_cast<double>(m.size());
+    }
+  });
+
+  M obj;
+  for (int i = 0; i < fields; ++i) obj[names[i]] = Value::from_int(i);
+
+  double read = time_ms([&] {
+    long long acc = 0;
+    for (int it = 0; it < iterations; ++it) {
+      for (int i = 0; i < fields; ++i) {
+        auto f = obj.find(names[i]);
+        if (f != obj.end()) acc += f->second.as_int();
+      }
+    }
+    sink = sink + static_cast<double>(acc);
+  });
+
+  double write = time_ms([&] {
+    for (int it = 0; it < iterations; ++it) {
+      for (int i = 0; i < fields; ++i) obj[names[i]] = Value::from_int(it);
+    }
+    sink = sink + static_cast<double>(obj.size());
+  });
+
+  const double ops = static_cast<double>(iterations) * fields;
+  std::printf("%-10s %6d %12.1f %12.1f %12.1f\n", label, fields,
+              build * 1e6 / ops, read * 1e6 / ops, write * 1e6 / ops);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  const int iterations = argc > 1 ? std::atoi(argv[1]) : 200000;
+  std::printf("%-10s %6s %12s %12s %12s\n", "map", "fields", "build ns/f", "read ns/f", "write ns/f");
+  for (int fields : {4, 8, 16, 32}) {
+    run<TreeMap>("std::map", fields, iterations);
+    run<Value::Map>("FlatMap", fields, iterations);
+  }
+  return 0;
+}
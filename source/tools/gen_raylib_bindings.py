@@ -43,6 +43,7 @@ namespace bas {
 #include <algorithm>
 
 using bas::Value;
+using bas::NativeArgs;
 using Fn = bas::NativeFn;
 
 // Helper macros to avoid narrowing conversion warnings
@@ -171,11 +172,11 @@ def ret_to_value(expr, t):
         "double": f"return Value::from_number({expr});",
         "bool": f"return Value::from_bool({expr});",
         "string": f"return Value::from_string({expr});",
-        "Vector2": f"return Value::from_map(Vector2_to_Map({expr}));",
-        "Vector3": f"return Value::from_map(Vector3_to_Map({expr}));",
-        "Color": f"return Value::from_map(Color_to_Map({expr}));",
-        "color": f"return Value::from_map(Color_to_Map({expr}));",
-        "Rectangle": f"return Value::from_map(Rectangle_to_Map({expr}));",
+        "Vector2": f"return Vector2_to_Value({expr});",
+        "Vector3": f"return Vector3_to_Value({expr});",
+        "Color": f"return Color_to_Value({expr});",
+        "color": f"return Color_to_Value({expr});",
+        "Rectangle": f"return Rectangle_to_Value({expr});",
         "Camera2D": f"return Value::from_map(Camera2D_to_Map({expr}));",
         "Camera3D": f"return Value::from_map(Camera3D_to_Map({expr}));",
     }.get(t, f"return Value::from_map({t}_to_Map({expr}));")  # Default: try _to_Map conversion
@@ -236,7 +237,7 @@ def emit_fn(f):
                 expr = raw_body.rstrip().rstrip(';').strip()
                 # Wrap in appropriate return statement based on return type
                 if ret == "color":
-                    body = f"        return Value::from_map(Color_to_Map({expr}));"
+                    body = f"        return Color_to_Value({expr});"
                 elif ret == "int":
                     body = f"        return Value::from_int({expr});"
                 elif ret == "float" or ret == "double":
@@ -246,9 +247,9 @@ def emit_fn(f):
                 elif ret == "string":
                     body = f"        return Value::from_string({expr});"
                 elif ret == "Vector2":
-                    body = f"        return Value::from_map(Vector2_to_Map({expr}));"
+                    body = f"        return Vector2_to_Value({expr});"
                 elif ret == "Vector3":
-                    body = f"        return Value::from_map(Vector3_to_Map({expr}));"
+                    body = f"        return Vector3_to_Value({expr});"
                 else:
                     # Default: assume it's an expression that returns the type
                     body = f"        return {expr};"
@@ -257,7 +258,7 @@ def emit_fn(f):
         params = ", ".join(arg_to_cpp(i, t) for i, t in enumerate(args))
         call = "        " + ret_to_value(f"{map_to}({params})", ret)
     
-    return f'''    R.add_with_policy("{name}", Fn{{"{name}", {arity}, [] (const std::vector<Value>& args) -> Value {{
+    return f'''    R.add_with_policy("{name}", Fn{{"{name}", {arity}, [] (NativeArgs args) -> Value {{
 {arity_check}{call}
     }}}}, true);'''
 
@@ -272,12 +273,12 @@ def emit_constant(c):
         parts = value.split(",")
         if len(parts) == 4:  # RGBA color
             r, g, b, a = parts
-            return f'''    R.add_with_policy("{name}", Fn{{"{name}", 0, [] (const std::vector<Value>& args) -> Value {{
+            return f'''    R.add_with_policy("{name}", Fn{{"{name}", 0, [] (NativeArgs args) -> Value {{
         return Value::from_string("{r},{g},{b},{a}");
     }}}}, true);'''
     
     # Simple string/number constants
-    return f'''    R.add_with_policy("{name}", Fn{{"{name}", 0, [] (const std::vector<Value>& args) -> Value {{
+    return f'''    R.add_with_policy("{name}", Fn{{"{name}", 0, [] (NativeArgs args) -> Value {{
         return Value::from_string("{value}");
     }}}}, true);'''
 